@@ -0,0 +1,61 @@
+###### Namelist for a thermal plasma in 1D geometry with the vectorized operators
+# The same case with the scalar operators is tst1d_20_thermal_plasma.py
+
+dx = 0.1
+dt = 0.95*dx
+nx = 1024
+npatch_x = 16
+
+Main(
+    geometry = "1Dcartesian",
+
+    interpolation_order = 2,
+
+    timestep = dt,
+    simulation_time = 400*dt,
+
+    cell_length  = [dx],
+    grid_length = [nx*dx],
+
+    number_of_patches = [npatch_x],
+
+    EM_boundary_conditions = [ ["periodic","periodic"] ],
+
+    print_every = 40,
+
+    random_seed = 0
+)
+
+Vectorization(
+    mode = "on",
+)
+
+for name, mass, charge, pusher in [["electron", 1., -1., "boris"], ["ion", 1836., 1., "vay"]]:
+    Species(
+        name = name,
+        position_initialization = "random",
+        momentum_initialization = "maxwell-juettner",
+        particles_per_cell = 64,
+        mass = mass,
+        charge = charge,
+        number_density = 1.,
+        mean_velocity = [0.05 if name=="electron" else 0., 0., 0.],
+        temperature = [0.01],
+        pusher = pusher,
+        boundary_conditions = [ ["periodic", "periodic"] ],
+    )
+
+DiagScalar(
+    every = 10,
+)
+
+DiagFields(
+    every = 100,
+    fields = ["Ex", "Ey", "Rho_electron", "Jx", "Jy"]
+)
+
+# Early fields, compared between the scalar and vectorized operators
+DiagFields(
+    every = [10, 10, 1],
+    fields = ["Ex", "Ey", "Ez", "Jx", "Jy", "Jz"]
+)
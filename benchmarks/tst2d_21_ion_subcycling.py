@@ -0,0 +1,75 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# Ions drifting along z, pushed every 4 timesteps (Species.subcycle). The same case
+# without subcycling is tst2d_21_ion_no_subcycling.py: the time-averaged ion current
+# and the energies must be the same.
+
+import math as m
+
+subcycle = 4
+
+T   = 0.001                    # electron & ion temperature in me c^2
+Lde = m.sqrt(T)                # Debye length in units of c/\omega_{pe}
+dx  = 0.5*Lde
+dt  = 0.95 * dx/m.sqrt(2.)
+nx  = 64
+
+Main(
+    geometry = "2Dcartesian",
+    
+    interpolation_order = 2,
+    
+    timestep = dt,
+    simulation_time = 400*dt,
+    
+    cell_length  = [dx, dx],
+    grid_length = [nx*dx, nx*dx],
+    
+    number_of_patches = [4, 4],
+    
+    EM_boundary_conditions = [ ["periodic"] ],
+    
+    print_every = 40,
+    
+    random_seed = smilei_mpi_rank
+)
+
+Species(
+    name = "ion",
+    position_initialization = "regular",
+    momentum_initialization = "maxwell-juettner",
+    particles_per_cell = 16,
+    mass = 100.,
+    charge = 1.,
+    number_density = 1.,
+    mean_velocity = [0., 0., 0.02],
+    temperature = [T],
+    pusher = "boris",
+    subcycle = subcycle,
+    boundary_conditions = [ ["periodic"] ],
+)
+Species(
+    name = "electron",
+    position_initialization = "ion",
+    momentum_initialization = "maxwell-juettner",
+    particles_per_cell = 16,
+    mass = 1.,
+    charge = -1.,
+    number_density = 1.,
+    temperature = [T],
+    pusher = "boris",
+    boundary_conditions = [ ["periodic"] ],
+)
+
+DiagScalar(
+    every = 10,
+)
+
+# The average over subcycle timesteps contains exactly one ion push
+DiagFields(
+    every = 20,
+    time_average = subcycle,
+    fields = ["Ez", "Jz", "Jz_ion", "Jz_electron"]
+)
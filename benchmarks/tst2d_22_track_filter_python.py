@@ -0,0 +1,112 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# Thermal plasma with filtered DiagTrackParticles, evaluated by python.
+# The same case with the filters translated to native code is tst2d_22_track_filter.py:
+# the selected particles must be the same.
+
+import math as m
+
+T   = 0.001                    # electron & ion temperature in me c^2
+Lde = m.sqrt(T)                # Debye length in units of c/\omega_{pe}
+dx  = 0.5*Lde
+dt  = 0.95 * dx/m.sqrt(2.)
+nx  = 32
+nt  = 200
+
+Main(
+    geometry = "2Dcartesian",
+    
+    interpolation_order = 2,
+    
+    timestep = dt,
+    simulation_time = nt*dt,
+    
+    cell_length  = [dx, dx],
+    grid_length = [nx*dx, nx*dx],
+    
+    number_of_patches = [4, 4],
+    
+    EM_boundary_conditions = [ ["periodic"] ],
+    
+    print_every = 40,
+    
+    random_seed = smilei_mpi_rank
+)
+
+Species(
+    name = "ion",
+    position_initialization = "regular",
+    momentum_initialization = "maxwell-juettner",
+    particles_per_cell = 4,
+    mass = 100.,
+    charge = 1.,
+    number_density = 1.,
+    temperature = [T],
+    pusher = "boris",
+    boundary_conditions = [ ["periodic"] ],
+)
+Species(
+    name = "electron",
+    position_initialization = "ion",
+    momentum_initialization = "maxwell-juettner",
+    particles_per_cell = 4,
+    mass = 1.,
+    charge = -1.,
+    number_density = 1.,
+    temperature = [T],
+    pusher = "boris",
+    boundary_conditions = [ ["periodic"] ],
+)
+Species(
+    name = "test",
+    position_initialization = "random",
+    momentum_initialization = "maxwell-juettner",
+    particles_per_cell = 4,
+    mass = 1.,
+    charge = -1.,
+    number_density = 1.,
+    temperature = [T],
+    pusher = "boris",
+    boundary_conditions = [ ["periodic"] ],
+    is_test = True
+)
+
+DiagScalar(
+    every = 10,
+)
+
+# Bounds on the momentum
+def electron_filter(particles):
+    return (particles.px > 0.02) & (particles.py < 0.)
+
+# About 10% of the ions, always the same ones
+def ion_filter(particles):
+    return id_hash(particles.id) < 0.1
+
+# Region growing with time
+def test_filter(particles):
+    return particles.x < nx*dx * (Main.iteration + 10.) / (nt + 10.)
+
+DiagTrackParticles(
+    species = "electron",
+    every = 40,
+    filter = electron_filter,
+    native_filter = False,
+    attributes = ["px", "py"]
+)
+DiagTrackParticles(
+    species = "ion",
+    every = 40,
+    filter = ion_filter,
+    native_filter = False,
+    attributes = ["x", "y"]
+)
+DiagTrackParticles(
+    species = "test",
+    every = 40,
+    filter = test_filter,
+    native_filter = False,
+    attributes = ["x"]
+)
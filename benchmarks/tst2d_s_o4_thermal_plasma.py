@@ -0,0 +1,114 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# 4th order scalar operators in 2D. The same case with vectorized operators is
+# tst2d_v_o4_thermal_plasma.py.
+
+import math as m
+
+
+TkeV = 10.						# electron & ion temperature in keV
+T   = TkeV/511.   				# electron & ion temperature in me c^2
+n0  = 1.
+Lde = m.sqrt(T)					# Debye length in units of c/\omega_{pe}
+dx  = 0.5*Lde 					# cell length (same in x & y)
+dy  = dx
+dt  = 0.95 * dx/m.sqrt(2.)		# timestep (0.95 x CFL)
+
+Lx    = 128.*dx
+Ly    = 128.*dy
+Tsim  = 4.*m.pi
+
+def n0_(x,y):
+	if (0.1*Lx<x<0.9*Lx) and (0.1*Ly<y<0.9*Ly):
+		return n0
+	else:
+		return 0.
+
+
+Main(
+    geometry = "2Dcartesian",
+    
+    interpolation_order = 4,
+    
+    timestep = dt,
+    simulation_time = Tsim,
+    
+    cell_length  = [dx,dy],
+    grid_length = [Lx,Ly],
+    
+    number_of_patches = [8,8],
+    
+    EM_boundary_conditions = [ ["periodic"] ],
+    
+    print_every = 10,
+
+    random_seed = 0
+)
+
+
+LoadBalancing(
+    every = 20,
+    cell_load = 1.,
+    frozen_particle_load = 0.1
+)
+
+
+Species(
+    name = "proton",
+    position_initialization = "regular",
+    momentum_initialization = "mj",
+    particles_per_cell = 64,
+    c_part_max = 1.0,
+    mass = 1836.0,
+    charge = 1.0,
+    charge_density = n0_,
+    mean_velocity = [0., 0.0, 0.0],
+    temperature = [T],
+    pusher = "boris",
+    boundary_conditions = [
+    	["periodic", "periodic"],
+    	["periodic", "periodic"],
+    ],
+)
+Species(
+    name = "electron",
+    position_initialization = "regular",
+    momentum_initialization = "mj",
+    particles_per_cell = 64,
+    c_part_max = 1.0,
+    mass = 1.0,
+    charge = -1.0,
+    charge_density = n0_,
+    mean_velocity = [0., 0.0, 0.0],
+    temperature = [T],
+    pusher = "boris",
+    boundary_conditions = [
+    	["periodic", "periodic"],
+    	["periodic", "periodic"],
+    ],
+)
+
+Checkpoints(
+    dump_step = 0,
+    dump_minutes = 0.0,
+    exit_after_dump = False,
+)
+
+DiagFields(
+    every = 50,
+    fields = ['Ex','Ey','Ez','Jx','Jy','Jz','Rho']
+)
+
+# Early fields, compared between the scalar and vectorized operators
+DiagFields(
+    every = [10, 10, 1],
+    fields = ['Ex','Ey','Ez','Jx','Jy','Jz']
+)
+
+DiagScalar(every = 10)
+
+DiagPerformances(
+    every = 50,
+)
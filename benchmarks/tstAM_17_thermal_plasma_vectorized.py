@@ -0,0 +1,71 @@
+###### Namelist for a thermal plasma in AM geometry with the vectorized operators
+# The same case with the scalar operators is tstAM_17_thermal_plasma.py
+
+dx = 0.5
+dr = 0.5
+dt = 0.4*dx
+nx = 128
+nr = 64
+npatch_x = 8
+npatch_r = 4
+
+Main(
+    geometry = "AMcylindrical",
+
+    interpolation_order = 2,
+
+    timestep = dt,
+    simulation_time = 200*dt,
+
+    cell_length  = [dx, dr],
+    grid_length = [ nx*dx,  nr*dr],
+
+    number_of_AM = 2,
+
+    number_of_patches = [npatch_x, npatch_r],
+
+    EM_boundary_conditions = [
+        ["silver-muller","silver-muller"],
+        ["buneman","buneman"],
+    ],
+
+    print_every = 20,
+
+    random_seed = 0
+)
+
+Vectorization(
+    mode = "on",
+)
+
+for name, mass, charge in [["electron", 1., -1.], ["ion", 1836., 1.]]:
+    Species(
+        name = name,
+        position_initialization = "random",
+        momentum_initialization = "maxwell-juettner",
+        particles_per_cell = 32,
+        mass = mass,
+        charge = charge,
+        number_density = trapezoidal(1., xvacuum=8*dx, xplateau=(nx-16)*dx, yvacuum=0., yplateau=0.75*nr*dr),
+        temperature = [0.01],
+        pusher = "boris",
+        boundary_conditions = [
+            ["remove", "remove"],
+            ["reflective", "remove"],
+        ],
+    )
+
+DiagScalar(
+    every = 10,
+)
+
+DiagFields(
+    every = 100,
+    fields = ["El_mode_0", "Er_mode_0", "Et_mode_1", "Rho_mode_0", "Jl_mode_1"]
+)
+
+# Early fields, compared between the scalar and vectorized operators
+DiagFields(
+    every = [10, 10, 1],
+    fields = [f+"_mode_"+str(m) for f in ["El", "Er", "Et", "Jl", "Jr", "Jt"] for m in range(2)]
+)
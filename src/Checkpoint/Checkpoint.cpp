@@ -7,8 +7,11 @@
 #include "Checkpoint.h"
 
 #include <sstream>
+#include <fstream>
 #include <iomanip>
 #include <string>
+#include <cstdio>
+#include <algorithm>
 
 #include <mpi.h>
 
@@ -48,7 +51,11 @@ Checkpoint::Checkpoint( Params &params, SmileiMPI *smpi ) :
     keep_n_dumps_max( 10000 ),
     dump_deflate( 0 ),
     dump_request( smpi->getSize() ),
-    file_grouping( 0 )
+    file_grouping( 0 ),
+    asynchronous( false ),
+    group_comm( MPI_COMM_NULL ),
+    current_image( 0 ),
+    write_failed( false )
 {
 
     if( PyTools::nComponents( "Checkpoints" ) > 0 ) {
@@ -85,6 +92,19 @@ Checkpoint::Checkpoint( Params &params, SmileiMPI *smpi ) :
             MESSAGE( 1, "Code will group checkpoint files by "<< file_grouping );
         }
 
+        PyTools::extract( "asynchronous", asynchronous, "Checkpoints"  );
+        if( asynchronous ) {
+            MESSAGE( 1, "Checkpoint files are written in the background" );
+            if( file_grouping > 0 ) {
+#ifndef _NO_MPI_TM
+                // The background threads of a group pass a token to write their files one after the other
+                MPI_Comm_split( smpi->world(), smpi->getRank()/file_grouping, smpi->getRank(), &group_comm );
+#else
+                WARNING( "Without MPI_THREAD_MULTIPLE, the checkpoint files of a group are written simultaneously" );
+#endif
+            }
+        }
+
         smpi->barrier();
 
         if( params.restart ) {
@@ -207,6 +227,12 @@ void Checkpoint::dump( VectorPatch &vecPatches, Region &region, unsigned int iti
             ( dump_step != 0 && ( ( itime-this_run_start_step ) % dump_step == 0 ) ) ||
             ( time_dump_step!=0 && itime==time_dump_step ) ) {
         dumpAll( vecPatches, region, itime,  smpi, simWindow, params );
+        if( asynchronous ) {
+            // The previous image must be written before (it may have the same file name)
+            waitDump();
+            writer = std::thread( &Checkpoint::writeImage, this, current_image );
+            current_image = 1 - current_image;
+        }
         if( exit_after_dump || ( ( signal_received!=0 ) && ( signal_received != SIGUSR2 ) ) ) {
             exit_asap=true;
         }
@@ -220,17 +246,16 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, Region &region, unsigned int
 {
     unsigned int num_dump=dump_number % keep_n_dumps;
 
-    ostringstream nameDumpTmp( "" );
-    nameDumpTmp << "checkpoints" << PATH_SEPARATOR;
-    if( file_grouping>0 ) {
-        nameDumpTmp << setfill( '0' ) << setw( int( 1+log10( smpi->getSize()/file_grouping+1 ) ) ) << smpi->getRank()/file_grouping << PATH_SEPARATOR;
-    }
-
-    nameDumpTmp << "dump-" << setfill( '0' ) << setw( 5 ) << num_dump << "-" << setfill( '0' ) << setw( 10 ) << smpi->getRank() << ".h5" ;
-    std::string dumpName=nameDumpTmp.str();
+    std::string dumpName = dumpFileName( num_dump, smpi->getRank(), smpi->getSize(), file_grouping );
 
 
-    H5Write f( dumpName );
+    // In asynchronous mode, the file is only built in memory here
+    std::vector<char> *image = NULL;
+    if( asynchronous ) {
+        image = &images[current_image];
+        image_names[current_image] = dumpName;
+    }
+    H5Write f( dumpName, image );
     dump_number++;
 
 #ifdef  __DEBUG
@@ -247,6 +272,16 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, Region &region, unsigned int
     f.attr( "dump_number", dump_number );
 
     f.vect( "patch_count", smpi->patch_count );
+    f.attr( "file_grouping", file_grouping );
+
+    // Number of particles of each patch, to distribute the patches when restarting on a different number of ranks
+    vector<unsigned int> patch_particles( vecPatches.size(), 0 );
+    for( unsigned int ipatch=0 ; ipatch<vecPatches.size(); ipatch++ ) {
+        for( unsigned int ispec=0 ; ispec<vecPatches( ipatch )->vecSpecies.size() ; ispec++ ) {
+            patch_particles[ipatch] += vecPatches( ipatch )->vecSpecies[ispec]->getNbrOfParticles();
+        }
+    }
+    f.vect( "patch_particles", patch_particles );
 
     // Write diags scalar data
     DiagnosticScalar *scalars = static_cast<DiagnosticScalar *>( vecPatches.globalDiags[0] );
@@ -327,6 +362,55 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, Region &region, unsigned int
 }
 
 
+string Checkpoint::dumpFileName( unsigned int num_dump, int rank, int nranks, unsigned int grouping )
+{
+    ostringstream name( "" );
+    name << "checkpoints" << PATH_SEPARATOR;
+    if( grouping>0 ) {
+        name << setfill( '0' ) << setw( int( 1+log10( nranks/grouping+1 ) ) ) << rank/grouping << PATH_SEPARATOR;
+    }
+    name << "dump-" << setfill( '0' ) << setw( 5 ) << num_dump << "-" << setfill( '0' ) << setw( 10 ) << rank << ".h5" ;
+    return name.str();
+}
+
+
+void Checkpoint::waitDump()
+{
+    if( writer.joinable() ) {
+        writer.join();
+        if( write_failed ) {
+            ERROR( "Cannot write checkpoint file " << image_names[1-current_image] );
+        }
+    }
+}
+
+
+// Write to a temporary file first, so that an interrupted write cannot replace a valid dump
+void Checkpoint::writeImage( unsigned int i )
+{
+    // With file_grouping, wait until the previous process of the group has written its file
+    int group_rank = 0, group_size = 1;
+    if( group_comm != MPI_COMM_NULL ) {
+        MPI_Comm_rank( group_comm, &group_rank );
+        MPI_Comm_size( group_comm, &group_size );
+        if( group_rank > 0 ) {
+            MPI_Recv( NULL, 0, MPI_INT, group_rank-1, 0, group_comm, MPI_STATUS_IGNORE );
+        }
+    }
+    
+    string tmp_name = image_names[i] + ".tmp";
+    ofstream file( tmp_name.c_str(), ios::binary );
+    file.write( images[i].data(), images[i].size() );
+    file.close();
+    write_failed = file.fail() || rename( tmp_name.c_str(), image_names[i].c_str() ) != 0;
+    vector<char>().swap( images[i] );
+    
+    if( group_rank < group_size-1 ) {
+        MPI_Send( NULL, 0, MPI_INT, group_rank+1, 0, group_comm );
+    }
+}
+
+
 void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
 {
     ElectroMagn * EMfields = patch->EMfields;
@@ -476,20 +560,20 @@ void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
             for( unsigned int i=0; i<spec->particles->Position.size(); i++ ) {
                 ostringstream my_name( "" );
                 my_name << "Position-" << i;
-                s.vect( my_name.str(), spec->particles->Position[i] );//, dump_deflate );
+                s.vect( my_name.str(), spec->particles->Position[i][0], spec->particles->size(), H5T_NATIVE_DOUBLE );//, dump_deflate );
             }
 
             for( unsigned int i=0; i<spec->particles->Momentum.size(); i++ ) {
                 ostringstream my_name( "" );
                 my_name << "Momentum-" << i;
-                s.vect( my_name.str(),spec->particles->Momentum[i] );//, dump_deflate );
+                s.vect( my_name.str(), spec->particles->Momentum[i][0], spec->particles->size(), H5T_NATIVE_DOUBLE );//, dump_deflate );
             }
 
-            s.vect( "Weight", spec->particles->Weight );//, dump_deflate );
-            s.vect( "Charge", spec->particles->Charge );//, dump_deflate );
+            s.vect( "Weight", spec->particles->Weight[0], spec->particles->size(), H5T_NATIVE_DOUBLE );//, dump_deflate );
+            s.vect( "Charge", spec->particles->Charge[0], spec->particles->size(), H5T_NATIVE_SHORT );//, dump_deflate );
 
             if( spec->particles->tracked ) {
-                s.vect( "Id", spec->particles->Id, H5T_NATIVE_UINT64 );//, dump_deflate );
+                s.vect( "Id", spec->particles->Id[0], spec->particles->size(), H5T_NATIVE_UINT64 );//, dump_deflate );
             }
 
             s.vect( "first_index", spec->particles->first_index );
@@ -536,7 +620,7 @@ void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
 };
 
 
-void Checkpoint::readPatchDistribution( SmileiMPI *smpi, SimWindow *simWin )
+void Checkpoint::readPatchDistribution( SmileiMPI *smpi, SimWindow *simWin, Params &params )
 {
     H5Read f( restart_file );
 
@@ -549,14 +633,63 @@ void Checkpoint::readPatchDistribution( SmileiMPI *smpi, SimWindow *simWin )
         WARNING( "                while running version is " << string( __VERSION ) );
     }
 
-    vector<int> patch_count( smpi->getSize() );
-    f.vect( "patch_count", patch_count );
-    smpi->patch_count = patch_count;
+    vector<int> patch_count;
+    f.vect( "patch_count", patch_count, true );
+    int dump_size = patch_count.size();
+
+    if( dump_size == smpi->getSize() ) {
+
+        smpi->patch_count = patch_count;
+
+        smpi->patch_refHindexes.resize( smpi->patch_count.size(), 0 );
+        smpi->patch_refHindexes[0] = 0;
+        for( int rk=1 ; rk<smpi->smilei_sz ; rk++ ) {
+            smpi->patch_refHindexes[rk] = smpi->patch_refHindexes[rk-1] + smpi->patch_count[rk-1];
+        }
+
+    } else {
+
+        MESSAGE( 1, "Dump made by " << dump_size << " MPI processes: patches are distributed again" );
+        if( params.multiple_decomposition ) {
+            ERROR( "Restarting with a different number of MPI processes is not supported with MultipleDecomposition" );
+        }
+
+        // Names of the files of all ranks of the previous run
+        unsigned int dump_grouping = file_grouping;
+        if( f.hasAttr( "file_grouping" ) ) {
+            f.attr( "file_grouping", dump_grouping );
+        }
+        string sep = string( "checkpoints" ) + PATH_SEPARATOR;
+        size_t dir_end = restart_file.rfind( sep );
+        size_t num_start = restart_file.rfind( "dump-" ) + 5;
+        if( dir_end == string::npos || num_start < 5 ) {
+            ERROR( "Cannot parse the name of restart file " << restart_file );
+        }
+        unsigned int num_dump = stoi( restart_file.substr( num_start, restart_file.find( "-", num_start ) - num_start ) );
+        restart_rank_files.resize( dump_size );
+        restart_refHindexes.resize( dump_size+1, 0 );
+        for( int rk=0 ; rk<dump_size ; rk++ ) {
+            restart_rank_files[rk] = restart_file.substr( 0, dir_end ) + dumpFileName( num_dump, rk, dump_size, dump_grouping );
+            restart_refHindexes[rk+1] = restart_refHindexes[rk] + patch_count[rk];
+        }
+        if( restart_refHindexes[dump_size] != ( int )params.tot_number_of_patches ) {
+            ERROR( "Number of patches differs between dump (" << restart_refHindexes[dump_size] << ") and namelist ("<<params.tot_number_of_patches<<")" );
+        }
+
+        // Load of each patch, as in the initial balancing
+        vector<double> patch_load( params.tot_number_of_patches, 1. );
+        if( params.has_load_balancing ) {
+            unsigned int ncells_perpatch = 1;
+            for( unsigned int i = 0; i < params.nDim_field; i++ ) {
+                ncells_perpatch *= params.n_space[i]+2*params.oversize[i];
+            }
+            readPatchParticles( smpi, patch_load );
+            for( unsigned int ipatch=0; ipatch<patch_load.size(); ipatch++ ) {
+                patch_load[ipatch] += ncells_perpatch*params.cell_load;
+            }
+        }
+        smpi->patch_count_from_loads( patch_load );
 
-    smpi->patch_refHindexes.resize( smpi->patch_count.size(), 0 );
-    smpi->patch_refHindexes[0] = 0;
-    for( int rk=1 ; rk<smpi->smilei_sz ; rk++ ) {
-        smpi->patch_refHindexes[rk] = smpi->patch_refHindexes[rk-1] + smpi->patch_count[rk-1];
     }
 
     // load window status : required to know the patch movement
@@ -564,6 +697,28 @@ void Checkpoint::readPatchDistribution( SmileiMPI *smpi, SimWindow *simWin )
 }
 
 
+// Each rank reads the files of the previous ranks rk, rk+size, rk+2*size, ... then all ranks share the result
+void Checkpoint::readPatchParticles( SmileiMPI *smpi, vector<double> &patch_particles )
+{
+    vector<double> local( patch_particles.size(), 0. );
+    for( unsigned int rk=smpi->getRank(); rk<restart_rank_files.size(); rk+=smpi->getSize() ) {
+        H5Read f( restart_rank_files[rk] );
+        unsigned int npatches = restart_refHindexes[rk+1] - restart_refHindexes[rk];
+        if( f.has( "patch_particles" ) ) {
+            vector<unsigned int> count( npatches );
+            f.vect( "patch_particles", count );
+            for( unsigned int ipatch=0; ipatch<npatches; ipatch++ ) {
+                local[restart_refHindexes[rk]+ipatch] = count[ipatch];
+            }
+        } else {
+            // Older dumps do not have the particle count: the patch loads only account for cells
+            WARNING( "No particle count in " << restart_rank_files[rk] );
+        }
+    }
+    MPI_Allreduce( &local[0], &patch_particles[0], local.size(), MPI_DOUBLE, MPI_SUM, smpi->world() );
+}
+
+
 void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI *smpi, SimWindow *simWin, Params &params, OpenPMDparams &openPMD )
 {
     MESSAGE( 1, "READING fields and particles for restart" );
@@ -583,7 +738,19 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI
     for( unsigned int j=0; j<2; j++ ) { //directions (xmin/xmax, ymin/ymax, zmin/zmax)
         for( unsigned int i=0; i<params.nDim_field; i++ ) { //axis 0=x, 1=y, 2=z
             string poy_name = Tools::merge( "Poy", Tools::xyz[i], j==0?"min":"max" );
-            if( f.hasAttr( poy_name ) ) {
+            if( restart_rank_files.size() > 0 ) {
+                // Sum those of the previous ranks rk, rk+size, rk+2*size, ...
+                double poy_sum = 0.;
+                for( unsigned int rk=smpi->getRank(); rk<restart_rank_files.size(); rk+=smpi->getSize() ) {
+                    H5Read r( restart_rank_files[rk] );
+                    if( r.hasAttr( poy_name ) ) {
+                        double poy_val = 0.;
+                        r.attr( poy_name, poy_val );
+                        poy_sum += poy_val;
+                    }
+                }
+                vecPatches( 0 )->EMfields->poynting[j][i] = poy_sum;
+            } else if( f.hasAttr( poy_name ) ) {
                 f.attr( poy_name, vecPatches( 0 )->EMfields->poynting[j][i] );
             }
             k++;
@@ -610,12 +777,27 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI
     }
 
     // Read all the patch data
+    // When the number of ranks changed, patches are streamed from the files of their previous owners
+    H5Read *patch_file = &f;
+    int patch_file_rank = -1;
     for( unsigned int ipatch=0 ; ipatch<vecPatches.size(); ipatch++ ) {
 
+        unsigned int hindex = vecPatches( ipatch )->Hindex();
+        if( restart_rank_files.size() > 0 ) {
+            int rk = upper_bound( restart_refHindexes.begin(), restart_refHindexes.end(), ( int )hindex ) - restart_refHindexes.begin() - 1;
+            if( rk != patch_file_rank ) {
+                if( patch_file != &f ) {
+                    delete patch_file;
+                }
+                patch_file = new H5Read( restart_rank_files[rk] );
+                patch_file_rank = rk;
+            }
+        }
+
         ostringstream patch_name( "" );
-        patch_name << setfill( '0' ) << setw( 6 ) << vecPatches( ipatch )->Hindex();
+        patch_name << setfill( '0' ) << setw( 6 ) << hindex;
         string patchName = Tools::merge( "patch-", patch_name.str() );
-        H5Read g = f.group( patchName );
+        H5Read g = patch_file->group( patchName );
 
         restartPatch( vecPatches( ipatch ), params, g );
 
@@ -623,6 +805,9 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI
         g.attr( "xorshift32_state", vecPatches( ipatch )->rand_->xorshift32_state );
 
     }
+    if( patch_file != &f ) {
+        delete patch_file;
+    }
 
     if (params.multiple_decomposition) {
         ostringstream patch_name( "" );
@@ -637,7 +822,10 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI
         if( DiagnosticTrack *track = dynamic_cast<DiagnosticTrack *>( vecPatches.localDiags[idiag] ) ) {
             ostringstream n( "" );
             n<< "latest_ID_" << vecPatches( 0 )->vecSpecies[track->speciesId_]->name_;
-            if( f.hasAttr( n.str() ) ) {
+            if( restart_rank_files.size() > 0 && smpi->getRank() >= ( int )restart_rank_files.size() ) {
+                // No previous rank had this rank's range of IDs
+                track->latest_Id = smpi->getRank() * 4294967296; // 2^32
+            } else if( f.hasAttr( n.str() ) ) {
                 f.attr( n.str(), track->latest_Id, H5T_NATIVE_UINT64 );
             } else {
                 track->IDs_done=false;
@@ -854,21 +1042,21 @@ void Checkpoint::restartPatch( Patch *patch, Params &params, H5Read &g )
             for( unsigned int i=0; i<spec->particles->Position.size(); i++ ) {
                 ostringstream namePos( "" );
                 namePos << "Position-" << i;
-                s.vect( namePos.str(), spec->particles->Position[i] );
+                s.vect( namePos.str(), spec->particles->Position[i][0], H5T_NATIVE_DOUBLE );
             }
 
             for( unsigned int i=0; i<spec->particles->Momentum.size(); i++ ) {
                 ostringstream namePos( "" );
                 namePos << "Momentum-" << i;
-                s.vect( namePos.str(), spec->particles->Momentum[i] );
+                s.vect( namePos.str(), spec->particles->Momentum[i][0], H5T_NATIVE_DOUBLE );
             }
 
-            s.vect( "Weight", spec->particles->Weight );
+            s.vect( "Weight", spec->particles->Weight[0], H5T_NATIVE_DOUBLE );
 
-            s.vect( "Charge", spec->particles->Charge );
+            s.vect( "Charge", spec->particles->Charge[0], H5T_NATIVE_SHORT );
 
             if( spec->particles->tracked ) {
-                s.vect( "Id", spec->particles->Id, H5T_NATIVE_UINT64 );
+                s.vect( "Id", spec->particles->Id[0], H5T_NATIVE_UINT64 );
             }
 
             if( params.vectorization_mode == "off" || params.vectorization_mode == "on" || params.cell_sorting ) {
@@ -9,6 +9,7 @@
 
 #include <string>
 #include <vector>
+#include <thread>
 
 #include <hdf5.h>
 #include <Tools.h>
@@ -38,13 +39,17 @@ class Checkpoint
 public:
     Checkpoint( Params &params, SmileiMPI *smpi );
     //! Destructor for Checkpoint
-    virtual ~Checkpoint() {};
+    virtual ~Checkpoint()
+    {
+        waitDump();
+    };
     
     //! Space dimension of a particle
     unsigned int nDim_particle;
     
     //! restart everything to file per processor
-    void readPatchDistribution( SmileiMPI *smpi, SimWindow *simWin );
+    //! if the dump was made with a different number of processors, patches are distributed again
+    void readPatchDistribution( SmileiMPI *smpi, SimWindow *simWin, Params &params );
     void readRegionDistribution( Region &region );
     void restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI *smpi, SimWindow *simWin, Params &params, OpenPMDparams &openPMD );
     void restartPatch( Patch *patch, Params &params, H5Read &g );
@@ -65,6 +70,9 @@ public:
     void dumpAll( VectorPatch &vecPatches, Region &region, unsigned int itime,  SmileiMPI *smpi, SimWindow *simWin, Params &params );
     void dumpPatch( Patch *patch, Params &params, H5Write &g );
     
+    //! wait until the background thread has written the last dump (asynchronous mode)
+    void waitDump();
+    
     //! incremental number of times we've done a dump
     unsigned int dump_number;
     
@@ -113,6 +121,15 @@ private:
     //! dump moving window parameters
     void dumpMovingWindow( H5Write &f, SimWindow *simWindow );
     
+    //! write the image i to its file (runs in the background thread)
+    void writeImage( unsigned int i );
+    
+    //! name of the dump file num_dump of a rank, when there are nranks ranks
+    std::string dumpFileName( unsigned int num_dump, int rank, int nranks, unsigned int grouping );
+    
+    //! number of particles in each patch (Hindex) of the dump, read in parallel from all dump files
+    void readPatchParticles( SmileiMPI *smpi, std::vector<double> &patch_particles );
+    
     //! function that returns elapsed time from creator (uses private var time_reference)
     //double time_seconds();
     
@@ -146,6 +163,33 @@ private:
     //! restart file
     std::string restart_file;
     
+    //! restart files of all the ranks of the previous run, if it had a different number of ranks (empty otherwise)
+    std::vector<std::string> restart_rank_files;
+    
+    //! first patch of each rank of the previous run (when restart_rank_files is not empty)
+    std::vector<int> restart_refHindexes;
+    
+    //! dumps are built in memory then written by a background thread (Checkpoints.asynchronous)
+    bool asynchronous;
+    
+    //! in-memory dump files: one may be written by writer while the other is filled
+    std::vector<char> images[2];
+    
+    //! file name of each image
+    std::string image_names[2];
+    
+    //! image filled by the next dump
+    unsigned int current_image;
+    
+    //! processes of the same file group, which write their images one after the other
+    MPI_Comm group_comm;
+    
+    //! background thread writing an image
+    std::thread writer;
+    
+    //! set by writer if the file could not be written
+    bool write_failed;
+    
 };
 
 #endif /* CHECKPOINT_H_ */
@@ -149,7 +149,7 @@ void CollisionalIonization::assignDatabase( unsigned int index )
 }
 
 // Method to apply the ionization
-void CollisionalIonization::apply( Patch *patch, Particles *p1, int i1, Particles *p2, int i2, double coeff )
+void CollisionalIonization::apply( Random *random, Particles *p1, int i1, Particles *p2, int i2, double coeff )
 {
     double gamma1 = p1->LorentzFactor( i1 );
     double gamma2 = p2->LorentzFactor( i2 );
@@ -159,8 +159,8 @@ void CollisionalIonization::apply( Patch *patch, Particles *p1, int i1, Particle
                      - p1->momentum( 1, i1 )*p2->momentum( 1, i2 )
                      - p1->momentum( 2, i1 )*p2->momentum( 2, i2 );
     // Random numbers
-    double U1  = patch->rand_->uniform();
-    double U2  = patch->rand_->uniform();
+    double U1  = random->uniform();
+    double U2  = random->uniform();
     // Calculate the rest of the stuff
     if( electronFirst ) {
         calculate( gamma_s, gamma1, gamma2, p1, i1, p2, i2, U1, U2, coeff );
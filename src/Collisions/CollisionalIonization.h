@@ -7,6 +7,7 @@
 #include "Tools.h"
 #include "Species.h"
 #include "Params.h"
+#include "Random.h"
 
 class Patch;
 
@@ -39,7 +40,7 @@ public:
         electronFirst = Z_firstgroup==0 ? true : false;
     };
     //! Method to apply the ionization
-    virtual void apply( Patch *patch, Particles *p1, int i1, Particles *p2, int i2, double coeff );
+    virtual void apply( Random *random, Particles *p1, int i1, Particles *p2, int i2, double coeff );
     //! Method to finish the ionization and put new electrons in place
     virtual void finish( Params &, Patch *, std::vector<Diagnostic *> & );
     
@@ -100,7 +101,7 @@ public:
     };
     void assignDatabase( unsigned int ) override {};
     
-    void apply( Patch *, Particles *, int, Particles *, int, double ) override {};
+    void apply( Random *, Particles *, int, Particles *, int, double ) override {};
     //void finish(Species*, Species*, Params&, Patch*) override {};
     void finish( Params &, Patch *, std::vector<Diagnostic *> & ) override {};
 };
@@ -25,6 +25,7 @@ CollisionalNuclearReaction::CollisionalNuclearReaction(
         auto_multiplier_ = false;
         rate_multiplier_ = rate_multiplier;
     }
+    tot_probability_ = 0.;
     product_particles_.resize(0);
     product_species_.resize(0);
     if( params ) {
@@ -44,6 +45,7 @@ CollisionalNuclearReaction::CollisionalNuclearReaction( CollisionalNuclearReacti
     product_species_ = CNR->product_species_;
     rate_multiplier_ = CNR->rate_multiplier_;
     auto_multiplier_ = CNR->auto_multiplier_;
+    tot_probability_ = 0.;
     product_particles_.resize( CNR->product_particles_.size(), NULL );
     for( unsigned int i=0; i<CNR->product_particles_.size(); i++ ) {
         product_particles_[i] = new Particles();
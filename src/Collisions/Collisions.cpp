@@ -5,6 +5,8 @@
 #include <ostream>
 #include <fstream>
 
+#include <omp.h>
+
 #include "Collisions.h"
 #include "SmileiMPI.h"
 #include "Field2D.h"
@@ -25,6 +27,7 @@ Collisions::Collisions(
     double coulomb_log_factor,
     bool intra_collisions,
     int debug_every,
+    unsigned int batch_size,
     CollisionalIonization *ionization,
     CollisionalNuclearReaction *nuclear_reaction,
     string filename
@@ -38,6 +41,7 @@ Collisions::Collisions(
     coulomb_log_factor_( coulomb_log_factor ),
     intra_collisions_( intra_collisions ),
     debug_every_( debug_every ),
+    batch_size_( batch_size ),
     filename_( filename )
 {
     coeff1_ = 4.046650232e-21*params.reference_angular_frequency_SI; // h*omega/(2*me*c^2)
@@ -62,6 +66,7 @@ Collisions::Collisions( Collisions *coll )
     coulomb_log_factor_ = coll->coulomb_log_factor_;
     intra_collisions_   = coll->intra_collisions_  ;
     debug_every_        = coll->debug_every_       ;
+    batch_size_         = coll->batch_size_        ;
     filename_           = coll->filename_          ;
     coeff1_             = coll->coeff1_            ;
     coeff2_             = coll->coeff2_            ;
@@ -86,6 +91,9 @@ Collisions::~Collisions()
 {
     delete Ionization;
     delete NuclearReaction;
+    for( unsigned int i=0; i<threads_.size(); i++ ) {
+        delete threads_[i];
+    }
 }
 
 // Declare other static variables here
@@ -179,24 +187,11 @@ void Collisions::calculate_debye_length( Params &params, Patch *patch )
 // Calculates the collisions for a given Collisions object
 void Collisions::collide( Params &params, Patch *patch, int itime, vector<Diagnostic *> &localDiags )
 {
-
-    vector<unsigned int> *sg1, *sg2, index1, index2;
-    unsigned int nspec1, nspec2; // numbers of species in each group
-    unsigned int npart1, npart2; // numbers of macro-particles in each group
-    unsigned int npairs; // number of pairs of macro-particles
-    vector<unsigned int> np1, np2; // numbers of macro-particles in each species, in each group
-    unsigned int i1=0, i2, ispec1, ispec2, N2max;
-    Species   *s1, *s2;
-    Particles *p1=NULL, *p2;
-    double coeff3, coeff4, logL, s, ncol, debye2=0.;
-    
-    sg1 = &species_group1_;
-    sg2 = &species_group2_;
-    
+    double ncol = 0.;
+    bool swapped = false;
     
     bool debug = ( debug_every_ > 0 && itime % debug_every_ == 0 ); // debug only every N timesteps
     
-    ncol = 0.;
     smean_       = 0.;
     logLmean_    = 0.;
     //temperature = 0.;
@@ -206,174 +201,532 @@ void Collisions::collide( Params &params, Patch *patch, int itime, vector<Diagno
     // Loop bins of particles (typically, cells, but may also be clusters)
     unsigned int nbin = patch->vecSpecies[0]->particles->first_index.size();
     for( unsigned int ibin = 0 ; ibin < nbin ; ibin++ ) {
+        collideBin( params, patch, ibin, patch->rand_, debug, swapped, ncol );
+    }
     
-        // get number of particles for all necessary species
-        for( unsigned int i=0; i<2; i++ ) { // try twice to ensure group 1 has more macro-particles
-            nspec1 = sg1->size();
-            nspec2 = sg2->size();
-            np1.resize( nspec1 ); // number of particles in each species of group 1
-            np2.resize( nspec2 ); // number of particles in each species of group 2
-            npart1 = 0;
-            npart2 = 0;
-            for( ispec1=0 ; ispec1<nspec1 ; ispec1++ ) {
-                s1 = patch->vecSpecies[( *sg1 )[ispec1]];
-                np1[ispec1] = s1->particles->last_index[ibin] - s1->particles->first_index[ibin];
-                npart1 += np1[ispec1];
-            }
-            for( ispec2=0 ; ispec2<nspec2 ; ispec2++ ) {
-                s2 = patch->vecSpecies[( *sg2 )[ispec2]];
-                np2[ispec2] = s2->particles->last_index[ibin] - s2->particles->first_index[ibin];
-                npart2 += np2[ispec2];
-            }
-            if( npart2 <= npart1 ) {
-                break;    // ok if group1 has more macro-particles
-            } else { // otherwise, we exchange groups and try again
-                swap( sg1, sg2 );
-            }
+    Ionization->finish( params, patch, localDiags );
+    NuclearReaction->finish( params, patch, localDiags, intra_collisions_, species_group1_, species_group2_, ncol, itime );
+    
+    if( debug && ncol>0. ) {
+        smean_    /= ncol;
+        logLmean_ /= ncol;
+        //temperature /= ncol;
+    }
+}
+
+
+// Calculates the collisions for a given Collisions object, all threads of the team sharing the bins of the patch
+// Each thread works with its own copy of this object (scratch arrays, buffers of new particles) and its own random stream.
+// The bins are split statically in contiguous chunks, so that the new particles, collected in the order of the threads,
+// are in the order of the bins. With Main.reproducible_collisions, each bin has its own random stream,
+// so that the results do not depend on the number of threads.
+void Collisions::collideThreads( Params &params, Patch *patch, int itime, vector<Diagnostic *> &localDiags )
+{
+#ifdef _OPENMP
+    unsigned int ithread = omp_get_thread_num();
+    unsigned int nthread = omp_get_num_threads();
+#else
+    unsigned int ithread = 0;
+    unsigned int nthread = 1;
+#endif
+    
+    bool debug = ( debug_every_ > 0 && itime % debug_every_ == 0 ); // debug only every N timesteps
+    unsigned int nbin = patch->vecSpecies[0]->particles->first_index.size();
+    
+    #pragma omp single
+    {
+        while( threads_.size() < nthread ) {
+            threads_.push_back( new Collisions( this ) );
         }
-        // now group1 has more macro-particles than group2
-        
-        // skip to next bin if no particles
-        if( npart1==0 || npart2==0 ) {
-            continue;
+        threads_seed_ = patch->rand_->integer();
+        bin_ncol_       .assign( nbin, 0. );
+        bin_smean_      .assign( nbin, 0. );
+        bin_logLmean_   .assign( nbin, 0. );
+        bin_probability_.assign( nbin, 0. );
+    }
+    
+    Collisions *thread = threads_[ithread];
+    thread->NuclearReaction->rate_multiplier_ = NuclearReaction->rate_multiplier_;
+    Random random( threads_seed_, ithread );
+    
+    #pragma omp for schedule(static)
+    for( unsigned int ibin = 0 ; ibin < nbin ; ibin++ ) {
+        if( params.reproducible_collisions ) {
+            random.reseed( threads_seed_, ibin );
         }
-        
-        // Set the debye length
-        if( Collisions::debye_length_required ) {
-            debye2 = patch->debye_length_squared[ibin];
+        bool swapped = false;
+        thread->smean_    = 0.;
+        thread->logLmean_ = 0.;
+        thread->NuclearReaction->prepare();
+        thread->collideBin( params, patch, ibin, &random, debug, swapped, bin_ncol_[ibin] );
+        bin_smean_      [ibin] = thread->smean_;
+        bin_logLmean_   [ibin] = thread->logLmean_;
+        bin_probability_[ibin] = thread->NuclearReaction->tot_probability_;
+    }
+    
+    #pragma omp single
+    {
+        // Sum over bins in a fixed order
+        double ncol = 0.;
+        smean_    = 0.;
+        logLmean_ = 0.;
+        NuclearReaction->prepare();
+        for( unsigned int ibin = 0 ; ibin < nbin ; ibin++ ) {
+            ncol      += bin_ncol_    [ibin];
+            smean_    += bin_smean_   [ibin];
+            logLmean_ += bin_logLmean_[ibin];
+            NuclearReaction->tot_probability_ += bin_probability_[ibin];
         }
         
-        // Shuffle particles to have random pairs
-        //    (It does not really exchange them, it is just a temporary re-indexing)
-        index1.resize( npart1 );
-        for( unsigned int i=0; i<npart1; i++ ) {
-            index1[i] = i;    // first, we make an ordered array
-        }
-        // shuffle the index array
-        for( unsigned int i=npart1; i>1; i-- ) {
-            unsigned int p = patch->rand_->integer() % i;
-            swap( index1[i-1], index1[p] );
-        }
-        if( intra_collisions_ ) { // In the case of collisions within one species
-            if( npart1 < 2 ) {
-                continue;
-            }
-            npairs = ( npart1 + 1 ) / 2; // half as many pairs as macro-particles
-            index2.resize( npairs );
-            for( unsigned int i=0; i<npairs; i++ ) {
-                index2[i] = index1[( i+npairs )%npart1];    // index2 is second half
+        // Gather the new particles of all threads
+        for( unsigned int i = 0 ; i < nthread ; i++ ) {
+            Particles &electrons = threads_[i]->Ionization->new_electrons;
+            electrons.copyParticles( 0, electrons.size(), Ionization->new_electrons, Ionization->new_electrons.size() );
+            electrons.clear();
+            for( unsigned int iprod = 0 ; iprod < NuclearReaction->product_particles_.size() ; iprod++ ) {
+                Particles *products = threads_[i]->NuclearReaction->product_particles_[iprod];
+                products->copyParticles( 0, products->size(), *NuclearReaction->product_particles_[iprod], NuclearReaction->product_particles_[iprod]->size() );
+                products->clear();
             }
-            index1.resize( npairs ); // index1 is first half
-            N2max = npart1 - npairs; // number of not-repeated particles (in group 2 only)
-        } else { // In the case of collisions between two species
-            npairs = npart1; // as many pairs as macro-particles in group 1 (most numerous)
-            index2.resize( npairs );
-            for( unsigned int i=0; i<npart1; i++ ) {
-                index2[i] = i % npart2;
-            }
-            N2max = npart2; // number of not-repeated particles (in group 2 only)
         }
         
-        // Prepare the ionization
-        Ionization->prepare1( patch->vecSpecies[( *sg1 )[0]]->atomic_number_ );
+        Ionization->finish( params, patch, localDiags );
+        NuclearReaction->finish( params, patch, localDiags, intra_collisions_, species_group1_, species_group2_, ncol, itime );
         
-        // Calculate the densities
-        double n1  = 0.; // density of group 1
+        if( debug && ncol>0. ) {
+            smean_    /= ncol;
+            logLmean_ /= ncol;
+        }
+    }
+}
+
+
+// Collide the pairs of particles in one bin
+//   swapped tells if the groups of species were exchanged in the previous bin (group 2 had more macro-particles)
+void Collisions::collideBin( Params &params, Patch *patch, unsigned int ibin, Random *random, bool debug, bool &swapped, double &ncol )
+{
+    vector<unsigned int> *sg1, *sg2, &index1 = index1_, &index2 = index2_;
+    unsigned int nspec1, nspec2; // numbers of species in each group
+    unsigned int npart1, npart2; // numbers of macro-particles in each group
+    unsigned int npairs; // number of pairs of macro-particles
+    vector<unsigned int> &np1 = np1_, &np2 = np2_; // numbers of macro-particles in each species, in each group
+    unsigned int i1=0, i2, ispec1, ispec2, N2max;
+    Species   *s1, *s2;
+    Particles *p1=NULL, *p2;
+    double coeff3, coeff4, logL, s, debye2=0.;
+    
+    sg1 = swapped ? &species_group2_ : &species_group1_;
+    sg2 = swapped ? &species_group1_ : &species_group2_;
+    
+    // get number of particles for all necessary species
+    for( unsigned int i=0; i<2; i++ ) { // try twice to ensure group 1 has more macro-particles
+        nspec1 = sg1->size();
+        nspec2 = sg2->size();
+        np1.resize( nspec1 ); // number of particles in each species of group 1
+        np2.resize( nspec2 ); // number of particles in each species of group 2
+        npart1 = 0;
+        npart2 = 0;
         for( ispec1=0 ; ispec1<nspec1 ; ispec1++ ) {
             s1 = patch->vecSpecies[( *sg1 )[ispec1]];
-            p1 = s1->particles;
-            for( int i = p1->first_index[ibin]; i < p1->last_index[ibin]; i++ ) {
-                n1 += p1->weight( i );
-            }
+            np1[ispec1] = s1->particles->last_index[ibin] - s1->particles->first_index[ibin];
+            npart1 += np1[ispec1];
         }
-        double n2  = 0.; // density of group 2
         for( ispec2=0 ; ispec2<nspec2 ; ispec2++ ) {
             s2 = patch->vecSpecies[( *sg2 )[ispec2]];
-            p2 = s2->particles;
-            for( int i = p2->first_index[ibin]; i < p2->last_index[ibin]; i++ ) {
-                n2 += p2->weight( i );
+            np2[ispec2] = s2->particles->last_index[ibin] - s2->particles->first_index[ibin];
+            npart2 += np2[ispec2];
+        }
+        if( npart2 <= npart1 ) {
+            break;    // ok if group1 has more macro-particles
+        } else { // otherwise, we exchange groups and try again
+            swap( sg1, sg2 );
+        }
+    }
+    swapped = ( sg1 == &species_group2_ );
+    // now group1 has more macro-particles than group2
+    
+    // skip if no particles
+    if( npart1==0 || npart2==0 ) {
+        return;
+    }
+    
+    // Set the debye length
+    if( Collisions::debye_length_required ) {
+        debye2 = patch->debye_length_squared[ibin];
+    }
+    
+    // Shuffle particles to have random pairs
+    //    (It does not really exchange them, it is just a temporary re-indexing)
+    index1.resize( npart1 );
+    for( unsigned int i=0; i<npart1; i++ ) {
+        index1[i] = i;    // first, we make an ordered array
+    }
+    // shuffle the index array
+    for( unsigned int i=npart1; i>1; i-- ) {
+        unsigned int p = random->integer() % i;
+        swap( index1[i-1], index1[p] );
+    }
+    if( intra_collisions_ ) { // In the case of collisions within one species
+        if( npart1 < 2 ) {
+            return;
+        }
+        npairs = ( npart1 + 1 ) / 2; // half as many pairs as macro-particles
+        index2.resize( npairs );
+        for( unsigned int i=0; i<npairs; i++ ) {
+            index2[i] = index1[( i+npairs )%npart1];    // index2 is second half
+        }
+        index1.resize( npairs ); // index1 is first half
+        N2max = npart1 - npairs; // number of not-repeated particles (in group 2 only)
+    } else { // In the case of collisions between two species
+        npairs = npart1; // as many pairs as macro-particles in group 1 (most numerous)
+        index2.resize( npairs );
+        for( unsigned int i=0; i<npart1; i++ ) {
+            index2[i] = i % npart2;
+        }
+        N2max = npart2; // number of not-repeated particles (in group 2 only)
+    }
+    
+    // Prepare the ionization
+    Ionization->prepare1( patch->vecSpecies[( *sg1 )[0]]->atomic_number_ );
+    
+    // Calculate the densities
+    double n1  = 0.; // density of group 1
+    for( ispec1=0 ; ispec1<nspec1 ; ispec1++ ) {
+        s1 = patch->vecSpecies[( *sg1 )[ispec1]];
+        p1 = s1->particles;
+        for( int i = p1->first_index[ibin]; i < p1->last_index[ibin]; i++ ) {
+            n1 += p1->weight( i );
+        }
+    }
+    double n2  = 0.; // density of group 2
+    for( ispec2=0 ; ispec2<nspec2 ; ispec2++ ) {
+        s2 = patch->vecSpecies[( *sg2 )[ispec2]];
+        p2 = s2->particles;
+        for( int i = p2->first_index[ibin]; i < p2->last_index[ibin]; i++ ) {
+            n2 += p2->weight( i );
+        }
+    }
+    
+    // Get cell volume
+    ispec1 = -1;
+    do {
+        ispec1++;
+        p1 = patch->vecSpecies[( *sg1 )[ispec1]]->particles;
+    } while( ispec1<nspec1 && p1->first_index[ibin] == p1->last_index[ibin] );
+    double inv_cell_volume = 1./patch->getPrimalCellVolume( p1, p1->first_index[ibin], params );
+    
+    // Pre-calculate some numbers before the big loop
+    unsigned int ncorr = intra_collisions_ ? 2*npairs-1 : npairs;
+    double dt_corr = params.timestep * ((double)ncorr) * inv_cell_volume;
+    coeff3 = coeff2_ * dt_corr * coulomb_log_factor_;
+    coeff4 = pow( 3.*coeff2_, -1./3. ) * dt_corr;
+    double weight_correction_1 = 1. / (double)( (npairs-1) / N2max );
+    double weight_correction_2 = 1. / (double)( (npairs-1) / N2max + 1 );
+    n1  *= inv_cell_volume;
+    n2  *= inv_cell_volume;
+    double n123 = pow( n1, 2./3. );
+    double n223 = pow( n2, 2./3. );
+    
+    // Batched collisions : the pairs are gathered by batches of consecutive pairs
+    // A batch must not contain the same particle twice, as its pairs are collided simultaneously
+    // ----------------------------------------------------
+    if( batch_size_ > 0 ) {
+        unsigned int max_batch = batch_size_;
+        if( intra_collisions_ ) {
+            if( npart1 % 2 == 1 ) { // the last pair contains the first particle of the first pair
+                max_batch = std::min( max_batch, std::max( npairs-1, 1u ) );
             }
+        } else { // particles of group 2 are repeated every N2max pairs
+            max_batch = std::min( max_batch, N2max );
         }
+        batch_.resize( max_batch );
         
-        // Get cell volume
-        ispec1 = -1;
-        do {
-            ispec1++;
-            p1 = patch->vecSpecies[( *sg1 )[ispec1]]->particles;
-        } while( ispec1<nspec1 && p1->first_index[ibin] == p1->last_index[ibin] );
-        double inv_cell_volume = 1./patch->getPrimalCellVolume( p1, p1->first_index[ibin], params );
-        
-        // Pre-calculate some numbers before the big loop
-        unsigned int ncorr = intra_collisions_ ? 2*npairs-1 : npairs;
-        double dt_corr = params.timestep * ((double)ncorr) * inv_cell_volume;
-        coeff3 = coeff2_ * dt_corr * coulomb_log_factor_;
-        coeff4 = pow( 3.*coeff2_, -1./3. ) * dt_corr;
-        double weight_correction_1 = 1. / (double)( (npairs-1) / N2max );
-        double weight_correction_2 = 1. / (double)( (npairs-1) / N2max + 1 );
-        n1  *= inv_cell_volume;
-        n2  *= inv_cell_volume;
-        double n123 = pow( n1, 2./3. );
-        double n223 = pow( n2, 2./3. );
-        
-        // Now start the real loop on pairs of particles
-        // See equations in http://dx.doi.org/10.1063/1.4742167
-        // ----------------------------------------------------
-        for( unsigned int i = 0; i<npairs; i++ ) {
-            
-            // find species and index i1 of particle "1"
-            i1 = index1[i];
-            for( ispec1=0 ; i1>=np1[ispec1]; ispec1++ ) {
-                i1 -= np1[ispec1];
-            }
-            // find species and index i2 of particle "2"
-            i2 = index2[i];
-            for( ispec2=0 ; i2>=np2[ispec2]; ispec2++ ) {
-                i2 -= np2[ispec2];
-            }
+        for( unsigned int start = 0; start<npairs; start += max_batch ) {
+            unsigned int n = std::min( max_batch, npairs-start );
             
-            s1 = patch->vecSpecies[( *sg1 )[ispec1]];
-            s2 = patch->vecSpecies[( *sg2 )[ispec2]];
-            i1 += s1->particles->first_index[ibin];
-            i2 += s2->particles->first_index[ibin];
-            p1 = s1->particles;
-            p2 = s2->particles;
-            
-            double weight_correction = std::max( p1->weight(i1), p2->weight(i2) );
-            if( i % N2max <= (npairs-1) % N2max ) {
-                weight_correction *= weight_correction_2 ;
-            } else {
-                weight_correction *= weight_correction_1;
+            // Gather the pairs
+            for( unsigned int k = 0; k<n; k++ ) {
+                unsigned int i = start + k;
+                i1 = index1[i];
+                for( ispec1=0 ; i1>=np1[ispec1]; ispec1++ ) {
+                    i1 -= np1[ispec1];
+                }
+                i2 = index2[i];
+                for( ispec2=0 ; i2>=np2[ispec2]; ispec2++ ) {
+                    i2 -= np2[ispec2];
+                }
+                s1 = patch->vecSpecies[( *sg1 )[ispec1]];
+                s2 = patch->vecSpecies[( *sg2 )[ispec2]];
+                i1 += s1->particles->first_index[ibin];
+                i2 += s2->particles->first_index[ibin];
+                p1 = s1->particles;
+                p2 = s2->particles;
+                
+                double weight_correction = std::max( p1->weight(i1), p2->weight(i2) );
+                if( i % N2max <= (npairs-1) % N2max ) {
+                    weight_correction *= weight_correction_2 ;
+                } else {
+                    weight_correction *= weight_correction_1;
+                }
+                
+                batch_.p1[k] = p1;
+                batch_.i1[k] = i1;
+                batch_.p2[k] = p2;
+                batch_.i2[k] = i2;
+                batch_.m1[k] = s1->mass_;
+                batch_.m2[k] = s2->mass_;
+                batch_.coeff3[k]  = coeff3*weight_correction;
+                batch_.coeff4[k]  = coeff4*weight_correction;
+                batch_.dt_corr[k] = dt_corr*weight_correction;
             }
             
-            logL = coulomb_log_;
-            
-            s = one_collision( p1, i1, s1->mass_, p2, i2, s2->mass_, coeff1_, coeff3*weight_correction, coeff4*weight_correction, n123, n223, debye2, logL, patch->rand_ );
+            collideBatch( random, n, n123, n223, debye2 );
             
             // Handle ionization
-            Ionization->apply( patch, p1, i1, p2, i2, dt_corr*weight_correction );
+            for( unsigned int k = 0; k<n; k++ ) {
+                Ionization->apply( random, batch_.p1[k], batch_.i1[k], batch_.p2[k], batch_.i2[k], batch_.dt_corr[k] );
+            }
             
-            ncol ++;
+            ncol += n;
             if( debug ) {
-                smean_    += s;
-                logLmean_ += logL;
-                //temperature += m1 * (sqrt(1.+pow(p1->momentum(0,i1),2)+pow(p1->momentum(1,i1),2)+pow(p1->momentum(2,i1),2))-1.);
+                for( unsigned int k = 0; k<n; k++ ) {
+                    smean_    += batch_.s[k];
+                    logLmean_ += batch_.logL[k];
+                }
             }
-            
-        } // end loop on pairs of particles
+        }
+        return;
+    }
+    
+    // Now start the real loop on pairs of particles
+    // See equations in http://dx.doi.org/10.1063/1.4742167
+    // ----------------------------------------------------
+    for( unsigned int i = 0; i<npairs; i++ ) {
+        
+        // find species and index i1 of particle "1"
+        i1 = index1[i];
+        for( ispec1=0 ; i1>=np1[ispec1]; ispec1++ ) {
+            i1 -= np1[ispec1];
+        }
+        // find species and index i2 of particle "2"
+        i2 = index2[i];
+        for( ispec2=0 ; i2>=np2[ispec2]; ispec2++ ) {
+            i2 -= np2[ispec2];
+        }
         
-    } // end loop on bins
+        s1 = patch->vecSpecies[( *sg1 )[ispec1]];
+        s2 = patch->vecSpecies[( *sg2 )[ispec2]];
+        i1 += s1->particles->first_index[ibin];
+        i2 += s2->particles->first_index[ibin];
+        p1 = s1->particles;
+        p2 = s2->particles;
+        
+        double weight_correction = std::max( p1->weight(i1), p2->weight(i2) );
+        if( i % N2max <= (npairs-1) % N2max ) {
+            weight_correction *= weight_correction_2 ;
+        } else {
+            weight_correction *= weight_correction_1;
+        }
+        
+        logL = coulomb_log_;
+        
+        s = one_collision( p1, i1, s1->mass_, p2, i2, s2->mass_, coeff1_, coeff3*weight_correction, coeff4*weight_correction, n123, n223, debye2, logL, random );
+        
+        // Handle ionization
+        Ionization->apply( random, p1, i1, p2, i2, dt_corr*weight_correction );
+        
+        ncol ++;
+        if( debug ) {
+            smean_    += s;
+            logLmean_ += logL;
+            //temperature += m1 * (sqrt(1.+pow(p1->momentum(0,i1),2)+pow(p1->momentum(1,i1),2)+pow(p1->momentum(2,i1),2))-1.);
+        }
+        
+    } // end loop on pairs of particles
+}
+
+
+
+// Collide the n pairs gathered in batch_
+// Same equations as one_collision, but each step is a loop over the pairs of the batch,
+// working on contiguous arrays so that the compiler can vectorize it.
+// The random numbers are drawn in the same order as one_collision, except when nuclear reactions occur.
+void Collisions::collideBatch( Random *random, unsigned int n, double n123, double n223, double debye2 )
+{
+    CollisionsBatch &b = batch_;
     
-    Ionization->finish( params, patch, localDiags );
-    NuclearReaction->finish( params, patch, localDiags, intra_collisions_, species_group1_, species_group2_, ncol, itime );
+    // Gather weights, charges and momenta, and draw the random numbers
+    for( unsigned int k = 0; k<n; k++ ) {
+        Particles *p1 = b.p1[k], *p2 = b.p2[k];
+        unsigned int i1 = b.i1[k], i2 = b.i2[k];
+        b.w1[k]   = p1->weight( i1 );
+        b.w2[k]   = p2->weight( i2 );
+        b.q1q2[k] = p1->charge( i1 ) * p2->charge( i2 );
+        b.px1[k]  = p1->momentum( 0, i1 );
+        b.py1[k]  = p1->momentum( 1, i1 );
+        b.pz1[k]  = p1->momentum( 2, i1 );
+        b.px2[k]  = p2->momentum( 0, i2 );
+        b.py2[k]  = p2->momentum( 1, i2 );
+        b.pz2[k]  = p2->momentum( 2, i2 );
+        // If one weight is zero, then skip. Can happen after nuclear reaction
+        b.skip[k] = std::min( b.w1[k], b.w2[k] ) <= 0.;
+        if( ! b.skip[k] ) {
+            b.U_nuclear[k] = random->uniform();
+            b.U1[k]        = random->uniform();
+            b.phi[k]       = random->uniform_2pi();
+            b.U2[k]        = random->uniform();
+        }
+    }
     
-    if( debug && ncol>0. ) {
-        smean_    /= ncol;
-        logLmean_ /= ncol;
-        //temperature /= ncol;
+    double *m1 = b.m1.data(), *m2 = b.m2.data(), *q1q2 = b.q1q2.data();
+    double *px1 = b.px1.data(), *py1 = b.py1.data(), *pz1 = b.pz1.data();
+    double *px2 = b.px2.data(), *py2 = b.py2.data(), *pz2 = b.pz2.data();
+    double *coeff3 = b.coeff3.data(), *coeff4 = b.coeff4.data();
+    double *U1 = b.U1.data(), *phi = b.phi.data();
+    double *gamma1 = b.gamma1.data(), *gamma2 = b.gamma2.data();
+    double *COM_vx = b.COM_vx.data(), *COM_vy = b.COM_vy.data(), *COM_vz = b.COM_vz.data();
+    double *COM_gamma = b.COM_gamma.data(), *term1 = b.term1.data();
+    double *gamma1_COM = b.gamma1_COM.data(), *gamma2_COM = b.gamma2_COM.data();
+    double *px_COM = b.px_COM.data(), *py_COM = b.py_COM.data(), *pz_COM = b.pz_COM.data(), *p_COM = b.p_COM.data();
+    double *term3 = b.term3.data(), *term5 = b.term5.data(), *vrel = b.vrel.data();
+    double *s = b.s.data(), *logL = b.logL.data();
+    
+    // Calculate the center-of-mass (COM) frame, and the momentum of particle 1 in this frame
+    #pragma omp simd
+    for( unsigned int k = 0; k<n; k++ ) {
+        double m12 = m1[k] / m2[k];
+        gamma1[k] = sqrt( 1. + px1[k]*px1[k] + py1[k]*py1[k] + pz1[k]*pz1[k] );
+        gamma2[k] = sqrt( 1. + px2[k]*px2[k] + py2[k]*py2[k] + pz2[k]*pz2[k] );
+        double gamma12_inv = 1./( m12 * gamma1[k] + gamma2[k] );
+        double vx = ( m12 * px1[k] + px2[k] ) * gamma12_inv;
+        double vy = ( m12 * py1[k] + py2[k] ) * gamma12_inv;
+        double vz = ( m12 * pz1[k] + pz2[k] ) * gamma12_inv;
+        double COM_vsquare = vx*vx + vy*vy + vz*vz;
+        bool small = COM_vsquare < 1e-6;
+        double vcv1g1 = vx*px1[k] + vy*py1[k] + vz*pz1[k];
+        double vcv2g2 = vx*px2[k] + vy*py2[k] + vz*pz2[k];
+        double g = small ? 1. + 0.5 * COM_vsquare : 1./sqrt( 1.-COM_vsquare );
+        double g1 = small ? gamma1[k] * g : ( gamma1[k]-vcv1g1 )*g;
+        double g2 = small ? gamma2[k] * g : ( gamma2[k]-vcv2g2 )*g;
+        double t1 = small ? 0.5 : ( g - 1. ) / COM_vsquare;
+        double t2 = small ? -g1 : t1*vcv1g1 - g * gamma1[k];
+        px_COM[k] = px1[k] + t2*vx;
+        py_COM[k] = py1[k] + t2*vy;
+        pz_COM[k] = pz1[k] + t2*vz;
+        double p2_COM = px_COM[k]*px_COM[k] + py_COM[k]*py_COM[k] + pz_COM[k]*pz_COM[k];
+        p_COM[k] = sqrt( p2_COM );
+        term3[k] = g * gamma12_inv;
+        double term4 = g1 * g2;
+        term5[k] = term4/p2_COM + m12;
+        vrel[k] = p_COM[k]/term3[k]/term4; // relative velocity
+        COM_vx[k] = vx;
+        COM_vy[k] = vy;
+        COM_vz[k] = vz;
+        COM_gamma[k] = g;
+        gamma1_COM[k] = g1;
+        gamma2_COM[k] = g2;
+        term1[k] = t1;
+    }
+    
+    // Nuclear reactions, one pair at a time as they create particles
+    for( unsigned int k = 0; k<n; k++ ) {
+        if( b.skip[k] ) {
+            continue;
+        }
+        double E, logE, minW = std::min( b.w1[k], b.w2[k] );
+        if( NuclearReaction->occurs( b.U_nuclear[k], vrel[k]*coeff3[k], m1[k], m2[k], gamma1_COM[k], gamma2_COM[k], E, logE, minW ) ) {
+            nuclearReactionProducts( b.p1[k], b.i1[k], b.p2[k], b.i2[k], minW, E, logE, px_COM[k], py_COM[k], pz_COM[k], p_COM[k], COM_vx[k], COM_vy[k], COM_vz[k], COM_gamma[k], term1[k], random );
+            b.w1[k] = b.p1[k]->weight( b.i1[k] );
+            b.w2[k] = b.p2[k]->weight( b.i2[k] );
+            b.skip[k] = b.w1[k] == 0. || b.w2[k] == 0.;
+        }
+    }
+    
+    // Calculate coulomb log if necessary
+    if( coulomb_log_ <= 0. ) { // if auto-calculation requested
+        double coeff1 = coeff1_;
+        #pragma omp simd
+        for( unsigned int k = 0; k<n; k++ ) {
+            double qqm = q1q2[k] / m1[k];
+            // Note : 0.00232282 is coeff2 / coeff1
+            double bmin = coeff1 * std::max( 1./m1[k]/p_COM[k], std::abs( 0.00232282*qqm*term3[k]*term5[k] ) ); // min impact parameter
+            double L = 0.5*log( 1.+debye2/( bmin*bmin ) );
+            logL[k] = L < 2. ? 2. : L;
+        }
+    } else {
+        for( unsigned int k = 0; k<n; k++ ) {
+            logL[k] = coulomb_log_;
+        }
+    }
+    
+    // Collision parameter, deflection, and new momenta (stored in place of the initial ones)
+    #pragma omp simd
+    for( unsigned int k = 0; k<n; k++ ) {
+        double m12 = m1[k] / m2[k];
+        double qqm = q1q2[k] / m1[k];
+        double qqm2 = qqm * qqm;
+        
+        // Calculate the collision parameter s12 (similar to number of real collisions)
+        double s12 = coeff3[k] * logL[k] * qqm2 * term3[k] * p_COM[k] * term5[k]*term5[k] / ( gamma1[k]*gamma2[k] );
+        
+        // Low-temperature correction
+        double smax = coeff4[k] * ( m12+1. ) * vrel[k] / std::max( m12*n123, n223 );
+        s12 = s12 > smax ? smax : s12;
+        s[k] = s12;
+        
+        // Pick the deflection angles in the center-of-mass frame (fit of one_collision)
+        double s2 = s12*s12;
+        double alpha = 0.37*s12 - 0.005*s2 - 0.0064*s2*s12;
+        double sin2X2 = alpha * U1[k] / sqrt( (1.-U1[k]) + alpha*alpha*U1[k] );
+        double cosX_iso = 2.*U1[k] - 1.;
+        double cosX = s12 < 4. ? 1. - 2.*sin2X2 : cosX_iso;
+        double sinX = s12 < 4. ? 2.*sqrt( sin2X2 *(1.-sin2X2) ) : sqrt( 1. - cosX_iso*cosX_iso );
+        
+        // Calculate combination of angles
+        double sinXcosPhi = sinX*cos( phi[k] );
+        double sinXsinPhi = sinX*sin( phi[k] );
+        
+        // Apply the deflection
+        double p_perp = sqrt( px_COM[k]*px_COM[k] + py_COM[k]*py_COM[k] );
+        double inv_p_perp = 1./p_perp;
+        bool tilted = p_perp > 1.e-10*p_COM[k]; // make sure p_perp is not too small
+        double newpx_COM = tilted ? ( px_COM[k] * pz_COM[k] * sinXcosPhi - py_COM[k] * p_COM[k] * sinXsinPhi ) * inv_p_perp + px_COM[k] * cosX : p_COM[k] * sinXcosPhi;
+        double newpy_COM = tilted ? ( py_COM[k] * pz_COM[k] * sinXcosPhi + px_COM[k] * p_COM[k] * sinXsinPhi ) * inv_p_perp + py_COM[k] * cosX : p_COM[k] * sinXsinPhi;
+        double newpz_COM = tilted ? -p_perp * sinXcosPhi  +  pz_COM[k] * cosX : p_COM[k] * cosX;
+        
+        // Go back to the lab frame
+        double vcp = COM_vx[k] * newpx_COM + COM_vy[k] * newpy_COM + COM_vz[k] * newpz_COM;
+        double term6 = term1[k]*vcp + gamma1_COM[k] * COM_gamma[k];
+        px1[k] = newpx_COM + COM_vx[k] * term6;
+        py1[k] = newpy_COM + COM_vy[k] * term6;
+        pz1[k] = newpz_COM + COM_vz[k] * term6;
+        term6 = -m12 * term1[k]*vcp + gamma2_COM[k] * COM_gamma[k];
+        px2[k] = -m12 * newpx_COM + COM_vx[k] * term6;
+        py2[k] = -m12 * newpy_COM + COM_vy[k] * term6;
+        pz2[k] = -m12 * newpz_COM + COM_vz[k] * term6;
+    }
+    
+    // Store the results in the particle arrays
+    for( unsigned int k = 0; k<n; k++ ) {
+        if( b.skip[k] ) {
+            s[k] = 0.;
+            logL[k] = coulomb_log_;
+            continue;
+        }
+        double U2 = b.U2[k];
+        if( U2 < b.w2[k]/b.w1[k] ) { // deflect particle 1 only with some probability
+            b.p1[k]->momentum( 0, b.i1[k] ) = px1[k];
+            b.p1[k]->momentum( 1, b.i1[k] ) = py1[k];
+            b.p1[k]->momentum( 2, b.i1[k] ) = pz1[k];
+        }
+        if( U2 < b.w1[k]/b.w2[k] ) { // deflect particle 2 only with some probability
+            b.p2[k]->momentum( 0, b.i2[k] ) = px2[k];
+            b.p2[k]->momentum( 1, b.i2[k] ) = py2[k];
+            b.p2[k]->momentum( 2, b.i2[k] ) = pz2[k];
+        }
     }
 }
 
-
 void Collisions::debug( Params &params, int itime, unsigned int icoll, VectorPatch &vecPatches )
 {
 
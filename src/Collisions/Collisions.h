@@ -9,6 +9,7 @@
 #include "CollisionalIonization.h"
 #include "CollisionalNuclearReaction.h"
 #include "CollisionalFusionDD.h"
+#include "CollisionsBatch.h"
 #include "Random.h"
 
 class Patch;
@@ -30,6 +31,7 @@ public:
         double coulomb_log_factor,
         bool intra_collisions,
         int debug_every,
+        unsigned int batch_size,
         CollisionalIonization *ionization,
         CollisionalNuclearReaction *nuclear_reaction,
         std::string
@@ -48,6 +50,9 @@ public:
     //! Method called in the main smilei loop to apply collisions at each timestep
     virtual void collide( Params &, Patch *, int, std::vector<Diagnostic *> & );
     
+    //! Same as collide, but the bins of the patch are shared between the threads (called by all threads of the team)
+    void collideThreads( Params &, Patch *, int, std::vector<Diagnostic *> & );
+    
     //! Outputs the debug info if requested
     static void debug( Params &params, int itime, unsigned int icoll, VectorPatch &vecPatches );
     
@@ -78,6 +83,24 @@ protected:
     //! Number of timesteps between each dump of collisions debugging
     int debug_every_;
     
+    //! Number of pairs collided together by collideBatch (0 for one pair at a time with one_collision)
+    unsigned int batch_size_;
+    
+    //! Scratch arrays of collideBin: shuffled indices of the particles, numbers of particles of each species
+    std::vector<unsigned int> index1_, index2_, np1_, np2_;
+    
+    //! Scratch arrays of collideBatch
+    CollisionsBatch batch_;
+    
+    //! Copies of this object used by each thread in collideThreads (own scratch arrays, ionization and nuclear reaction buffers)
+    std::vector<Collisions *> threads_;
+    
+    //! Seed of the random streams of collideThreads, drawn from the patch generator at each call
+    uint32_t threads_seed_;
+    
+    //! Number of pairs, sums of s and logL, and sum of nuclear reaction probabilities in each bin (collideThreads)
+    std::vector<double> bin_ncol_, bin_smean_, bin_logLmean_, bin_probability_;
+    
     //! Hdf5 file name
     std::string filename_;
     
@@ -87,6 +110,99 @@ protected:
     const double twoPi = 2. * 3.14159265358979323846;
     double coeff1_, coeff2_;
     
+    //! Collide the pairs of the bin ibin, adding their number to ncol, and their s and logL to smean_ and logLmean_
+    //! (swapped: the groups of species were exchanged in the previous bin)
+    void collideBin( Params &params, Patch *patch, unsigned int ibin, Random *random, bool debug, bool &swapped, double &ncol );
+    
+    //! Collide the n pairs gathered in batch_ (same physics as one_collision, the loops over pairs are vectorized)
+    void collideBatch( Random *random, unsigned int n, double n123, double n223, double debye2 );
+    
+    // Remove the weight minW from both particles of a pair, and create the products of the nuclear reaction
+    inline void nuclearReactionProducts(
+        Particles *p1,
+        unsigned int i1,
+        Particles *p2,
+        unsigned int i2,
+        double minW,
+        double E,
+        double logE,
+        double px_COM,
+        double py_COM,
+        double pz_COM,
+        double p_COM,
+        double COM_vx,
+        double COM_vy,
+        double COM_vz,
+        double COM_gamma,
+        double term1,
+        Random* random
+    )
+    {
+        // Reduce the weight of both reactants
+        // If becomes zero, then the particle will be discarded later
+        p1->weight(i1) -= minW;
+        p2->weight(i2) -= minW;
+        
+        // Get the magnitude and the angle of the outgoing products in the COM frame
+        std::vector<Particles*> particles;
+        std::vector<double> new_p_COM, sinX, cosX;
+        std::vector<short> q;
+        double tot_charge = p1->charge( i1 ) + p2->charge( i2 );
+        NuclearReaction->makeProducts( random, E, logE, tot_charge, particles, new_p_COM, q, sinX, cosX );
+        
+        // Calculate some quantities for rotating vectors
+        double phi = random->uniform_2pi();
+        double cosPhi = cos( phi );
+        double sinPhi = sin( phi );
+        double p_perp = sqrt( px_COM*px_COM + py_COM*py_COM );
+        // Prepare the deflection in the COM frame
+        double newpx_COM_0, newpy_COM_0, newpz_COM_0;
+        if( p_perp > 1.e-10*p_COM ) { // make sure p_perp is not too small
+            double inv_p_perp = 1./p_perp;
+            newpx_COM_0 = ( px_COM * pz_COM * cosPhi - py_COM * p_COM * sinPhi ) * inv_p_perp;
+            newpy_COM_0 = ( py_COM * pz_COM * cosPhi + px_COM * p_COM * sinPhi ) * inv_p_perp;
+            newpz_COM_0 = -p_perp * cosPhi;
+        } else { // if p_perp is too small, we use the limit px->0, py=0
+            newpx_COM_0 = p_COM * cosPhi;
+            newpy_COM_0 = p_COM * sinPhi;
+            newpz_COM_0 = 0.;
+        }
+        // Calculate new weights
+        double newW1, newW2;
+        if( p1->charge(i1) != 0. || p2->charge(i2) != 0. ) {
+            double weight_factor = minW / tot_charge;
+            newW1 = p1->charge( i1 ) * weight_factor;
+            newW2 = p2->charge( i2 ) * weight_factor;
+        } else {
+            newW1 = minW;
+            newW2 = 0.;
+        }
+        
+        // For each product
+        for( unsigned int iproduct=0; iproduct<particles.size(); iproduct++ ){
+            // Calculate the deflection in the COM frame
+            double newpx_COM = newpx_COM_0 * sinX[iproduct] + px_COM *cosX[iproduct];
+            double newpy_COM = newpy_COM_0 * sinX[iproduct] + py_COM *cosX[iproduct];
+            double newpz_COM = newpz_COM_0 * sinX[iproduct] + pz_COM *cosX[iproduct];
+            
+            // Go back to the lab frame and store the results in the particle array
+            double vcp = COM_vx * newpx_COM + COM_vy * newpy_COM + COM_vz * newpz_COM;
+            double momentum_ratio = new_p_COM[iproduct] / p_COM;
+            double term6 = momentum_ratio*term1*vcp + sqrt( new_p_COM[iproduct]*new_p_COM[iproduct] + 1. ) * COM_gamma;
+            double newpx = momentum_ratio * newpx_COM + COM_vx * term6;
+            double newpy = momentum_ratio * newpy_COM + COM_vy * term6;
+            double newpz = momentum_ratio * newpz_COM + COM_vz * term6;
+            // Make new particle at position of particle 1
+            if( newW1 > 0. ) {
+                particles[iproduct]->makeParticleAt( *p1, i1, newW1, q[iproduct], newpx, newpy, newpz );
+            }
+            // Make new particle at position of particle 2
+            if( newW2 > 0. ) {
+                particles[iproduct]->makeParticleAt( *p2, i2, newW2, q[iproduct], newpx, newpy, newpz );
+            }
+        }
+    }
+    
     // Collide one particle with another
     // See equations in http://dx.doi.org/10.1063/1.4742167
     inline double one_collision(
@@ -160,69 +276,7 @@ protected:
         // If succesful, then no need to do a collision
         double E, logE;
         if( NuclearReaction->occurs( random->uniform(), vrel*coeff3, m1, m2, gamma1_COM, gamma2_COM, E, logE, minW ) ) {
-            // Reduce the weight of both reactants
-            // If becomes zero, then the particle will be discarded later
-            p1->weight(i1) -= minW;
-            p2->weight(i2) -= minW;
-            
-            // Get the magnitude and the angle of the outgoing products in the COM frame
-            std::vector<Particles*> particles;
-            std::vector<double> new_p_COM, sinX, cosX;
-            std::vector<short> q;
-            double tot_charge = p1->charge( i1 ) + p2->charge( i2 );
-            NuclearReaction->makeProducts( random, E, logE, tot_charge, particles, new_p_COM, q, sinX, cosX );
-            
-            // Calculate some quantities for rotating vectors
-            double phi = random->uniform_2pi();
-            double cosPhi = cos( phi );
-            double sinPhi = sin( phi );
-            double p_perp = sqrt( px_COM*px_COM + py_COM*py_COM );
-            // Prepare the deflection in the COM frame
-            double newpx_COM_0, newpy_COM_0, newpz_COM_0;
-            if( p_perp > 1.e-10*p_COM ) { // make sure p_perp is not too small
-                double inv_p_perp = 1./p_perp;
-                newpx_COM_0 = ( px_COM * pz_COM * cosPhi - py_COM * p_COM * sinPhi ) * inv_p_perp;
-                newpy_COM_0 = ( py_COM * pz_COM * cosPhi + px_COM * p_COM * sinPhi ) * inv_p_perp;
-                newpz_COM_0 = -p_perp * cosPhi;
-            } else { // if p_perp is too small, we use the limit px->0, py=0
-                newpx_COM_0 = p_COM * cosPhi;
-                newpy_COM_0 = p_COM * sinPhi;
-                newpz_COM_0 = 0.;
-            }
-            // Calculate new weights
-            double newW1, newW2;
-            if( p1->charge(i1) != 0. || p2->charge(i2) != 0. ) {
-                double weight_factor = minW / tot_charge;
-                newW1 = p1->charge( i1 ) * weight_factor;
-                newW2 = p2->charge( i2 ) * weight_factor;
-            } else {
-                newW1 = minW;
-                newW2 = 0.;
-            }
-            
-            // For each product
-            for( unsigned int iproduct=0; iproduct<particles.size(); iproduct++ ){
-                // Calculate the deflection in the COM frame
-                double newpx_COM = newpx_COM_0 * sinX[iproduct] + px_COM *cosX[iproduct];
-                double newpy_COM = newpy_COM_0 * sinX[iproduct] + py_COM *cosX[iproduct];
-                double newpz_COM = newpz_COM_0 * sinX[iproduct] + pz_COM *cosX[iproduct];
-                
-                // Go back to the lab frame and store the results in the particle array
-                double vcp = COM_vx * newpx_COM + COM_vy * newpy_COM + COM_vz * newpz_COM;
-                double momentum_ratio = new_p_COM[iproduct] / p_COM;
-                double term6 = momentum_ratio*term1*vcp + sqrt( new_p_COM[iproduct]*new_p_COM[iproduct] + 1. ) * COM_gamma;
-                double newpx = momentum_ratio * newpx_COM + COM_vx * term6;
-                double newpy = momentum_ratio * newpy_COM + COM_vy * term6;
-                double newpz = momentum_ratio * newpz_COM + COM_vz * term6;
-                // Make new particle at position of particle 1
-                if( newW1 > 0. ) {
-                    particles[iproduct]->makeParticleAt( *p1, i1, newW1, q[iproduct], newpx, newpy, newpz );
-                }
-                // Make new particle at position of particle 2
-                if( newW2 > 0. ) {
-                    particles[iproduct]->makeParticleAt( *p2, i2, newW2, q[iproduct], newpx, newpy, newpz );
-                }
-            }
+            nuclearReactionProducts( p1, i1, p2, i2, minW, E, logE, px_COM, py_COM, pz_COM, p_COM, COM_vx, COM_vy, COM_vz, COM_gamma, term1, random );
             
             if( p1->weight(i1) == 0. || p2->weight(i2) == 0. ) {
                 return 0.; // no collision
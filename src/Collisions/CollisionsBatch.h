@@ -0,0 +1,58 @@
+#ifndef COLLISIONSBATCH_H
+#define COLLISIONSBATCH_H
+
+#include <vector>
+
+class Particles;
+
+//! Scratch arrays of Collisions::collideBatch : one value per pair of macro-particles of the batch (structure of arrays)
+class CollisionsBatch
+{
+public:
+    //! Particles and indices of both members of the pairs
+    std::vector<Particles *> p1, p2;
+    std::vector<unsigned int> i1, i2;
+
+    //! Masses, product of charges, weights and momenta
+    std::vector<double> m1, m2, q1q2, w1, w2;
+    std::vector<double> px1, py1, pz1, px2, py2, pz2;
+
+    //! Collision coefficients including the weight correction
+    std::vector<double> coeff3, coeff4, dt_corr;
+
+    //! Random numbers (nuclear reaction, deflection angle, azimuthal angle, choice of the deflected particles)
+    std::vector<double> U_nuclear, U1, phi, U2;
+
+    //! Quantities of the center-of-mass frame
+    std::vector<double> gamma1, gamma2, COM_vx, COM_vy, COM_vz, COM_gamma, term1, gamma1_COM, gamma2_COM;
+    std::vector<double> px_COM, py_COM, pz_COM, p_COM, term3, term5, vrel;
+
+    //! Collision parameter s12 and Coulomb logarithm
+    std::vector<double> s, logL;
+
+    //! Pairs without collision (null weight, possibly after a nuclear reaction)
+    std::vector<char> skip;
+
+    void resize( unsigned int n )
+    {
+        if( s.size() >= n ) {
+            return;
+        }
+        p1.resize( n );
+        p2.resize( n );
+        i1.resize( n );
+        i2.resize( n );
+        std::vector<double> *arrays[] = {
+            &m1, &m2, &q1q2, &w1, &w2, &px1, &py1, &pz1, &px2, &py2, &pz2,
+            &coeff3, &coeff4, &dt_corr, &U_nuclear, &U1, &phi, &U2,
+            &gamma1, &gamma2, &COM_vx, &COM_vy, &COM_vz, &COM_gamma, &term1, &gamma1_COM, &gamma2_COM,
+            &px_COM, &py_COM, &pz_COM, &p_COM, &term3, &term5, &vrel, &s, &logL
+        };
+        for( unsigned int i=0; i<sizeof( arrays )/sizeof( arrays[0] ); i++ ) {
+            arrays[i]->resize( n );
+        }
+        skip.resize( n );
+    }
+};
+
+#endif
@@ -78,6 +78,13 @@ public:
         debug_every = 0; // default
         PyTools::extract( "debug_every", debug_every, "Collisions", n_collisions );
         
+        // Number of pairs collided together (if 0, one pair at a time)
+        int batch_size = 0; // default
+        PyTools::extract( "batch_size", batch_size, "Collisions", n_collisions );
+        if( batch_size < 0 ) {
+            ERROR( "In collisions #" << n_collisions << ": batch_size must be positive or zero" );
+        }
+        
         // Collisional ionization
         Z = 0; // default
         PyObject * ionizing = PyTools::extract_py( "ionizing", "Collisions", n_collisions );
@@ -257,6 +264,9 @@ public:
         if( debug_every>0 ) {
             MESSAGE( 2, "Debug every " << debug_every << " timesteps" );
         }
+        if( batch_size>0 ) {
+            MESSAGE( 2, "Pairs collided by batches of " << batch_size );
+        }
         mystream.str( "" ); // clear
         if( ionization_electrons>0 ) {
             MESSAGE( 2, "Collisional ionization with atomic number "<<Z<<" towards species `"<<vecSpecies[ionization_electrons]->name_ << "`" );
@@ -305,6 +315,7 @@ public:
                        sgroup[1],
                        clog, clog_factor, intra,
                        debug_every,
+                       batch_size,
                        Ionization,
                        NuclearReaction,
                        filename
@@ -317,6 +328,7 @@ public:
         //                sgroup[1],
         //                clog, clog_factor, intra,
         //                debug_every,
+        //                batch_size,
         //                Ionization,
         //                NuclearReaction,
         //                filename
@@ -342,6 +354,9 @@ public:
         for( unsigned int n_collisions = 0; n_collisions < numcollisions; n_collisions++ ) {
             vecCollisions.push_back( create( params, patch, vecSpecies, n_collisions, debye_length_required ) );
         }
+        if( numcollisions > 0 && params.collisions_bin_threading ) {
+            MESSAGE( 1, "Cells of each patch shared between threads" << ( params.reproducible_collisions ? " (reproducible)" : "" ) );
+        }
         for( unsigned int n_collisions = 0; n_collisions < numcollisions; n_collisions++ ) {
             if( vecCollisions[ n_collisions ]->Ionization ) {
                 vecCollisions[ n_collisions ]->Ionization->assignDatabase( vecCollisions[ n_collisions ]->Ionization->dataBaseIndex );
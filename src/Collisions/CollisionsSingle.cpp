@@ -144,7 +144,7 @@ void CollisionsSingle::collide( Params &params, Patch *patch, int itime, vector<
             s = one_collision( p1, i1, s1->mass_, p2, i2, s2->mass_, coeff1_, coeff3*weight_correction, coeff4*weight_correction, n123, n223, debye2, logL, patch->rand_ );
             
             // Handle ionization
-            Ionization->apply( patch, p1, i1, p2, i2, dt_corr*weight_correction );
+            Ionization->apply( patch->rand_, p1, i1, p2, i2, dt_corr*weight_correction );
             
             ncol ++;
             if( debug ) {
@@ -27,6 +27,7 @@ public:
         double coulomb_log_factor,
         bool intra_collisions,
         int debug_every,
+        unsigned int batch_size,
         CollisionalIonization *ionization,
         CollisionalNuclearReaction *nuclear_reaction,
         std::string fname
@@ -39,6 +40,7 @@ public:
         coulomb_log_factor,
         intra_collisions,
         debug_every,
+        batch_size,
         ionization,
         nuclear_reaction,
         fname
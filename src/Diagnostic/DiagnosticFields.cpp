@@ -170,6 +170,20 @@ DiagnosticFields::DiagnosticFields( Params &params, SmileiMPI *smpi, VectorPatch
         ERROR( "Diagnostic Fields #"<<ndiag<<" has a time average too large compared to its time-selection interval ('every')" );
     }
     
+    // Extract the number of aggregators
+    aggregators = 0;
+    PyTools::extract( "aggregators", aggregators, "DiagFields", ndiag );
+    if( aggregators > 0 && params.geometry != "3Dcartesian" ) {
+        WARNING( "Diagnostic Fields #"<<ndiag<<": `aggregators` is only available in 3Dcartesian geometry" );
+        aggregators = 0;
+    }
+    if( aggregators > ( unsigned int )smpi->getSize() ) {
+        aggregators = smpi->getSize();
+    }
+    if( aggregators > 0 ) {
+        MESSAGE( 2, "Written by " << aggregators << " aggregators" );
+    }
+    
     // Extract the flush time selection
     flush_timeSelection = new TimeSelection( PyTools::extract_py( "flush_every", "DiagFields", ndiag ), "DiagFields flush_every" );
     
@@ -227,7 +241,8 @@ void DiagnosticFields::openFile( Params &params, SmileiMPI *smpi )
     }
     
     // Create file
-    file_ = new H5Write( filename, &smpi->world() );
+    // With aggregators, chunks are aligned on 1 MiB, the usual stripe size of parallel filesystems
+    file_ = new H5Write( filename, &smpi->world(), true, aggregators>0 ? 1<<20 : 0 );
     
     file_->attr( "name", diag_name_ );
     
@@ -101,6 +101,9 @@ protected :
     
     //! Save the field type (needed for OpenPMD units dimensionality)
     std::vector<unsigned int> field_type;
+    
+    //! Number of ranks gathering slabs of the grid before writing them (0 if each patch is written separately)
+    unsigned int aggregators;
 };
 
 #endif
@@ -4,6 +4,8 @@
 #include <sstream>
 #include <cmath>
 #include <limits>
+#include <algorithm>
+#include <cstring>
 
 #include "Params.h"
 #include "Patch.h"
@@ -44,10 +46,17 @@ DiagnosticFields3D::DiagnosticFields3D( Params &params, SmileiMPI *smpi, VectorP
     one_patch_buffer_size = nsteps[0] * nsteps[1] * nsteps[2];
     file_size = ( hsize_t )one_patch_buffer_size * ( hsize_t )tot_number_of_patches;
     
+    tmp_dset_ = NULL;
+    
     if( smpi->test_mode ) {
         return;
     }
     
+    if( aggregators > 0 ) {
+        initAggregators( params, smpi, vecPatches );
+        return;
+    }
+    
     // Define a second portion of the grid, which is unrelated to the current
     // composition of vecPatches. It is used for a second writing of the file
     // in order to fold the Hilbert curve. This new portion is necessarily
@@ -171,8 +180,6 @@ DiagnosticFields3D::DiagnosticFields3D( Params &params, SmileiMPI *smpi, VectorP
     // Define space in memory for re-writing
     memspace = new H5Space( block2 );
     data_rewrite.resize( rewrite_size[0]*rewrite_size[1]*rewrite_size[2] );
-    
-    tmp_dset_ = NULL;
 }
 
 DiagnosticFields3D::~DiagnosticFields3D()
@@ -180,6 +187,97 @@ DiagnosticFields3D::~DiagnosticFields3D()
 }
 
 
+// The grid is cut along x in slabs of slab_nx indices, each written by one aggregator in one chunk
+void DiagnosticFields3D::initAggregators( Params &params, SmileiMPI *smpi, VectorPatch &vecPatches )
+{
+    // Size of the dataset, taking the subgrid into account
+    unsigned int istart, istart_in_file;
+    total_dataset_size = 1;
+    for( unsigned int i=0; i<3; i++ ) {
+        findSubgridIntersection(
+            subgrid_start_[i], subgrid_stop_[i], subgrid_step_[i],
+            0, params.number_of_patches[i] * params.n_space[i] + 1,
+            istart, istart_in_file, dataset_size[i]
+        );
+        total_dataset_size *= dataset_size[i];
+    }
+    
+    // Slabs are made of whole chunks (necessary above 2^28 points)
+    const hsize_t max_size = 4294967295/2/sizeof( double );
+    hsize_t plane_size = ( hsize_t )dataset_size[1] * ( hsize_t )dataset_size[2];
+    hsize_t chunk_nx = max( ( hsize_t )1, max_size / plane_size );
+    slab_nx = ( dataset_size[0] - 1 ) / aggregators + 1;
+    if( slab_nx > chunk_nx ) {
+        slab_nx = ( ( slab_nx - 1 ) / chunk_nx + 1 ) * chunk_nx;
+    } else {
+        chunk_nx = slab_nx;
+    }
+    unsigned int nslabs = ( dataset_size[0] - 1 ) / slab_nx + 1;
+    
+    // Aggregators are spread over all ranks
+    int nproc = smpi->getSize(), iproc = smpi->getRank();
+    aggregator_rank.resize( nslabs );
+    my_slab = -1;
+    for( unsigned int a=0; a<nslabs; a++ ) {
+        aggregator_rank[a] = ( int )( ( ( long long )a * nproc ) / aggregators );
+        if( aggregator_rank[a] == iproc ) {
+            my_slab = a;
+        }
+    }
+    
+    // List the patches intersecting the slab of this aggregator
+    unsigned int slab_start = 0, slab_nx_local = 0;
+    if( my_slab >= 0 ) {
+        slab_start = my_slab * slab_nx;
+        slab_nx_local = min( slab_nx, dataset_size[0] - slab_start );
+        unsigned int istart_in_file[3], nsteps[3];
+        for( unsigned int h=0; h<( unsigned int )tot_number_of_patches; h++ ) {
+            vector<unsigned int> coords = vecPatches.domain_decomposition_->getDomainCoordinates( h );
+            patchInFile( coords, istart_in_file, nsteps );
+            if( nsteps[0]*nsteps[1]*nsteps[2] > 0
+                && istart_in_file[0] < slab_start + slab_nx_local
+                && istart_in_file[0] + nsteps[0] > slab_start ) {
+                slab_patch.push_back( h );
+                slab_patch_coords.push_back( coords );
+            }
+        }
+    }
+    
+    // Each aggregator writes its slab, others write nothing
+    vector<hsize_t> size( dataset_size, dataset_size+3 ), offset( 3, 0 ), block( size ), chunk( size );
+    offset[0] = slab_start;
+    block [0] = slab_nx_local;
+    chunk [0] = chunk_nx;
+    filespace = new H5Space( size, offset, block, chunk );
+    memspace = new H5Space( block );
+    data_rewrite.resize( max( ( hsize_t )1, block[0]*block[1]*block[2] ) );
+    
+    send_count.resize( nslabs );
+    send_displ.resize( nslabs );
+    send_pieces.resize( nslabs );
+    comm_ = smpi->world();
+}
+
+
+// Location of the intersection between a patch and the subgrid, in the file
+void DiagnosticFields3D::patchInFile( vector<unsigned int> &Pcoordinates, unsigned int istart_in_file[3], unsigned int nsteps[3] )
+{
+    unsigned int istart_in_patch, patch_begin, patch_end;
+    for( unsigned int i=0; i<3; i++ ) {
+        patch_begin = Pcoordinates[i] * patch_size[i];
+        patch_end   = patch_begin + patch_size[i] + 1;
+        if( Pcoordinates[i] != 0 ) {
+            patch_begin++;
+        }
+        findSubgridIntersection(
+            subgrid_start_[i], subgrid_stop_[i], subgrid_step_[i],
+            patch_begin, patch_end,
+            istart_in_patch, istart_in_file[i], nsteps[i]
+        );
+    }
+}
+
+
 void DiagnosticFields3D::setFileSplitting( SmileiMPI *smpi, VectorPatch &vecPatches )
 {
     // Calculate the total size of the array in this proc
@@ -188,6 +286,62 @@ void DiagnosticFields3D::setFileSplitting( SmileiMPI *smpi, VectorPatch &vecPatc
     // Resize the data
     data.resize( buffer_size );
     
+    if( aggregators > 0 ) {
+        // Pieces of each local patch to be sent to each aggregator (rows of x indices are contiguous in "data")
+        unsigned int istart_in_file[3], nsteps[3];
+        unsigned int total = 0;
+        for( unsigned int a=0; a<send_pieces.size(); a++ ) {
+            send_pieces[a].resize( 0 );
+            send_count[a] = 0;
+        }
+        for( unsigned int ipatch=0; ipatch<vecPatches.size(); ipatch++ ) {
+            patchInFile( vecPatches( ipatch )->Pcoordinates, istart_in_file, nsteps );
+            unsigned int row = nsteps[1]*nsteps[2];
+            if( nsteps[0]*row == 0 ) {
+                continue;
+            }
+            unsigned int ix_end = istart_in_file[0] + nsteps[0];
+            for( unsigned int a = istart_in_file[0]/slab_nx; a <= ( ix_end-1 )/slab_nx; a++ ) {
+                unsigned int ix0 = max( istart_in_file[0], a*slab_nx );
+                unsigned int ix1 = min( ix_end, ( a+1 )*slab_nx );
+                send_pieces[a].push_back( make_pair( one_patch_buffer_size*ipatch + ( ix0-istart_in_file[0] )*row, ( ix1-ix0 )*row ) );
+                send_count[a] += ( ix1-ix0 )*row;
+            }
+        }
+        for( unsigned int a=0; a<send_count.size(); a++ ) {
+            send_displ[a] = total;
+            total += send_count[a];
+        }
+        send_buffer.resize( total );
+        
+        // Data received by this aggregator, from the current owners of the patches of its slab
+        recv_rank.resize( 0 );
+        recv_count.resize( 0 );
+        recv_displ.resize( 0 );
+        total = 0;
+        unsigned int slab_start = my_slab * slab_nx;
+        int owner = 0, owner_end = smpi->patch_count[0];
+        for( unsigned int k=0; k<slab_patch.size(); k++ ) {
+            patchInFile( slab_patch_coords[k], istart_in_file, nsteps );
+            unsigned int ix0 = max( istart_in_file[0], slab_start );
+            unsigned int ix1 = min( istart_in_file[0] + nsteps[0], slab_start + slab_nx );
+            // slab_patch is sorted, so that owners are found by browsing patch_count once
+            while( ( int )slab_patch[k] >= owner_end ) {
+                owner++;
+                owner_end += smpi->patch_count[owner];
+            }
+            if( recv_rank.empty() || recv_rank.back() != owner ) {
+                recv_rank.push_back( owner );
+                recv_count.push_back( 0 );
+                recv_displ.push_back( total );
+            }
+            recv_count.back() += ( ix1-ix0 )*nsteps[1]*nsteps[2];
+            total += ( ix1-ix0 )*nsteps[1]*nsteps[2];
+        }
+        recv_buffer.resize( total );
+        return;
+    }
+    
     filespace_firstwrite = new H5Space( file_size, one_patch_buffer_size * refHindex, buffer_size, chunk_size_firstwrite );
     memspace_firstwrite  = new H5Space( buffer_size );
     
@@ -250,6 +404,10 @@ void DiagnosticFields3D::getField( Patch *patch, unsigned int ifield )
 H5Write DiagnosticFields3D::writeField( H5Write * loc, string name, int itime )
 {
 
+    if( aggregators > 0 ) {
+        return writeAggregated( loc, name );
+    }
+    
     // Write the buffer in a temporary location
     tmp_dset_->write( data[0], H5T_NATIVE_DOUBLE, filespace_firstwrite, memspace_firstwrite );
     
@@ -296,3 +454,50 @@ H5Write DiagnosticFields3D::writeField( H5Write * loc, string name, int itime )
     return loc->array( name, data_rewrite[0], filespace, memspace );
 }
 
+
+// Two-phase writing: patches are gathered by point-to-point communications, then each aggregator writes one slab
+H5Write DiagnosticFields3D::writeAggregated( H5Write *loc, string name )
+{
+    // Send the pieces of local patches to their aggregators
+    vector<MPI_Request> requests;
+    requests.reserve( recv_rank.size() + send_count.size() );
+    for( unsigned int i=0; i<recv_rank.size(); i++ ) {
+        requests.push_back( MPI_REQUEST_NULL );
+        MPI_Irecv( &recv_buffer[recv_displ[i]], recv_count[i], MPI_DOUBLE, recv_rank[i], 0, comm_, &requests.back() );
+    }
+    for( unsigned int a=0; a<send_count.size(); a++ ) {
+        if( send_count[a] == 0 ) {
+            continue;
+        }
+        double *b = &send_buffer[send_displ[a]];
+        for( unsigned int p=0; p<send_pieces[a].size(); p++ ) {
+            memcpy( b, &data[send_pieces[a][p].first], send_pieces[a][p].second*sizeof( double ) );
+            b += send_pieces[a][p].second;
+        }
+        requests.push_back( MPI_REQUEST_NULL );
+        MPI_Isend( &send_buffer[send_displ[a]], send_count[a], MPI_DOUBLE, aggregator_rank[a], 0, comm_, &requests.back() );
+    }
+    MPI_Waitall( requests.size(), requests.data(), MPI_STATUSES_IGNORE );
+    
+    // Place the received patches in the slab
+    if( my_slab >= 0 ) {
+        unsigned int istart_in_file[3], nsteps[3];
+        unsigned int slab_start = my_slab * slab_nx;
+        double *b = recv_buffer.data();
+        for( unsigned int k=0; k<slab_patch.size(); k++ ) {
+            patchInFile( slab_patch_coords[k], istart_in_file, nsteps );
+            unsigned int ix0 = max( istart_in_file[0], slab_start );
+            unsigned int ix1 = min( istart_in_file[0] + nsteps[0], slab_start + slab_nx );
+            for( unsigned int ix=ix0; ix<ix1; ix++ ) {
+                for( unsigned int iy=0; iy<nsteps[1]; iy++ ) {
+                    unsigned int write_position = istart_in_file[2] + dataset_size[2] * ( istart_in_file[1] + iy + dataset_size[1] * ( ix-slab_start ) );
+                    memcpy( &data_rewrite[write_position], b, nsteps[2]*sizeof( double ) );
+                    b += nsteps[2];
+                }
+            }
+        }
+    }
+    
+    // Large independent writes by the aggregators only
+    return loc->array( name, data_rewrite[0], H5T_NATIVE_DOUBLE, filespace, memspace, true );
+}
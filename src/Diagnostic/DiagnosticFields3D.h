@@ -23,9 +23,34 @@ public:
     
 private:
 
+    //! Location of the subgrid intersecting a patch, in the file
+    void patchInFile( std::vector<unsigned int> &Pcoordinates, unsigned int istart_in_file[3], unsigned int nsteps[3] );
+    
+    //! Define the slabs of the grid written by each aggregator
+    void initAggregators( Params &params, SmileiMPI *smpi, VectorPatch &vecPatches );
+    
+    //! Send the data of all patches to the aggregators, which write their slab
+    H5Write writeAggregated( H5Write *loc, std::string name );
+    
     unsigned int rewrite_npatch, rewrite_xmin, rewrite_ymin, rewrite_zmin, rewrite_npatchx, rewrite_npatchy, rewrite_npatchz;
     unsigned int rewrite_size[3], rewrite_start_in_file[3];
     std::vector<std::vector<unsigned int> > rewrite_patch;
+    
+    //! Aggregated writing: size of the dataset, number of x indices in each slab, slab written by this rank (-1 if none)
+    unsigned int dataset_size[3], slab_nx;
+    int my_slab;
+    //! Rank of each aggregator (the aggregator a writes the x indices from a*slab_nx)
+    std::vector<int> aggregator_rank;
+    //! Patches intersecting the slab of this rank (by increasing Hindex), and their coordinates
+    std::vector<unsigned int> slab_patch;
+    std::vector<std::vector<unsigned int> > slab_patch_coords;
+    //! Number of values sent to each aggregator, and the pieces of "data" (start, size) that make them
+    std::vector<int> send_count, send_displ;
+    std::vector<std::vector<std::pair<unsigned int, unsigned int> > > send_pieces;
+    //! Ranks sending data to this aggregator, number of values and position in recv_buffer
+    std::vector<int> recv_rank, recv_count, recv_displ;
+    std::vector<double> send_buffer, recv_buffer;
+    MPI_Comm comm_;
 };
 
 #endif
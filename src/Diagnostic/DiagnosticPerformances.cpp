@@ -165,19 +165,23 @@ void DiagnosticPerformances::run( SmileiMPI *smpi, VectorPatch &vecPatches, int
         unsigned int number_of_cells = ncells_per_patch * number_of_patches;
         unsigned int number_of_species = vecPatches( 0 )->vecSpecies.size();
         unsigned int number_of_particles=0, number_of_frozen_particles=0;
+        double particles_load = 0.;
         double time = itime * timestep;
         for( unsigned int ipatch=0; ipatch < number_of_patches; ipatch++ ) {
             for( unsigned int ispecies = 0; ispecies < number_of_species; ispecies++ ) {
-                if( time < vecPatches( ipatch )->vecSpecies[ispecies]->time_frozen_ ) {
-                    number_of_frozen_particles += vecPatches( ipatch )->vecSpecies[ispecies]->getNbrOfParticles();
+                Species *species = vecPatches( ipatch )->vecSpecies[ispecies];
+                unsigned int npart = species->getNbrOfParticles();
+                if( time < species->time_frozen_ ) {
+                    number_of_frozen_particles += npart;
                 } else {
-                    number_of_particles += vecPatches( ipatch )->vecSpecies[ispecies]->getNbrOfParticles();
+                    number_of_particles += npart;
                 }
+                // Frozen and subcycled particles are not pushed at every timestep
+                particles_load += ( ( double )npart ) * species->particleLoadFactor( time, frozen_particle_load );
             }
         }
         double total_load =
-            ( ( double )number_of_particles )
-            + ( ( double )number_of_frozen_particles ) * frozen_particle_load
+            particles_load
             + ( ( double )number_of_cells ) * cell_load;
         
         // Fill the vector for uint quantities
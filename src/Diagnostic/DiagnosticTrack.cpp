@@ -8,13 +8,15 @@
 #include "DiagnosticTrack.h"
 #include "VectorPatch.h"
 #include "Params.h"
+#include "Function.h"
 
 using namespace std;
 
 DiagnosticTrack::DiagnosticTrack( Params &params, SmileiMPI *smpi, VectorPatch &vecPatches, unsigned int iDiagTrackParticles, unsigned int idiag, OpenPMDparams &oPMD ) :
     Diagnostic( &oPMD, "DiagTrackParticles", iDiagTrackParticles ),
     IDs_done( params.restart ),
-    nDim_particle( params.nDim_particle )
+    nDim_particle( params.nDim_particle ),
+    native_filter( NULL )
 {
 
     // Extract the species
@@ -47,12 +49,40 @@ DiagnosticTrack::DiagnosticTrack( Params &params, SmileiMPI *smpi, VectorPatch &
     // Get parameter "filter" which gives a python function to select particles
     filter = PyTools::extract_py( "filter", "DiagTrackParticles", iDiagTrackParticles );
     has_filter = ( filter != Py_None );
+    ids_before_filter = false;
     if( has_filter ) {
 #ifdef SMILEI_USE_NUMPY
         // Test the filter with temporary, "fake" particles
         name << " filter:";
         bool *dummy = NULL;
         ParticleData test( nDim_particle, filter, name.str(), dummy );
+        
+        // id_hash needs the IDs of all particles, not only of those which passed the filter
+        PyObject *uses_ids = PyObject_CallMethod( PyImport_AddModule( "__main__" ), const_cast<char *>( "_filter_uses_id_hash" ), const_cast<char *>( "O" ), filter );
+        PyTools::checkPyError();
+        ids_before_filter = uses_ids && PyObject_IsTrue( uses_ids );
+        Py_XDECREF( uses_ids );
+        
+        // Try to translate the filter to native code (see _native_filter in pyprofiles.py)
+        bool native = true;
+        PyTools::extract( "native_filter", native, "DiagTrackParticles", iDiagTrackParticles );
+        bool has_chi = vecPatches( 0 )->vecSpecies[speciesId_]->particles->isQuantumParameter;
+        PyObject *program = NULL;
+        if( native ) {
+            program = PyObject_CallMethod( PyImport_AddModule( "__main__" ), const_cast<char *>( "_native_filter" ), const_cast<char *>( "OiO" ), filter, ( int ) nDim_particle, has_chi ? Py_True : Py_False );
+            PyTools::checkPyError();
+        }
+        std::vector<double> native_program;
+        if( program && program != Py_None && PyTools::py2vector( program, native_program ) && native_program.size() > 0 ) {
+            native_filter = new Function_Native( native_program, FILTER_NVARIABLES );
+            native_filter_variables.resize( FILTER_NVARIABLES, false );
+            for( unsigned int i=0; i<native_program.size(); i+=2 ) {
+                if( ( int ) native_program[i] == NATIVE_VAR ) {
+                    native_filter_variables[( int ) native_program[i+1]] = true;
+                }
+            }
+        }
+        Py_XDECREF( program );
 #else
         ERROR( name.str() << " with a filter requires the numpy package" );
 #endif
@@ -143,6 +173,9 @@ DiagnosticTrack::DiagnosticTrack( Params &params, SmileiMPI *smpi, VectorPatch &
     if( smpi->isMaster() ) {
         MESSAGE( 1, "Created TrackParticles #" << iDiagTrackParticles << ": species " << species_name );
         MESSAGE( 2, attr_list.str() );
+        if( has_filter ) {
+            MESSAGE( 2, "filter" << ( native_filter ? " translated to native code" : " evaluated by python" ) );
+        }
     }
     
     // Obtain the approximate number of particles in the species
@@ -159,6 +192,9 @@ DiagnosticTrack::~DiagnosticTrack()
     delete timeSelection;
     delete flush_timeSelection;
     Py_DECREF( filter );
+    if( native_filter ) {
+        delete native_filter;
+    }
     closeFile();
 }
 
@@ -221,6 +257,17 @@ void DiagnosticTrack::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
     
     H5Write *momentum_group=NULL, *position_group=NULL, *species_group=NULL;
     H5Space *file_space=NULL, *mem_space=NULL;
+    
+    // A filter translated to native code is evaluated by all threads
+    if( native_filter ) {
+        #pragma omp single
+        patch_selection.resize( vecPatches.size() );
+        #pragma omp for schedule(runtime)
+        for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+            nativeFilter( vecPatches( ipatch )->vecSpecies[speciesId_]->particles, itime, patch_selection[ipatch] );
+        }
+    }
+    
     #pragma omp master
     {
         // Obtain the particle partition of all the patches in this MPI
@@ -230,36 +277,45 @@ void DiagnosticTrack::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
         if( has_filter ) {
         
 #ifdef SMILEI_USE_NUMPY
-            patch_selection.resize( vecPatches.size() );
-            PyArrayObject *ret;
-            ParticleData particleData( 0 );
-            for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
-                patch_selection[ipatch].resize( 0 );
-                Particles *p = vecPatches( ipatch )->vecSpecies[speciesId_]->particles;
-                unsigned int npart = p->size();
-                if( npart > 0 ) {
-                    // Expose particle data as numpy arrays
-                    particleData.resize( npart );
-                    particleData.set( p );
-                    // run the filter function
-                    ret = ( PyArrayObject * )PyObject_CallFunctionObjArgs( filter, particleData.get(), NULL );
-                    PyTools::checkPyError();
-                    particleData.clear();
-                    if( ret == NULL ) {
-                        ERROR( "A DiagTrackParticles filter has not provided a correct result" );
-                    }
-                    // Loop the return value and store the particle IDs
-                    bool *arr = ( bool * ) PyArray_GETPTR1( ret, 0 );
-                    for( unsigned int i=0; i<npart; i++ ) {
-                        if( arr[i] ) {
-                            patch_selection[ipatch].push_back( i );
-                            // If particle not tracked before ( the 7 first bytes (ID<2^56) == 0 ), then set its ID
-                            if( (p->id( i ) & 72057594037927935) == 0 ) {
-                                p->id( i ) += ++latest_Id;
+            if( ! native_filter ) {
+                patch_selection.resize( vecPatches.size() );
+                PyArrayObject *ret;
+                ParticleData particleData( 0 );
+                for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+                    patch_selection[ipatch].resize( 0 );
+                    Particles *p = vecPatches( ipatch )->vecSpecies[speciesId_]->particles;
+                    unsigned int npart = p->size();
+                    if( npart > 0 ) {
+                        // Expose particle data as numpy arrays
+                        particleData.resize( npart );
+                        particleData.set( p );
+                        // run the filter function
+                        ret = ( PyArrayObject * )PyObject_CallFunctionObjArgs( filter, particleData.get(), NULL );
+                        PyTools::checkPyError();
+                        particleData.clear();
+                        if( ret == NULL ) {
+                            ERROR( "A DiagTrackParticles filter has not provided a correct result" );
+                        }
+                        // Loop the return value and store the particle indices
+                        bool *arr = ( bool * ) PyArray_GETPTR1( ret, 0 );
+                        for( unsigned int i=0; i<npart; i++ ) {
+                            if( arr[i] ) {
+                                patch_selection[ipatch].push_back( i );
                             }
                         }
+                        Py_DECREF( ret );
+                    }
+                }
+            }
+            // Set the IDs serially, in the patch order, so that they do not depend on the number of threads
+            for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+                Particles *p = vecPatches( ipatch )->vecSpecies[speciesId_]->particles;
+                for( unsigned int isel=0; isel<patch_selection[ipatch].size(); isel++ ) {
+                    unsigned int i = patch_selection[ipatch][isel];
+                    // If particle not tracked before ( the 7 first bytes (ID<2^56) == 0 ), then set its ID
+                    if( (p->id( i ) & 72057594037927935) == 0 ) {
+                        p->id( i ) += ++latest_Id;
                     }
-                    Py_DECREF( ret );
                 }
                 patch_start[ipatch] = nParticles_local;
                 nParticles_local += patch_selection[ipatch].size();
@@ -520,7 +576,7 @@ void DiagnosticTrack::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
 void DiagnosticTrack::setIDs( Patch *patch )
 {
     // If filter, IDs are set on-the-fly
-    if( has_filter ) {
+    if( has_filter && ! ids_before_filter ) {
         return;
     }
     unsigned int s = patch->vecSpecies[speciesId_]->particles->size();
@@ -533,7 +589,7 @@ void DiagnosticTrack::setIDs( Patch *patch )
 void DiagnosticTrack::setIDs( Particles &particles )
 {
     // If filter, IDs are set on-the-fly
-    if( has_filter ) {
+    if( has_filter && ! ids_before_filter ) {
         return;
     }
     unsigned int s = particles.size();
@@ -546,11 +602,72 @@ void DiagnosticTrack::setIDs( Particles &particles )
 }
 
 
+// Same hash as id_hash in pyprofiles.py (splitmix64 finalizer mapped to [0,1[)
+static inline double id_hash( uint64_t id )
+{
+    uint64_t z = id + 0x9E3779B97F4A7C15ULL;
+    z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+    z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBULL;
+    z = z ^ ( z >> 31 );
+    return ( double )( z >> 11 ) * 1.1102230246251565e-16;
+}
+
+// Select the particles of one patch using the filter translated to native code
+void DiagnosticTrack::nativeFilter( Particles *particles, int itime, vector<unsigned int> &selection )
+{
+    const unsigned int block_size = Function_Native::block_size;
+    double charge[block_size], hash[block_size], iteration[block_size], result[block_size];
+    const double *variables[FILTER_NVARIABLES];
+    for( unsigned int ivar=0; ivar<FILTER_NVARIABLES; ivar++ ) {
+        variables[ivar] = NULL;
+    }
+    for( unsigned int i=0; i<block_size; i++ ) {
+        iteration[i] = ( double ) itime;
+    }
+    variables[FILTER_CHARGE] = charge;
+    variables[FILTER_ID_HASH] = hash;
+    variables[FILTER_ITERATION] = iteration;
+    
+    selection.resize( 0 );
+    unsigned int npart = particles->size();
+    for( unsigned int i0=0; i0<npart; i0+=block_size ) {
+        unsigned int np = min( block_size, npart-i0 );
+        // Point directly to the particle data, or convert it to double
+        for( unsigned int idim=0; idim<nDim_particle; idim++ ) {
+            variables[FILTER_X+idim] = &( particles->Position[idim][i0] );
+        }
+        for( unsigned int idim=0; idim<3; idim++ ) {
+            variables[FILTER_PX+idim] = &( particles->Momentum[idim][i0] );
+        }
+        variables[FILTER_WEIGHT] = &( particles->Weight[i0] );
+        if( particles->isQuantumParameter ) {
+            variables[FILTER_CHI] = &( particles->Chi[i0] );
+        }
+        if( native_filter_variables[FILTER_CHARGE] ) {
+            for( unsigned int i=0; i<np; i++ ) {
+                charge[i] = ( double ) particles->Charge[i0+i];
+            }
+        }
+        if( native_filter_variables[FILTER_ID_HASH] ) {
+            for( unsigned int i=0; i<np; i++ ) {
+                hash[i] = id_hash( particles->Id[i0+i] );
+            }
+        }
+        // Evaluate the filter and store the selected particle indices
+        native_filter->valuesAt( variables, np, result );
+        for( unsigned int i=0; i<np; i++ ) {
+            if( result[i] != 0. ) {
+                selection.push_back( i0+i );
+            }
+        }
+    }
+}
+
 template<typename T>
 void DiagnosticTrack::fill_buffer( VectorPatch &vecPatches, unsigned int iprop, vector<T> &buffer )
 {
     unsigned int patch_nParticles, i, j, nPatches=vecPatches.size();
-    vector<T> *property = NULL;
+    ParticleVector<T> *property = NULL;
     
     if( has_filter ) {
         #pragma omp for schedule(runtime)
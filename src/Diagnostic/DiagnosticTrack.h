@@ -4,10 +4,18 @@
 #include "Diagnostic.h"
 
 class Patch;
+class Function_Native;
 class Params;
 class SmileiMPI;
 
 
+//! Variables of a filter translated to native code (must match _native_filter_variables in pyprofiles.py)
+enum NativeFilterVariable {
+    FILTER_X=0, FILTER_Y, FILTER_Z, FILTER_PX, FILTER_PY, FILTER_PZ,
+    FILTER_WEIGHT, FILTER_CHARGE, FILTER_ID_HASH, FILTER_CHI, FILTER_ITERATION,
+    FILTER_NVARIABLES
+};
+
 class DiagnosticTrack : public Diagnostic
 {
 
@@ -73,9 +81,21 @@ private :
     //! Tells whether this diag includes a particle filter
     bool has_filter;
     
+    //! Tells whether the filter uses id_hash: all particles then get their IDs before filtering
+    bool ids_before_filter;
+    
     //! Tells whether this diag includes a particle filter
     PyObject *filter;
     
+    //! Filter translated to native code, NULL if the python filter must be called
+    Function_Native *native_filter;
+    
+    //! Variables used by the native filter
+    std::vector<bool> native_filter_variables;
+    
+    //! Selects the particles of one patch with the native filter
+    void nativeFilter( Particles *particles, int itime, std::vector<unsigned int> &selection );
+    
     //! Selection of the filtered particles in each patch
     std::vector<std::vector<unsigned int> > patch_selection;
     
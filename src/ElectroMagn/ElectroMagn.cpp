@@ -2,11 +2,15 @@
 
 #include <limits>
 #include <iostream>
+#include <cstring>
 
 #include "Params.h"
 #include "Species.h"
 #include "Projector.h"
 #include "Field.h"
+#include "Field1D.h"
+#include "Field2D.h"
+#include "Field3D.h"
 #include "ElectroMagnBC.h"
 #include "ElectroMagnBC_Factory.h"
 #include "SimWindow.h"
@@ -166,6 +170,15 @@ void ElectroMagn::initElectroMagnQuantities()
         ERROR( "this should not happen" );
     }
     
+    u_=NULL;
+    w_=NULL;
+    m_=NULL;
+    n_=NULL;
+    z_=NULL;
+    q_=NULL;
+    s_=NULL;
+    b_=NULL;
+    
     Ex_=NULL;
     Ey_=NULL;
     Ez_=NULL;
@@ -298,6 +311,14 @@ ElectroMagn::~ElectroMagn()
         delete rho_;
     }
     
+    // Work vectors of the pipelined conjugate gradient
+    Field *pipelined_work[8] = { u_, w_, m_, n_, z_, q_, s_, b_ };
+    for( unsigned int i=0; i<8; i++ ) {
+        if( pipelined_work[i] != NULL ) {
+            delete pipelined_work[i];
+        }
+    }
+    
     if( Env_A_abs_ != NULL ) {
         delete Env_A_abs_;
     }
@@ -607,3 +628,201 @@ void ElectroMagn::applyAntenna( unsigned int iAntenna, double intensity )
     }
 }
 
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Pipelined conjugate gradient for the Poisson problems (see VectorPatch::solvePoissonPipelined)
+//   These work on the fields of initPoisson (phi_, r_, p_) whatever the cartesian geometry :
+//   a missing dimension is a dimension of size 1.
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn::initPipelinedPoisson()
+{
+    Field **work[8] = { &u_, &w_, &m_, &n_, &z_, &q_, &s_, &b_ };
+    for( unsigned int i=0 ; i<8 ; i++ ) {
+        if( *work[i] ) {
+            ( *work[i] )->put_to( 0. );
+        } else if( nDim_field == 1 ) {
+            *work[i] = new Field1D( dimPrim );
+        } else if( nDim_field == 2 ) {
+            *work[i] = new Field2D( dimPrim );
+        } else {
+            *work[i] = new Field3D( dimPrim );
+        }
+    }
+}
+
+void ElectroMagn::applyPoissonOperator( Patch *patch, Field *x, Field *Ax, double gamma_mean )
+{
+    // compute_Ap computes Ap_ from p_
+    Field *p  = p_;
+    Field *Ap = Ap_;
+    p_  = x;
+    Ap_ = Ax;
+    if( gamma_mean > 0. ) {
+        compute_Ap_relativistic_Poisson( patch, gamma_mean );
+    } else {
+        compute_Ap( patch );
+    }
+    p_  = p;
+    Ap_ = Ap;
+}
+
+// Gauss-Seidel sweep of A x = b on the nodes [lo,hi] of x, in ascending or descending order :
+// the nodes outside [lo,hi] count as zero
+static void poissonGaussSeidelSweep( double *x, double *b, unsigned int *n, unsigned int *lo, unsigned int *hi, double *c, double diag, bool ascending )
+{
+    unsigned int stride[3] = { n[1]*n[2], n[2], 1 };
+    unsigned int ni = hi[0]-lo[0]+1, nj = hi[1]-lo[1]+1, nk = hi[2]-lo[2]+1;
+    for( unsigned int ii=0 ; ii<ni ; ii++ ) {
+        unsigned int i = ascending ? lo[0]+ii : hi[0]-ii;
+        for( unsigned int jj=0 ; jj<nj ; jj++ ) {
+            unsigned int j = ascending ? lo[1]+jj : hi[1]-jj;
+            for( unsigned int kk=0 ; kk<nk ; kk++ ) {
+                unsigned int k = ascending ? lo[2]+kk : hi[2]-kk;
+                unsigned int idx = i*stride[0] + j*stride[1] + k;
+                double sum = b[idx];
+                unsigned int ijk[3] = { i, j, k };
+                for( unsigned int d=0 ; d<3 ; d++ ) {
+                    if( ijk[d] > lo[d] ) {
+                        sum -= c[d] * x[idx-stride[d]];
+                    }
+                    if( ijk[d] < hi[d] ) {
+                        sum -= c[d] * x[idx+stride[d]];
+                    }
+                }
+                x[idx] = sum / diag;
+            }
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Nodes of the unknowns owned by the patch : those of compute_r, extended to the ghost nodes beyond the non periodic
+// boundaries along y and z (as compute_Ap has no boundary row along y and z, the outermost ghost node is held at zero).
+// Every node of the domain thus belongs to a single patch, and the operator is symmetric for poissonDot.
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn::pipelinedPoissonNodes( Patch *patch, unsigned int *n, unsigned int *lo, unsigned int *hi )
+{
+    for( unsigned int d=0 ; d<3 ; d++ ) {
+        n[d]  = 1;
+        lo[d] = 0;
+        hi[d] = 0;
+    }
+    for( unsigned int d=0 ; d<nDim_field ; d++ ) {
+        n[d]  = dimPrim[d];
+        lo[d] = d > 0 && patch->isBoundary( d, 0 ) ? 1      : index_min_p_[d];
+        hi[d] = d > 0 && patch->isBoundary( d, 1 ) ? n[d]-2 : index_max_p_[d];
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Block Jacobi preconditioner
+//   The nodes are split in disjoint blocks, so that the preconditioner is symmetric and needs no communication :
+//   - the nodes owned by the patch, except those shared with the previous patch along each dimension,
+//     form one block, approximately solved with a symmetric Gauss-Seidel sweep (forward then backward)
+//   - every other node is a block of its own (x = b/diag) : the shared nodes are thus computed identically
+//     by the 2 patches, and the ghost nodes are then overwritten by the exchange of x
+//   The nodes held at zero (see pipelinedPoissonNodes) are set to zero, whatever the preconditioner.
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn::applyPoissonPreconditioner( Patch *patch, Field *b, Field *x, double gamma_mean, bool block_jacobi )
+{
+    unsigned int n[3], lo[3], hi[3];
+    pipelinedPoissonNodes( patch, n, lo, hi );
+    
+    if( block_jacobi ) {
+        double c[3] = { 0., 0., 0. };
+        for( unsigned int d=0 ; d<nDim_field ; d++ ) {
+            c[d] = 1.0/( cell_length[d]*cell_length[d] );
+            if( lo[d] > 0 && !patch->isBoundary( d, 0 ) ) {
+                lo[d]++;
+            }
+        }
+        if( gamma_mean > 0. ) {
+            c[0] /= gamma_mean*gamma_mean;
+        }
+        double diag = -2.0*( c[0]+c[1]+c[2] );
+        
+        for( unsigned int i=0 ; i<b->globalDims_ ; i++ ) {
+            x->data_[i] = b->data_[i] / diag;
+        }
+        if( lo[0] <= hi[0] && lo[1] <= hi[1] && lo[2] <= hi[2] ) {
+            // Nodes of the block set to zero, then forward and backward sweeps
+            for( unsigned int i=lo[0] ; i<=hi[0] ; i++ ) {
+                for( unsigned int j=lo[1] ; j<=hi[1] ; j++ ) {
+                    memset( &x->data_[( i*n[1]+j )*n[2]+lo[2]], 0, ( hi[2]-lo[2]+1 )*sizeof( double ) );
+                }
+            }
+            poissonGaussSeidelSweep( x->data_, b->data_, n, lo, hi, c, diag, true );
+            poissonGaussSeidelSweep( x->data_, b->data_, n, lo, hi, c, diag, false );
+        }
+    } else {
+        memcpy( x->data_, b->data_, b->globalDims_*sizeof( double ) );
+    }
+    
+    // Outermost ghost nodes beyond the non periodic boundaries along y and z
+    for( unsigned int d=1 ; d<nDim_field ; d++ ) {
+        for( unsigned int side=0 ; side<2 ; side++ ) {
+            if( !patch->isBoundary( d, side ) ) {
+                continue;
+            }
+            unsigned int l = side==0 ? 0 : n[d]-1;
+            unsigned int zlo[3] = { 0, 0, 0 }, zhi[3] = { n[0]-1, n[1]-1, n[2]-1 };
+            zlo[d] = l;
+            zhi[d] = l;
+            for( unsigned int i=zlo[0] ; i<=zhi[0] ; i++ ) {
+                for( unsigned int j=zlo[1] ; j<=zhi[1] ; j++ ) {
+                    for( unsigned int k=zlo[2] ; k<=zhi[2] ; k++ ) {
+                        x->data_[( i*n[1]+j )*n[2]+k] = 0.;
+                    }
+                }
+            }
+        }
+    }
+}
+
+double ElectroMagn::poissonDot( Patch *patch, Field *a, Field *b )
+{
+    unsigned int n[3], lo[3], hi[3];
+    pipelinedPoissonNodes( patch, n, lo, hi );
+    double dot = 0.;
+    for( unsigned int i=lo[0] ; i<=hi[0] ; i++ ) {
+        for( unsigned int j=lo[1] ; j<=hi[1] ; j++ ) {
+            for( unsigned int k=lo[2] ; k<=hi[2] ; k++ ) {
+                unsigned int idx = ( i*n[1]+j )*n[2]+k;
+                dot += a->data_[idx] * b->data_[idx];
+            }
+        }
+    }
+    return dot;
+}
+
+void ElectroMagn::updatePipelinedPoisson( double alpha, double beta )
+{
+    double *phi = phi_->data_, *r = r_->data_, *p = p_->data_;
+    double *u = u_->data_, *w = w_->data_, *m = m_->data_, *n = n_->data_;
+    double *z = z_->data_, *q = q_->data_, *s = s_->data_;
+    for( unsigned int i=0 ; i<r_->globalDims_ ; i++ ) {
+        z[i]    = n[i] + beta * z[i];
+        q[i]    = m[i] + beta * q[i];
+        s[i]    = w[i] + beta * s[i];
+        p[i]    = u[i] + beta * p[i];
+        phi[i] += alpha * p[i];
+        r[i]   -= alpha * s[i];
+        u[i]   -= alpha * q[i];
+        w[i]   -= alpha * z[i];
+    }
+}
+
+void ElectroMagn::pipelinedPoissonResidual( bool init )
+{
+    double *r = r_->data_, *n = n_->data_, *b = b_->data_;
+    if( init ) {
+        for( unsigned int i=0 ; i<r_->globalDims_ ; i++ ) {
+            b[i] = r[i] + n[i];
+        }
+    } else {
+        for( unsigned int i=0 ; i<r_->globalDims_ ; i++ ) {
+            r[i] = b[i] - n[i];
+        }
+    }
+}
@@ -289,6 +289,21 @@ public:
     virtual void centeringE( std::vector<double> E_Add ) = 0;
     virtual void centeringErel( std::vector<double> E_Add ) = 0;
     
+    //! Pipelined conjugate gradient (VectorPatch::solvePoissonPipelined) : allocate the work vectors at the first solve
+    void initPipelinedPoisson();
+    //! Apply the Poisson operator (the relativistic one if gamma_mean>0) to x, result in Ax
+    void applyPoissonOperator( Patch *patch, Field *x, Field *Ax, double gamma_mean );
+    //! Apply the preconditioner (block Jacobi, or identity) to b, result in x
+    void applyPoissonPreconditioner( Patch *patch, Field *b, Field *x, double gamma_mean, bool block_jacobi );
+    //! Scalar product of 2 vectors on the nodes owned by the patch (see pipelinedPoissonNodes)
+    double poissonDot( Patch *patch, Field *a, Field *b );
+    //! Dimensions n, and range [lo,hi] of the nodes owned by the patch for the pipelined conjugate gradient
+    void pipelinedPoissonNodes( Patch *patch, unsigned int *n, unsigned int *lo, unsigned int *hi );
+    //! Recurrences of the pipelined conjugate gradient
+    void updatePipelinedPoisson( double alpha, double beta );
+    //! With n = A phi : stores the right-hand side b = r + n (init), or replaces the residual r = b - n
+    void pipelinedPoissonResidual( bool init );
+    
     virtual double getEx_Xmin() = 0; // 2D !!!
     virtual double getEx_Xmax() = 0; // 2D !!!
     
@@ -311,6 +326,9 @@ public:
     Field *r_;
     Field *p_;
     Field *Ap_;
+    //! Work vectors of the pipelined conjugate gradient : u=M^-1 r, w=Au, m=M^-1 w, n=Am, the recurrences z, q, s,
+    //! and the right-hand side b
+    Field *u_, *w_, *m_, *n_, *z_, *q_, *s_, *b_;
 
     cField *phi_AM_;
     cField *r_AM_;
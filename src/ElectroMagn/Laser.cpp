@@ -271,6 +271,22 @@ void Laser::disable()
 }
 
 
+// Amplitudes at several points of the boundary, one point at a time
+void LaserProfile::addAmplitudes( double t, std::vector<double> &pos_min, std::vector<double> &d,
+                                  unsigned int j0, unsigned int j1, unsigned int k0, unsigned int k1, unsigned int stride, double *amp )
+{
+    vector<double> pos( pos_min );
+    for( unsigned int j=j0; j<j1; j++ ) {
+        pos[0] = pos_min[0] + j*d[0];
+        for( unsigned int k=k0; k<k1; k++ ) {
+            if( pos.size() > 1 ) {
+                pos[1] = pos_min[1] + k*d[1];
+            }
+            amp[j*stride+k] += getAmplitude( pos, t, j, k );
+        }
+    }
+}
+
 // Separable laser profile constructor
 LaserProfileSeparable::LaserProfileSeparable(
     double omega, Profile *chirpProfile, Profile *timeProfile,
@@ -459,6 +475,47 @@ double LaserProfileSeparable::getAmplitude( std::vector<double> pos, double t, i
     return amp;
 }
 
+// Amplitudes of a separable laser profile at several points of the boundary
+// The time envelope only depends on the local phase: it is evaluated once for each different phase
+// (only once if the phase is uniform), then the space and time envelopes are combined in a simd loop.
+void LaserProfileSeparable::addAmplitudes( double t, std::vector<double> &, std::vector<double> &,
+        unsigned int j0, unsigned int j1, unsigned int k0, unsigned int k1, unsigned int stride, double *amp )
+{
+    if( j0 >= j1 || k0 >= k1 ) {
+        return;
+    }
+    unsigned int nk = space_envelope->dims_[1];
+    time_envelope_.resize( space_envelope->globalDims_ );
+    double omega;
+    #pragma omp critical
+    {
+        omega = omega_ * chirpProfile_->valueAt( t );
+        double last_phi = ( *phase )( j0, k0 );
+        double last_envelope = timeProfile_->valueAt( t-( last_phi+delay_phase_ )/omega );
+        for( unsigned int j=j0; j<j1; j++ ) {
+            for( unsigned int k=k0; k<k1; k++ ) {
+                double phi = ( *phase )( j, k );
+                if( phi != last_phi ) {
+                    last_phi = phi;
+                    last_envelope = timeProfile_->valueAt( t-( phi+delay_phase_ )/omega );
+                }
+                time_envelope_[j*nk+k] = last_envelope;
+            }
+        }
+    }
+    const double *space = space_envelope->data();
+    const double *phi = phase->data();
+    const double *time = time_envelope_.data();
+    for( unsigned int j=j0; j<j1; j++ ) {
+        double *a = &amp[j*stride];
+        unsigned int jk = j*nk;
+        #pragma omp simd
+        for( unsigned int k=k0; k<k1; k++ ) {
+            a[k] += time[jk+k] * space[jk+k] * sin( omega*t - phi[jk+k] );
+        }
+    }
+}
+
 //Destructor
 LaserProfileNonSeparable::~LaserProfileNonSeparable()
 {
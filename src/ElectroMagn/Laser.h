@@ -25,6 +25,10 @@ public:
     LaserProfile() {};
     virtual ~LaserProfile() {};
     virtual double getAmplitude( std::vector<double> pos, double t, int j, int k ) = 0;
+    //! Adds the amplitudes at points [j0,j1[ x [k0,k1[ of the boundary to amp[j*stride+k].
+    //! Point (j,k) is located at pos_min + (j,k)*d
+    virtual void addAmplitudes( double t, std::vector<double> &pos_min, std::vector<double> &d,
+                                unsigned int j0, unsigned int j1, unsigned int k0, unsigned int k1, unsigned int stride, double *amp );
     virtual std::complex<double> getAmplitudecomplex( std::vector<double> pos, double t, int j, int k )
     {
         return 0.;
@@ -66,6 +70,19 @@ public:
         return profiles[1]->getAmplitude( pos, t, j, k );
     }
 
+    //! Adds the amplitudes at several points of the boundary (By)
+    inline void addAmplitudes0( double t, std::vector<double> &pos_min, std::vector<double> &d,
+                                unsigned int j0, unsigned int j1, unsigned int k0, unsigned int k1, unsigned int stride, double *amp )
+    {
+        profiles[0]->addAmplitudes( t, pos_min, d, j0, j1, k0, k1, stride, amp );
+    }
+    //! Adds the amplitudes at several points of the boundary (Bz)
+    inline void addAmplitudes1( double t, std::vector<double> &pos_min, std::vector<double> &d,
+                                unsigned int j0, unsigned int j1, unsigned int k0, unsigned int k1, unsigned int stride, double *amp )
+    {
+        profiles[1]->addAmplitudes( t, pos_min, d, j0, j1, k0, k1, stride, amp );
+    }
+
     inline std::complex<double> getAmplitudecomplexN( std::vector<double> pos, double t, int j, int k, int imode )
     {
         return profiles[imode]->getAmplitudecomplex( pos, t, j, k );
@@ -116,9 +133,13 @@ public:
     void createFields( Params &params, Patch *patch );
     void initFields( Params &params, Patch *patch );
     double getAmplitude( std::vector<double> pos, double t, int j, int k );
+    void addAmplitudes( double t, std::vector<double> &pos_min, std::vector<double> &d,
+                        unsigned int j0, unsigned int j1, unsigned int k0, unsigned int k1, unsigned int stride, double *amp );
 protected:
     Field *space_envelope, *phase;
 private:
+    //! Time envelope at each point of the boundary, for the current time
+    std::vector<double> time_envelope_;
     bool primal_;
     double omega_;
     Profile *timeProfile_, *chirpProfile_, *spaceProfile_, *phaseProfile_;
@@ -119,13 +119,12 @@ void ElectroMagnBC2D_SM::apply( ElectroMagn *EMfields, double time_dual, Patch *
         
         // Lasers polarized along axis 1
         vector<double> b1( n_p[axis1_], 0. );
-        vector<double> pos( 1 );
+        vector<double> pos_min( 1 );
+        vector<double> d1( 1, d[axis1_] );
         if( ! vecLaser.empty() ) {
-            for( unsigned int j=patch->isBoundary(axis1_,0) ; j<n_p[axis1_]-patch->isBoundary(axis1_,1) ; j++ ) {
-                pos[0] = patch->getDomainLocalMin( axis1_ ) + ( ( int )j - ( int )EMfields->oversize[axis1_] )*d[axis1_];
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    b1[j] += vecLaser[ilaser]->getAmplitude0( pos, time_dual, j, 0 );
-                }
+            pos_min[0] = patch->getDomainLocalMin( axis1_ ) - ( double )EMfields->oversize[axis1_]*d[axis1_];
+            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+                vecLaser[ilaser]->addAmplitudes0( time_dual, pos_min, d1, patch->isBoundary(axis1_,0), n_p[axis1_]-patch->isBoundary(axis1_,1), 0, 1, 1, &b1[0] );
             }
         }
         if( axis0_ == 0 ) { // for By^(d,p)
@@ -153,11 +152,9 @@ void ElectroMagnBC2D_SM::apply( ElectroMagn *EMfields, double time_dual, Patch *
         // Lasers polarized along axis 2
         vector<double> b2( n_d[axis1_], 0. );
         if( ! vecLaser.empty() ) {
-            for( unsigned int j=patch->isBoundary(axis1_,0) ; j<n_d[axis1_]-patch->isBoundary(axis1_,1) ; j++ ) {
-                pos[0] = patch->getDomainLocalMin( axis1_ ) + ( ( int )j - 0.5 - ( int )EMfields->oversize[axis1_] )*d[axis1_];
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    b2[j] += vecLaser[ilaser]->getAmplitude1( pos, time_dual, j, 0 );
-                }
+            pos_min[0] = patch->getDomainLocalMin( axis1_ ) - ( 0.5 + EMfields->oversize[axis1_] )*d[axis1_];
+            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+                vecLaser[ilaser]->addAmplitudes1( time_dual, pos_min, d1, patch->isBoundary(axis1_,0), n_d[axis1_]-patch->isBoundary(axis1_,1), 0, 1, 1, &b2[0] );
             }
         }
         // for Bz^(d,d)
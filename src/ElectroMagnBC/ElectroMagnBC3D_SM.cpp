@@ -148,7 +148,8 @@ void ElectroMagnBC3D_SM::apply( ElectroMagn *EMfields, double time_dual, Patch *
         if( B_val[1] ) { B_ext[1] = &(B_val[1]->data_[0]); }
         if( B_val[2] ) { B_ext[2] = &(B_val[2]->data_[0]); }
         
-        vector<double> pos( 2 );
+        vector<double> pos_min( 2 );
+        vector<double> d12 = { d[axis1_], d[axis2_] };
         
         unsigned int nz_p = n_p[2];
         unsigned int nz_d = n_d[2];
@@ -165,14 +166,12 @@ void ElectroMagnBC3D_SM::apply( ElectroMagn *EMfields, double time_dual, Patch *
         // Lasers
         vector<double> b1( n1*n2, 0. );
         if( ! vecLaser.empty() ) {
-            for( unsigned int j=patch->isBoundary(axis1_,0); j<n1-patch->isBoundary(axis1_,1) ; j++ ) {
-                pos[0] = patch->getDomainLocalMin( axis1_ ) + ( ( int )j - ( int )EMfields->oversize[axis1_] )*d[axis1_];
-                for( unsigned int k=patch->isBoundary(axis2_,0) ; k<n2-patch->isBoundary(axis2_,1) ; k++ ) {
-                    pos[1] = patch->getDomainLocalMin( axis2_ ) + ( ( int )k -0.5 - ( int )EMfields->oversize[axis2_] )*d[axis2_];
-                    for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                        b1[ j*n2+k ] += vecLaser[ilaser]->getAmplitude0( pos, time_dual, j, k );
-                    }
-                }
+            pos_min[0] = patch->getDomainLocalMin( axis1_ ) - ( double )EMfields->oversize[axis1_]*d[axis1_];
+            pos_min[1] = patch->getDomainLocalMin( axis2_ ) - ( 0.5 + EMfields->oversize[axis2_] )*d[axis2_];
+            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+                vecLaser[ilaser]->addAmplitudes0( time_dual, pos_min, d12,
+                    patch->isBoundary(axis1_,0), n1-patch->isBoundary(axis1_,1),
+                    patch->isBoundary(axis2_,0), n2-patch->isBoundary(axis2_,1), n2, &b1[0] );
             }
         }
         // B1
@@ -220,14 +219,12 @@ void ElectroMagnBC3D_SM::apply( ElectroMagn *EMfields, double time_dual, Patch *
         unsigned int n2p = n_p[axis2_];
         vector<double> b2( n1d*n2p, 0. );
         if( ! vecLaser.empty() ) {
-            for( unsigned int j=patch->isBoundary(axis1_,0); j<n1d-patch->isBoundary(axis1_,1) ; j++ ) {
-                pos[0] = patch->getDomainLocalMin( axis1_ ) + ( ( int )j - 0.5 - ( int )EMfields->oversize[axis1_] )*d[axis1_];
-                for( unsigned int k=patch->isBoundary(axis2_,0) ; k<n2p-patch->isBoundary(axis2_,1) ; k++ ) {
-                    pos[1] = patch->getDomainLocalMin( axis2_ ) + ( ( int )k - ( int )EMfields->oversize[axis2_] )*d[axis2_];
-                    for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                        b2[ j*n2p+k ] += vecLaser[ilaser]->getAmplitude1( pos, time_dual, j, k );
-                    }
-                }
+            pos_min[0] = patch->getDomainLocalMin( axis1_ ) - ( 0.5 + EMfields->oversize[axis1_] )*d[axis1_];
+            pos_min[1] = patch->getDomainLocalMin( axis2_ ) - ( double )EMfields->oversize[axis2_]*d[axis2_];
+            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+                vecLaser[ilaser]->addAmplitudes1( time_dual, pos_min, d12,
+                    patch->isBoundary(axis1_,0), n1d-patch->isBoundary(axis1_,1),
+                    patch->isBoundary(axis2_,0), n2p-patch->isBoundary(axis2_,1), n2p, &b2[0] );
             }
         }
         // B2
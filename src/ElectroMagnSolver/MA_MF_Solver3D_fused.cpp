@@ -0,0 +1,39 @@
+#include "MA_MF_Solver3D_fused.h"
+
+#include "MA_Solver3D_norm.h"
+#include "MF_Solver3D_Yee.h"
+#include "MF_Solver3D_Lehe.h"
+
+MA_MF_Solver3D_fused::MA_MF_Solver3D_fused( Params &params )
+    : Solver3D( params )
+{
+    MA_ = new MA_Solver3D_norm( params );
+    if( params.maxwell_sol == "Lehe" ) {
+        MF_ = new MF_Solver3D_Lehe( params );
+    } else {
+        MF_ = new MF_Solver3D_Yee( params );
+    }
+}
+
+MA_MF_Solver3D_fused::~MA_MF_Solver3D_fused()
+{
+    delete MA_;
+    delete MF_;
+}
+
+void MA_MF_Solver3D_fused::operator()( ElectroMagn *fields )
+{
+    // The plane i of B needs the planes up to i+lag of E, and the plane i of E needs the planes i and i+1 of B
+    // still at the previous time : B lags lag planes behind E.
+    unsigned int lag = MF_->planeLag();
+    
+    for( unsigned int i=0 ; i<nx_d+lag ; i++ ) {
+        if( i < nx_d ) {
+            MA_->plane( fields, i );
+        }
+        if( i >= lag ) {
+            MF_->plane( fields, i-lag );
+        }
+    }
+}
+
@@ -0,0 +1,33 @@
+#ifndef MA_MF_SOLVER3D_FUSED_H
+#define MA_MF_SOLVER3D_FUSED_H
+
+#include "Solver3D.h"
+class ElectroMagn;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class MA_MF_Solver3D_fused
+//!   Maxwell-Ampere (MA_Solver3D_norm) and Maxwell-Faraday (Yee or Lehe) in a single sweep of the patch :
+//!   the x-planes of E are updated one after the other, each plane of B following as soon as the planes of E
+//!   it depends on are up to date (wavefront), so that E and B are read from the cache by the second solver.
+//!   Every point receives the same operations as with the separate solvers : results are bitwise identical.
+//  --------------------------------------------------------------------------------------------------------------------
+class MA_MF_Solver3D_fused : public Solver3D
+{
+
+public:
+    MA_MF_Solver3D_fused( Params &params );
+    virtual ~MA_MF_Solver3D_fused();
+    
+    //! Overloading of () operator
+    virtual void operator()( ElectroMagn *fields );
+    
+protected:
+    //! Maxwell-Ampere solver
+    Solver3D *MA_;
+    //! Maxwell-Faraday solver
+    Solver3D *MF_;
+    
+};//END class
+
+#endif
+
@@ -30,6 +30,13 @@ MF_Solver3D_Lehe::~MF_Solver3D_Lehe()
 }
 
 void MF_Solver3D_Lehe::operator()( ElectroMagn *fields )
+{
+    for( unsigned int i=0 ; i<nx_d ; i++ ) {
+        plane( fields, i );
+    }
+}//END solveMaxwellFaraday
+
+void MF_Solver3D_Lehe::plane( ElectroMagn *fields, unsigned int i )
 {
     // Static-cast of the fields
     Field3D *Ex3D = static_cast<Field3D *>( fields->Ex_ );
@@ -42,7 +49,7 @@ void MF_Solver3D_Lehe::operator()( ElectroMagn *fields )
     
     
     // Magnetic field Bx^(p,d,d)
-    for( unsigned int i=1 ; i<nx_p-1;  i++ ) {
+    if( i>=1 && i<nx_p-1 ) {
         for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
             for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
                 ( *Bx3D )( i, j, k ) += -dt_ov_dy * ( alpha_y * ( ( *Ez3D )( i,  j, k )  - ( *Ez3D )( i,  j-1, k ) )
@@ -55,8 +62,8 @@ void MF_Solver3D_Lehe::operator()( ElectroMagn *fields )
         }
     }
     
-    // Magnetic field By^(d,p,d)
-    for( unsigned int i=2 ; i<nx_d-2 ; i++ ) {
+    if( i>=2 && i<nx_d-2 ) {
+        // Magnetic field By^(d,p,d)
         for( unsigned int j=1 ; j<ny_p-1 ; j++ ) {
             for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
                 ( *By3D )( i, j, k ) += dt_ov_dx * ( alpha_x * ( ( *Ez3D )( i,  j, k ) - ( *Ez3D )( i-1, j, k ) )
@@ -68,11 +75,8 @@ void MF_Solver3D_Lehe::operator()( ElectroMagn *fields )
                                                     );
             }
         }
-    }
-    
-    
-    // Magnetic field Bz^(d,d,p)
-    for( unsigned int i=2 ; i<nx_d-2 ; i++ ) {
+        
+        // Magnetic field Bz^(d,d,p)
         for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
             for( unsigned int k=1 ; k<nz_p-1 ; k++ ) {
                 ( *Bz3D )( i, j, k ) += dt_ov_dy * ( alpha_y * ( ( *Ex3D )( i, j, k )-( *Ex3D )( i, j-1, k ) )
@@ -90,102 +94,97 @@ void MF_Solver3D_Lehe::operator()( ElectroMagn *fields )
     // Magnetic field Bx^(p,d,d)
     if( EM3D->isXmin ) {
         // At Xmin
-        for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
-            for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
-                ( *Bx3D )( 0, j, k ) += -dt_ov_dy * ( ( *Ez3D )( 0, j, k ) - ( *Ez3D )( 0, j-1, k ) ) + dt_ov_dz * ( ( *Ey3D )( 0, j, k ) - ( *Ey3D )( 0, j, k-1 ) );
+        if( i==0 ) {
+            for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
+                for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
+                    ( *Bx3D )( 0, j, k ) += -dt_ov_dy * ( ( *Ez3D )( 0, j, k ) - ( *Ez3D )( 0, j-1, k ) ) + dt_ov_dz * ( ( *Ey3D )( 0, j, k ) - ( *Ey3D )( 0, j, k-1 ) );
+                }
             }
         }
         //Additional boundaries treatment for i=1 and i=nx_d-2 for By and Bz
-        // at Xmin+dx - treat using simple discretization of the curl (will be overwritten if not at the xmin-border)
-        for( unsigned int j=0 ; j<ny_p ; j++ ) {
-            for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
-                ( *By3D )( 1, j, k ) += dt_ov_dx * ( ( *Ez3D )( 1, j, k ) - ( *Ez3D )( 0, j, k ) )
-                                        -dt_ov_dz * ( ( *Ex3D )( 1, j, k ) - ( *Ex3D )( 1, j, k-1 ) );
+        if( i==1 ) {
+            // at Xmin+dx - treat using simple discretization of the curl (will be overwritten if not at the xmin-border)
+            for( unsigned int j=0 ; j<ny_p ; j++ ) {
+                for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
+                    ( *By3D )( 1, j, k ) += dt_ov_dx * ( ( *Ez3D )( 1, j, k ) - ( *Ez3D )( 0, j, k ) )
+                                            -dt_ov_dz * ( ( *Ex3D )( 1, j, k ) - ( *Ex3D )( 1, j, k-1 ) );
+                }
             }
-        }
-        // at Xmin+dx - treat using simple discretization of the curl (will be overwritten if not at the xmin-border)
-        for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
-            for( unsigned int k=0 ; k<nz_p ; k++ ) {
-                ( *Bz3D )( 1, j, k ) += dt_ov_dx * ( ( *Ey3D )( 0, j, k ) - ( *Ey3D )( 1, j, k ) )
-                                        +  dt_ov_dy * ( ( *Ex3D )( 1, j, k ) - ( *Ex3D )( 1, j-1, k ) );
+            // at Xmin+dx - treat using simple discretization of the curl (will be overwritten if not at the xmin-border)
+            for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
+                for( unsigned int k=0 ; k<nz_p ; k++ ) {
+                    ( *Bz3D )( 1, j, k ) += dt_ov_dx * ( ( *Ey3D )( 0, j, k ) - ( *Ey3D )( 1, j, k ) )
+                                            +  dt_ov_dy * ( ( *Ex3D )( 1, j, k ) - ( *Ex3D )( 1, j-1, k ) );
+                }
             }
         }
         
     }
     if( EM3D->isXmax ) {
         // At Xmax
-        for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
-            for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
-                ( *Bx3D )( nx_p-1, j, k ) += -dt_ov_dy * ( ( *Ez3D )( nx_p-1, j, k ) - ( *Ez3D )( nx_p-1, j-1, k ) ) + dt_ov_dz * ( ( *Ey3D )( nx_p-1, j, k ) - ( *Ey3D )( nx_p-1, j, k-1 ) );
+        if( i==nx_p-1 ) {
+            for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
+                for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
+                    ( *Bx3D )( nx_p-1, j, k ) += -dt_ov_dy * ( ( *Ez3D )( nx_p-1, j, k ) - ( *Ez3D )( nx_p-1, j-1, k ) ) + dt_ov_dz * ( ( *Ey3D )( nx_p-1, j, k ) - ( *Ey3D )( nx_p-1, j, k-1 ) );
+                }
             }
         }
-        // at Xmax-dx - treat using simple discretization of the curl (will be overwritten if not at the xmax-border)
-        for( unsigned int j=0 ; j<ny_p ; j++ ) {
-            for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
-                ( *By3D )( nx_d-2, j, k ) += dt_ov_dx * ( ( *Ez3D )( nx_d-2, j, k ) - ( *Ez3D )( nx_d-3, j, k ) )
-                                             -dt_ov_dz * ( ( *Ex3D )( nx_d-2, j, k ) - ( *Ex3D )( nx_d-2, j, k-1 ) );
+        if( i==nx_d-2 ) {
+            // at Xmax-dx - treat using simple discretization of the curl (will be overwritten if not at the xmax-border)
+            for( unsigned int j=0 ; j<ny_p ; j++ ) {
+                for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
+                    ( *By3D )( nx_d-2, j, k ) += dt_ov_dx * ( ( *Ez3D )( nx_d-2, j, k ) - ( *Ez3D )( nx_d-3, j, k ) )
+                                                 -dt_ov_dz * ( ( *Ex3D )( nx_d-2, j, k ) - ( *Ex3D )( nx_d-2, j, k-1 ) );
+                }
             }
-        }
-        // at Xmax-dx - treat using simple discretization of the curl (will be overwritten if not at the xmax-border)
-        for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
-            for( unsigned int k=0 ; k<nz_p ; k++ ) {
-                ( *Bz3D )( nx_d-2, j, k ) += dt_ov_dx * ( ( *Ey3D )( nx_d-3, j, k ) - ( *Ey3D )( nx_d-2, j, k ) )
-                                             +  dt_ov_dy * ( ( *Ex3D )( nx_d-2, j, k ) - ( *Ex3D )( nx_d-2, j-1, k ) );
+            // at Xmax-dx - treat using simple discretization of the curl (will be overwritten if not at the xmax-border)
+            for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
+                for( unsigned int k=0 ; k<nz_p ; k++ ) {
+                    ( *Bz3D )( nx_d-2, j, k ) += dt_ov_dx * ( ( *Ey3D )( nx_d-3, j, k ) - ( *Ey3D )( nx_d-2, j, k ) )
+                                                 +  dt_ov_dy * ( ( *Ex3D )( nx_d-2, j, k ) - ( *Ex3D )( nx_d-2, j-1, k ) );
+                }
             }
         }
         
     }
     
+    if( i<2 || i>=nx_d-2 ) { //Cases i=1 and i=nx_d-2 are treated above for all required j and k.
+        return;
+    }
+    
     if( EM3D->isYmin ) {
         //At Ymin
-        for( unsigned int i=2 ; i<nx_d-2 ; i++ ) { //Cases i=1 and i=nx_d-2 are treated later for all required j and k.
-            unsigned int j=0 ;
-            for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
-                ( *By3D )( i, j, k ) += -dt_ov_dz * ( ( *Ex3D )( i, j, k ) - ( *Ex3D )( i, j, k-1 ) ) + dt_ov_dx * ( ( *Ez3D )( i, j, k ) - ( *Ez3D )( i-1, j, k ) );
-            }
+        unsigned int j=0 ;
+        for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
+            ( *By3D )( i, j, k ) += -dt_ov_dz * ( ( *Ex3D )( i, j, k ) - ( *Ex3D )( i, j, k-1 ) ) + dt_ov_dx * ( ( *Ez3D )( i, j, k ) - ( *Ez3D )( i-1, j, k ) );
         }
     }
     
     if( EM3D->isYmax ) {
         //At Ymax
-        for( unsigned int i=2 ; i<nx_d-2 ; i++ ) { //Cases i=1 and i=nx_d-2 are treated later for all required j and k
-            unsigned int j=ny_p-1 ;
-            for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
-                ( *By3D )( i, j, k ) += -dt_ov_dz * ( ( *Ex3D )( i, j, k ) - ( *Ex3D )( i, j, k-1 ) ) + dt_ov_dx * ( ( *Ez3D )( i, j, k ) - ( *Ez3D )( i-1, j, k ) );
-            }
+        unsigned int j=ny_p-1 ;
+        for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
+            ( *By3D )( i, j, k ) += -dt_ov_dz * ( ( *Ex3D )( i, j, k ) - ( *Ex3D )( i, j, k-1 ) ) + dt_ov_dx * ( ( *Ez3D )( i, j, k ) - ( *Ez3D )( i-1, j, k ) );
         }
     }
     
     if( EM3D->isZmin ) {
         //At Zmin
         // Magnetic field Bz^(d,d,p)
-        for( unsigned int i=2 ; i<nx_d-2 ; i++ ) { //Cases i=1 and i=nx_d-2 are treated later for all required j and k
-            unsigned int k=0 ;
-            for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
-                ( *Bz3D )( i, j, k ) += -dt_ov_dx * ( ( *Ey3D )( i, j, k ) - ( *Ey3D )( i-1, j, k ) ) + dt_ov_dy * ( ( *Ex3D )( i, j, k ) - ( *Ex3D )( i, j-1, k ) );
-            }
+        unsigned int k=0 ;
+        for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
+            ( *Bz3D )( i, j, k ) += -dt_ov_dx * ( ( *Ey3D )( i, j, k ) - ( *Ey3D )( i-1, j, k ) ) + dt_ov_dy * ( ( *Ex3D )( i, j, k ) - ( *Ex3D )( i, j-1, k ) );
         }
     }
     
     if( EM3D->isZmax ) {
         //At Zmax
         // Magnetic field Bz^(d,d,p)
-        for( unsigned int i=2 ; i<nx_d-2 ; i++ ) { //Cases i=1 and i=nx_d-2 are treated later for all required j and k
-            unsigned int k=nz_p-1 ;
-            for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
-                ( *Bz3D )( i, j, k ) += -dt_ov_dx * ( ( *Ey3D )( i, j, k ) - ( *Ey3D )( i-1, j, k ) ) + dt_ov_dy * ( ( *Ex3D )( i, j, k ) - ( *Ex3D )( i, j-1, k ) );
-            }
+        unsigned int k=nz_p-1 ;
+        for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
+            ( *Bz3D )( i, j, k ) += -dt_ov_dx * ( ( *Ey3D )( i, j, k ) - ( *Ey3D )( i-1, j, k ) ) + dt_ov_dy * ( ( *Ex3D )( i, j, k ) - ( *Ex3D )( i, j-1, k ) );
         }
     }
     
-    
-    
-    
-    
-    
-    
-    
-}//END solveMaxwellFaraday
-
-
+}
 
@@ -18,6 +18,15 @@ public:
     //! Overloading of () operator
     virtual void operator()( ElectroMagn *fields );
     
+    //! Update of the x-plane i (all rows : the stencil reaches j+1)
+    void plane( ElectroMagn *fields, unsigned int i ) override;
+    
+    //! The stencil reaches the plane i+1
+    unsigned int planeLag() override
+    {
+        return 1;
+    };
+    
     // Parameters for the Maxwell-Faraday solver
     double dx;
     double dy;
@@ -18,6 +18,9 @@ public:
     //! Overloading of () operator
     virtual void operator()( ElectroMagn *fields );
     
+    //! Update of the x-plane i
+    void plane( ElectroMagn *fields, unsigned int i ) override;
+    
 protected:
 
 };//END class
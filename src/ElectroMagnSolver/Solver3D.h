@@ -39,6 +39,15 @@ public:
     //! Overloading of () operator
     virtual void operator()( ElectroMagn *fields ) = 0;
     
+    //! Update of the x-plane i only (used by MA_MF_Solver3D_fused)
+    virtual void plane( ElectroMagn *fields, unsigned int i ) {};
+    
+    //! Number of x-planes ahead of the plane i read by plane()
+    virtual unsigned int planeLag()
+    {
+        return 0;
+    };
+    
 protected:
     unsigned int nx_p;
     unsigned int nx_d;
@@ -17,6 +17,7 @@
 #include "MF_Solver2D_Cowan.h"
 #include "MF_Solver2D_Lehe.h"
 #include "MF_Solver3D_Lehe.h"
+#include "MA_MF_Solver3D_fused.h"
 
 #include "PXR_Solver2D_GPSTD.h"
 #include "PXR_Solver3D_FDTD.h"
@@ -62,6 +63,9 @@ public:
             } else {
                 if( params.is_pxr ) {
                     solver = new PXR_Solver3D_FDTD( params );
+                } else if( params.fused_maxwell_solver ) {
+                    // Also solves Maxwell-Faraday
+                    solver = new MA_MF_Solver3D_fused( params );
                 } else {
                     solver = new MA_Solver3D_norm( params );
                 }
@@ -118,7 +122,10 @@ public:
             
         } else if( params.geometry == "3Dcartesian" ) {
             
-            if( params.maxwell_sol == "Yee" ) {
+            if( params.fused_maxwell_solver ) {
+                // Solved together with Maxwell-Ampere
+                solver = new NullSolver( params );
+            } else if( params.maxwell_sol == "Yee" ) {
                 solver = new MF_Solver3D_Yee( params );
             } else if( params.maxwell_sol == "Lehe" ) {
                 solver = new MF_Solver3D_Lehe( params );
@@ -83,10 +83,6 @@ Field3D::~Field3D()
     }
     if( data_!=NULL ) {
         delete [] data_;
-        for( unsigned int i=0; i<dims_[0]; i++ ) {
-            delete [] this->data_3D[i];
-        }
-        delete [] this->data_3D;
     }
 }
 
@@ -105,35 +101,19 @@ void Field3D::allocateDims()
     
     isDual_.resize( dims_.size(), 0 );
     
-    data_ = new double[dims_[0]*dims_[1]*dims_[2]];
-    //! \todo{check row major order!!!}
-    data_3D= new double **[dims_[0]];
-    for( unsigned int i=0; i<dims_[0]; i++ ) {
-        data_3D[i]= new double*[dims_[1]];
-        for( unsigned int j=0; j<dims_[1]; j++ ) {
-            data_3D[i][j] = data_ + i*dims_[1]*dims_[2] + j*dims_[2];
-            for( unsigned int k=0; k<dims_[2]; k++ ) {
-                this->data_3D[i][j][k] = 0.0;
-            }
-        }
-    }//i
-    
     globalDims_ = dims_[0]*dims_[1]*dims_[2];
     
+    data_ = new double[globalDims_];
+    memset( data_, 0, globalDims_*sizeof( double ) );
+    
 }
 
 void Field3D::deallocateDataAndSetTo( Field* f )
 {
     delete [] data_;
     data_ = NULL;
-    for( unsigned int i=0; i<dims_[0]; i++ ) {
-        delete [] data_3D[i];
-    }
-    delete [] data_3D;
-    data_3D = NULL;
 
     data_   = f->data_;
-    data_3D = (static_cast<Field3D *>(f))->data_3D;
     
 }
 
@@ -174,21 +154,11 @@ void Field3D::allocateDims( unsigned int mainDim, bool isPrimal )
         dims_[j] += isDual_[j];
     }
     
-    data_ = new double[dims_[0]*dims_[1]*dims_[2]];
-    //! \todo{check row major order!!!}
-    data_3D= new double **[dims_[0]*dims_[1]];
-    for( unsigned int i=0; i<dims_[0]; i++ ) {
-        data_3D[i]= new double*[dims_[1]];
-        for( unsigned int j=0; j<dims_[1]; j++ ) {
-            this->data_3D[i][j] = data_ + i*dims_[1]*dims_[2] + j*dims_[2];
-            for( unsigned int k=0; k<dims_[2]; k++ ) {
-                this->data_3D[i][j][k] = 0.0;
-            }
-        }
-    }//i
-    
     globalDims_ = dims_[0]*dims_[1]*dims_[2];
     
+    data_ = new double[globalDims_];
+    memset( data_, 0, globalDims_*sizeof( double ) );
+    
     //isDual_ = isPrimal;
 }
 
@@ -199,8 +169,8 @@ void Field3D::allocateDims( unsigned int mainDim, bool isPrimal )
 // ---------------------------------------------------------------------------------------------------------------------
 void Field3D::shift_x( unsigned int delta )
 {
-    memmove( &( data_3D[0][0][0] ), &( data_3D[delta][0][0] ), ( dims_[2]*dims_[1]*dims_[0]-delta*dims_[2]*dims_[1] )*sizeof( double ) );
-    memset( &( data_3D[dims_[0]-delta][0][0] ), 0, delta*dims_[1]*dims_[2]*sizeof( double ) );
+    memmove( &( data_[0] ), &( data_[delta*dims_[1]*dims_[2]] ), ( dims_[2]*dims_[1]*dims_[0]-delta*dims_[2]*dims_[1] )*sizeof( double ) );
+    memset( &( data_[( dims_[0]-delta )*dims_[1]*dims_[2]] ), 0, delta*dims_[1]*dims_[2]*sizeof( double ) );
     
 }
 
@@ -218,7 +188,7 @@ double Field3D::norm2( unsigned int istart[3][2], unsigned int bufsize[3][2] )
     for( int i=idxlocalstart[0] ; i<idxlocalend[0] ; i++ ) {
         for( int j=idxlocalstart[1] ; j<idxlocalend[1] ; j++ ) {
             for( int k=idxlocalstart[2] ; k<idxlocalend[2] ; k++ ) {
-                nrj += data_3D[i][j][k]*data_3D[i][j][k];
+                nrj += ( *this )( i, j, k )*( *this )( i, j, k );
             }
         }
     }
@@ -364,10 +334,15 @@ void Field3D::extract_fields_exch( int iDim, int iNeighbor, int ghost_size )
 
     double* sub = sendFields_[iDim*2+iNeighbor]->data_;
     double* field = data_;
-    for( unsigned int i=0; i<(unsigned int)NX; i++ ) {
-        for( unsigned int j=0; j<(unsigned int)NY; j++ ) {
-            for( unsigned int k=0; k<(unsigned int)NZ; k++ ) {
-                sub[i*NY*NZ+j*NZ+k] = field[ (ix+i)*dimY*dimZ+(iy+j)*dimZ+(iz+k) ];
+    // Contiguous runs along z (whole yz slabs when the sub-field spans z)
+    if( NZ == dimZ ) {
+        for( unsigned int i=0; i<(unsigned int)NX; i++ ) {
+            memcpy( &sub[i*NY*NZ], &field[ (ix+i)*dimY*dimZ+iy*dimZ ], NY*NZ*sizeof( double ) );
+        }
+    } else {
+        for( unsigned int i=0; i<(unsigned int)NX; i++ ) {
+            for( unsigned int j=0; j<(unsigned int)NY; j++ ) {
+                memcpy( &sub[i*NY*NZ+j*NZ], &field[ (ix+i)*dimY*dimZ+(iy+j)*dimZ+iz ], NZ*sizeof( double ) );
             }
         }
     }
@@ -394,10 +369,15 @@ void Field3D::inject_fields_exch ( int iDim, int iNeighbor, int ghost_size )
 
     double* sub = recvFields_[iDim*2+(iNeighbor+1)%2]->data_;
     double* field = data_;
-    for( unsigned int i=0; i<(unsigned int)NX; i++ ) {
-        for( unsigned int j=0; j<(unsigned int)NY; j++ ) {
-            for( unsigned int k=0; k<(unsigned int)NZ; k++ ) {
-                field[ (ix+i)*dimY*dimZ+(iy+j)*dimZ+(iz+k) ] = sub[i*NY*NZ+j*NZ+k];
+    // Contiguous runs along z (whole yz slabs when the sub-field spans z)
+    if( NZ == dimZ ) {
+        for( unsigned int i=0; i<(unsigned int)NX; i++ ) {
+            memcpy( &field[ (ix+i)*dimY*dimZ+iy*dimZ ], &sub[i*NY*NZ], NY*NZ*sizeof( double ) );
+        }
+    } else {
+        for( unsigned int i=0; i<(unsigned int)NX; i++ ) {
+            for( unsigned int j=0; j<(unsigned int)NY; j++ ) {
+                memcpy( &field[ (ix+i)*dimY*dimZ+(iy+j)*dimZ+iz ], &sub[i*NY*NZ+j*NZ], NZ*sizeof( double ) );
             }
         }
     }
@@ -424,10 +404,15 @@ void Field3D::extract_fields_sum ( int iDim, int iNeighbor, int ghost_size )
 
     double* sub = sendFields_[iDim*2+iNeighbor]->data_;
     double* field = data_;
-    for( unsigned int i=0; i<(unsigned int)NX; i++ ) {
-        for( unsigned int j=0; j<(unsigned int)NY; j++ ) {
-            for( unsigned int k=0; k<(unsigned int)NZ; k++ ) {
-                sub[i*NY*NZ+j*NZ+k] = field[ (ix+i)*dimY*dimZ+(iy+j)*dimZ+(iz+k) ];
+    // Contiguous runs along z (whole yz slabs when the sub-field spans z)
+    if( NZ == dimZ ) {
+        for( unsigned int i=0; i<(unsigned int)NX; i++ ) {
+            memcpy( &sub[i*NY*NZ], &field[ (ix+i)*dimY*dimZ+iy*dimZ ], NY*NZ*sizeof( double ) );
+        }
+    } else {
+        for( unsigned int i=0; i<(unsigned int)NX; i++ ) {
+            for( unsigned int j=0; j<(unsigned int)NY; j++ ) {
+                memcpy( &sub[i*NY*NZ+j*NZ], &field[ (ix+i)*dimY*dimZ+(iy+j)*dimZ+iz ], NZ*sizeof( double ) );
             }
         }
     }
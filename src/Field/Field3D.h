@@ -59,10 +59,11 @@ public:
     virtual void shift_x( unsigned int delta ) override;
     
     //! Overloading of the () operator allowing to set a new value for the (i,j,k) element of a Field3D
+    //! (row major, k contiguous, plain index arithmetic on data_)
     inline double &operator()( unsigned int i, unsigned int j, unsigned int k )
     {
         DEBUGEXEC( if( i>=dims_[0] || j>=dims_[1] || k >= dims_[2] ) ERROR( name << "Out of limits & "<< i << " " << j << " " << k ) );
-        return data_3D[i][j][k];
+        return data_[( i*dims_[1] + j )*dims_[2] + k];
     };
     
     /*inline double& operator () (unsigned int i)
@@ -76,7 +77,13 @@ public:
     inline double operator()( unsigned int i, unsigned int j, unsigned int k ) const
     {
         DEBUGEXEC( if( i>=dims_[0] || j>=dims_[1] || k >= dims_[2] ) ERROR( name << "Out of limits "<< i << " " << j << " " << k ) );
-        return data_3D[i][j][k];
+        return data_[( i*dims_[1] + j )*dims_[2] + k];
+    };
+    
+    //! Linear index of the (i,j,k) element in data_
+    inline unsigned int index( unsigned int i, unsigned int j, unsigned int k ) const
+    {
+        return ( i*dims_[1] + j )*dims_[2] + k;
     };
     
     /*inline double operator () (unsigned int i) const {
@@ -95,11 +102,6 @@ public:
     void add( Field *outField, Params &params, SmileiMPI *smpi, Patch *thisPatch, Patch *outPatch ) override;
     void get( Field  *inField, Params &params, SmileiMPI *smpi, Patch   *inPatch, Patch *thisPatch ) override;
     
-    //!\todo{Comment what are these stuffs (MG for JD)}
-    //double *data_3D;
-    //! this will present the data as a 3d matrix
-    double ***data_3D;
-
     void create_sub_fields  ( int iDim, int iNeighbor, int ghost_size ) override;
     void extract_fields_exch( int iDim, int iNeighbor, int ghost_size ) override;
     void inject_fields_exch ( int iDim, int iNeighbor, int ghost_size ) override;
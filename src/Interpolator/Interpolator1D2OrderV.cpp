@@ -0,0 +1,211 @@
+#include "Interpolator1D2OrderV.h"
+
+#include <cmath>
+#include <iostream>
+
+#include "ElectroMagn.h"
+#include "Field1D.h"
+#include "Particles.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Creator for Interpolator1D2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+Interpolator1D2OrderV::Interpolator1D2OrderV( Params &params, Patch *patch ) : Interpolator1D( params, patch )
+{
+    dx_inv_ = 1.0/params.cell_length[0];
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// 2nd Order Interpolation of the fields at a the particle position (3 nodes are used), one particle at a time
+// ---------------------------------------------------------------------------------------------------------------------
+void Interpolator1D2OrderV::fields( ElectroMagn *EMfields, Particles &particles, int ipart, int nparts, double *ELoc, double *BLoc )
+{
+    Field1D *Ex1D     = static_cast<Field1D *>( EMfields->Ex_ );
+    Field1D *Ey1D     = static_cast<Field1D *>( EMfields->Ey_ );
+    Field1D *Ez1D     = static_cast<Field1D *>( EMfields->Ez_ );
+    Field1D *Bx1D_m   = static_cast<Field1D *>( EMfields->Bx_m );
+    Field1D *By1D_m   = static_cast<Field1D *>( EMfields->By_m );
+    Field1D *Bz1D_m   = static_cast<Field1D *>( EMfields->Bz_m );
+
+    coeffs( particles.position( 0, ipart )*dx_inv_ );
+
+    // Interpolate the fields from the Dual grid : Ex, By, Bz
+    *( ELoc+0*nparts ) = compute( coeffd_, Ex1D,   id_ );
+    *( BLoc+1*nparts ) = compute( coeffd_, By1D_m, id_ );
+    *( BLoc+2*nparts ) = compute( coeffd_, Bz1D_m, id_ );
+
+    // Interpolate the fields from the Primal grid : Ey, Ez, Bx
+    *( ELoc+1*nparts ) = compute( coeffp_, Ey1D,   ip_ );
+    *( ELoc+2*nparts ) = compute( coeffp_, Ez1D,   ip_ );
+    *( BLoc+0*nparts ) = compute( coeffp_, Bx1D_m, ip_ );
+}
+
+void Interpolator1D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    int nparts( ( smpi->dynamics_invgf[ithread] ).size() );
+    fieldsInBuffers( EMfields, particles, smpi, istart, iend, ithread, ipart_ref,
+                     &( smpi->dynamics_Epart[ithread][0] ), &( smpi->dynamics_Bpart[ithread][0] ), nparts, ipart_ref );
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Vectorized interpolation of the fields for all the particles of a cell
+// All the particles of the cell share the same primal index, the dual index is either the same or the next one
+// ---------------------------------------------------------------------------------------------------------------------
+void Interpolator1D2OrderV::fieldsInBuffers( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref,
+        double *Ebuffer, double *Bbuffer, int nbuffer, int ibuffer_ref )
+{
+    if( istart[0] == iend[0] ) {
+        return;    //Don't treat empty cells.
+    }
+
+    int nparts( ( smpi->dynamics_invgf[ithread] ).size() );
+
+    double *Epart[3], *Bpart[3];
+    double *deltaO = &( smpi->dynamics_deltaold[ithread][0] );
+
+    for( unsigned int k=0; k<3; k++ ) {
+        Epart[k]= Ebuffer + k*nbuffer + ipart_ref - ibuffer_ref;
+        Bpart[k]= Bbuffer + k*nbuffer + ipart_ref - ibuffer_ref;
+    }
+
+    //Primal index is constant over the all cell
+    int idx  = round( particles.position( 0, *istart ) * dx_inv_ );
+    int idxO = idx - ( int )index_domain_begin -1 ;
+
+    Field1D *Ex1D = static_cast<Field1D *>( EMfields->Ex_ );
+    Field1D *Ey1D = static_cast<Field1D *>( EMfields->Ey_ );
+    Field1D *Ez1D = static_cast<Field1D *>( EMfields->Ez_ );
+    Field1D *Bx1D = static_cast<Field1D *>( EMfields->Bx_m );
+    Field1D *By1D = static_cast<Field1D *>( EMfields->By_m );
+    Field1D *Bz1D = static_cast<Field1D *>( EMfields->Bz_m );
+
+    double coeff[2][3][32];
+    int dual[32]; // Boolean indicating if the part has a dual indice equal to the primal one (dual=0) or if it is +1 (dual=1).
+
+    int vecSize = 32;
+
+    int cell_nparts( ( int )iend[0]-( int )istart[0] );
+
+    for( int ivect=0 ; ivect < cell_nparts; ivect += vecSize ) {
+
+        int np_computed = min( cell_nparts-ivect, vecSize );
+
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+
+            double delta0 = particles.position( 0, ipart+ivect+istart[0] )*dx_inv_;
+            dual[ipart] = ( delta0 - ( double )idx >=0. );
+
+            for( int j=0; j<2; j++ ) { // for dual
+
+                double delta  = delta0 - ( double )idx + ( double )j*( 0.5-dual[ipart] );
+                double delta2 = delta*delta;
+
+                coeff[j][0][ipart] =  0.5 * ( delta2-delta+0.25 );
+                coeff[j][1][ipart] = ( 0.75 - delta2 );
+                coeff[j][2][ipart] =  0.5 * ( delta2+delta+0.25 );
+
+                if( j==0 ) {
+                    deltaO[ipart-ipart_ref+ivect+istart[0]] = delta;
+                }
+            }
+        }
+
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+
+            double *coeffp = &( coeff[0][1][ipart] );
+            double *coeffd = &( coeff[1][1][ipart] );
+
+            double Ex = 0., Ey = 0., Ez = 0.;
+            double Bx = 0., By = 0., Bz = 0.;
+            for( int iloc=-1 ; iloc<2 ; iloc++ ) {
+                // Ex, By, Bz (dual)
+                Ex += *( coeffd+iloc*32 ) * ( ( 1-dual[ipart] )*( *Ex1D )( idxO+1+iloc ) + dual[ipart]*( *Ex1D )( idxO+2+iloc ) );
+                By += *( coeffd+iloc*32 ) * ( ( 1-dual[ipart] )*( *By1D )( idxO+1+iloc ) + dual[ipart]*( *By1D )( idxO+2+iloc ) );
+                Bz += *( coeffd+iloc*32 ) * ( ( 1-dual[ipart] )*( *Bz1D )( idxO+1+iloc ) + dual[ipart]*( *Bz1D )( idxO+2+iloc ) );
+                // Ey, Ez, Bx (primal)
+                Ey += *( coeffp+iloc*32 ) * ( *Ey1D )( idxO+1+iloc );
+                Ez += *( coeffp+iloc*32 ) * ( *Ez1D )( idxO+1+iloc );
+                Bx += *( coeffp+iloc*32 ) * ( *Bx1D )( idxO+1+iloc );
+            }
+            Epart[0][ipart-ipart_ref+ivect+istart[0]] = Ex;
+            Epart[1][ipart-ipart_ref+ivect+istart[0]] = Ey;
+            Epart[2][ipart-ipart_ref+ivect+istart[0]] = Ez;
+            Bpart[0][ipart-ipart_ref+ivect+istart[0]] = Bx;
+            Bpart[1][ipart-ipart_ref+ivect+istart[0]] = By;
+            Bpart[2][ipart-ipart_ref+ivect+istart[0]] = Bz;
+        }
+    }
+
+} // END Interpolator1D2OrderV
+
+void Interpolator1D2OrderV::fieldsAndCurrents( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, LocalFields *JLoc, double *RhoLoc )
+{
+    int ipart = *istart;
+
+    double *ELoc = &( smpi->dynamics_Epart[ithread][ipart] );
+    double *BLoc = &( smpi->dynamics_Bpart[ithread][ipart] );
+
+    Field1D *Jx1D     = static_cast<Field1D *>( EMfields->Jx_ );
+    Field1D *Jy1D     = static_cast<Field1D *>( EMfields->Jy_ );
+    Field1D *Jz1D     = static_cast<Field1D *>( EMfields->Jz_ );
+    Field1D *Rho1D    = static_cast<Field1D *>( EMfields->rho_ );
+
+    int nparts( particles.size() );
+    fields( EMfields, particles, ipart, nparts, ELoc, BLoc );
+
+    // Interpolate the fields from the Primal grid : Jy, Jz, Rho
+    JLoc->y = compute( coeffp_, Jy1D,  ip_ );
+    JLoc->z = compute( coeffp_, Jz1D,  ip_ );
+    ( *RhoLoc ) = compute( coeffp_, Rho1D, ip_ );
+
+    // Interpolate the fields from the Dual grid : Jx
+    JLoc->x = compute( coeffd_, Jx1D,  id_ );
+}
+
+// Interpolator specific to tracked particles. A selection of particles may be provided
+void Interpolator1D2OrderV::fieldsSelection( ElectroMagn *EMfields, Particles &particles, double *buffer, int offset, vector<unsigned int> *selection )
+{
+    if( selection ) {
+
+        int nsel_tot = selection->size();
+        for( int isel=0 ; isel<nsel_tot; isel++ ) {
+            fields( EMfields, particles, ( *selection )[isel], offset, buffer+isel, buffer+isel+3*offset );
+        }
+
+    } else {
+
+        int npart_tot = particles.size();
+        for( int ipart=0 ; ipart<npart_tot; ipart++ ) {
+            fields( EMfields, particles, ipart, offset, buffer+ipart, buffer+ipart+3*offset );
+        }
+
+    }
+}
+
+// Interpolator on another field than the basic ones
+void Interpolator1D2OrderV::oneField( Field **field, Particles &particles, int *istart, int *iend, double *FieldLoc, double *l1, double *l2, double *l3 )
+{
+    ERROR( "Single field 1D2O interpolator not available in vectorized mode" );
+}
+
+void Interpolator1D2OrderV::fieldsAndEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    ERROR( "Vectorized interpolation for the envelope model is not implemented for 1D geometry" );
+}
+
+
+void Interpolator1D2OrderV::timeCenteredEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    ERROR( "Vectorized interpolation for the envelope model is not implemented for 1D geometry" );
+}
+
+
+void Interpolator1D2OrderV::envelopeAndSusceptibility( ElectroMagn *EMfields, Particles &particles, int ipart, double *Env_A_abs_Loc, double *Env_Chi_Loc, double *Env_E_abs_Loc, double *Env_Ex_abs_Loc )
+{
+    ERROR( "Vectorized interpolation for the envelope model is not implemented for 1D geometry" );
+}
@@ -0,0 +1,78 @@
+#ifndef INTERPOLATOR1D2ORDERV_H
+#define INTERPOLATOR1D2ORDERV_H
+
+
+#include "Interpolator1D.h"
+#include "Field1D.h"
+
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class for vectorized 2nd order interpolator for 1Dcartesian simulations
+//  --------------------------------------------------------------------------------------------------------------------
+class Interpolator1D2OrderV final : public Interpolator1D
+{
+
+public:
+    Interpolator1D2OrderV( Params &, Patch * );
+    ~Interpolator1D2OrderV() override final {};
+
+    inline void fields( ElectroMagn *EMfields, Particles &particles, int ipart, int nparts, double *ELoc, double *BLoc );
+    void fieldsAndCurrents( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, LocalFields *JLoc, double *RhoLoc ) override final;
+    void fieldsWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final;
+    //! Same as fieldsWrapper, but E and B of the particle ipart go to Ebuffer[k*nbuffer+ipart-ibuffer_ref] and Bbuffer
+    void fieldsInBuffers( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref,
+                          double *Ebuffer, double *Bbuffer, int nbuffer, int ibuffer_ref );
+    void fieldsSelection( ElectroMagn *EMfields, Particles &particles, double *buffer, int offset, std::vector<unsigned int> *selection ) override final;
+    void oneField( Field **field, Particles &particles, int *istart, int *iend, double *FieldLoc, double *l1=NULL, double *l2=NULL, double *l3=NULL ) override final;
+
+    inline double compute( double *coeff, Field1D *f, int idx )
+    {
+        double interp_res =  coeff[0] * ( *f )( idx-1 )   + coeff[1] * ( *f )( idx )   + coeff[2] * ( *f )( idx+1 );
+        return interp_res;
+    };
+
+    void fieldsAndEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final;
+    void timeCenteredEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final;
+    void envelopeAndSusceptibility( ElectroMagn *EMfields, Particles &particles, int ipart, double *Env_A_abs_Loc, double *Env_Chi_Loc, double *Env_E_abs_Loc, double *Env_Ex_abs_Loc ) override final;
+
+private:
+    //! Scalar coefficients, used for probes and tracked particles
+    inline void coeffs( double xjn )
+    {
+        double xjmxi, xjmxi2;
+
+        // Dual
+        id_    = round( xjn+0.5 );
+        xjmxi  = xjn - ( double )id_ +0.5;
+        xjmxi2 = xjmxi*xjmxi;
+
+        coeffd_[0] = 0.5 * ( xjmxi2-xjmxi+0.25 );
+        coeffd_[1] = ( 0.75-xjmxi2 );
+        coeffd_[2] = 0.5 * ( xjmxi2+xjmxi+0.25 );
+
+        id_ -= index_domain_begin;
+
+        // Primal
+        ip_    = round( xjn );
+        xjmxi  = xjn -( double )ip_;
+        xjmxi2 = xjmxi*xjmxi;
+
+        coeffp_[0] = 0.5 * ( xjmxi2-xjmxi+0.25 );
+        coeffp_[1] = ( 0.75-xjmxi2 );
+        coeffp_[2] = 0.5 * ( xjmxi2+xjmxi+0.25 );
+
+        ip_ -= index_domain_begin;
+    }
+
+    // Last prim index computed
+    int ip_;
+    // Last dual index computed
+    int id_;
+    // Interpolation coefficient on Prim grid
+    double coeffp_[3];
+    // Interpolation coefficient on Dual grid
+    double coeffd_[3];
+
+};//END class
+
+#endif
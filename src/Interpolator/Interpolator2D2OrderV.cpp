@@ -31,6 +31,14 @@ void Interpolator2D2OrderV::fields( ElectroMagn *EMfields, Particles &particles,
 }
 
 void Interpolator2D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    int nparts( ( smpi->dynamics_invgf[ithread] ).size() );
+    fieldsInBuffers( EMfields, particles, smpi, istart, iend, ithread, ipart_ref,
+                     &( smpi->dynamics_Epart[ithread][0] ), &( smpi->dynamics_Bpart[ithread][0] ), nparts, ipart_ref );
+}
+
+void Interpolator2D2OrderV::fieldsInBuffers( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref,
+        double *Ebuffer, double *Bbuffer, int nbuffer, int ibuffer_ref )
 {
     if( istart[0] == iend[0] ) {
         return;    //Don't treat empty cells.
@@ -45,8 +53,8 @@ void Interpolator2D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
     deltaO[1] = &( smpi->dynamics_deltaold[ithread][nparts] );
     
     for( unsigned int k=0; k<3; k++ ) {
-        Epart[k]= &( smpi->dynamics_Epart[ithread][k*nparts] );
-        Bpart[k]= &( smpi->dynamics_Bpart[ithread][k*nparts] );
+        Epart[k]= Ebuffer + k*nbuffer + ipart_ref - ibuffer_ref;
+        Bpart[k]= Bbuffer + k*nbuffer + ipart_ref - ibuffer_ref;
     }
     
     int idx[2], idxO[2];
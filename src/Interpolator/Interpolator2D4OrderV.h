@@ -0,0 +1,44 @@
+#ifndef INTERPOLATOR2D4ORDERV_H
+#define INTERPOLATOR2D4ORDERV_H
+
+
+#include "Interpolator2D.h"
+#include "Field2D.h"
+
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class for vectorized 4th order interpolator for 2Dcartesian simulations
+//  --------------------------------------------------------------------------------------------------------------------
+class Interpolator2D4OrderV final : public Interpolator2D
+{
+
+public:
+    Interpolator2D4OrderV( Params &, Patch * );
+    ~Interpolator2D4OrderV() override final {};
+    
+    inline void fields( ElectroMagn *EMfields, Particles &particles, int ipart, double *ELoc, double *BLoc );
+    void fieldsAndCurrents( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, LocalFields *JLoc, double *RhoLoc ) override final ;
+    void fieldsWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final;
+    void fieldsSelection( ElectroMagn *EMfields, Particles &particles, double *buffer, int offset, std::vector<unsigned int> *selection ) override final {};
+    void oneField( Field **field, Particles &particles, int *istart, int *iend, double *FieldLoc, double *l1=NULL, double *l2=NULL, double *l3=NULL ) override final;
+    
+    void fieldsAndEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final;
+    void timeCenteredEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final;
+    void envelopeAndSusceptibility( ElectroMagn *EMfields, Particles &particles, int ipart, double *Env_A_abs_Loc, double *Env_Chi_Loc, double *Env_E_abs_Loc, double *Env_Ex_abs_Loc ) override final;
+    
+private:
+    double dble_1_ov_384 ;
+    double dble_1_ov_48 ;
+    double dble_1_ov_16 ;
+    double dble_1_ov_12 ;
+    double dble_1_ov_24 ;
+    double dble_19_ov_96 ;
+    double dble_11_ov_24 ;
+    double dble_1_ov_4 ;
+    double dble_1_ov_6 ;
+    double dble_115_ov_192 ;
+    double dble_5_ov_8 ;
+    
+};//END class
+
+#endif
@@ -32,7 +32,28 @@ void Interpolator3D2OrderV::fields( ElectroMagn *EMfields, Particles &particles,
 {
 }
 
+// Copy the ni x nj x nk points of field starting at idxO-1 in a contiguous 4x4x4 tile
+static inline void loadTile( Field3D *field, int *idxO, int ni, int nj, int nk, double *tile )
+{
+    for( int i=0 ; i<ni ; i++ ) {
+        for( int j=0 ; j<nj ; j++ ) {
+            double *row = &( *field )( idxO[0]-1+i, idxO[1]-1+j, idxO[2]-1 );
+            for( int k=0 ; k<nk ; k++ ) {
+                tile[i*16+j*4+k] = row[k];
+            }
+        }
+    }
+}
+
 void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    int nparts( ( smpi->dynamics_invgf[ithread] ).size() );
+    fieldsInBuffers( EMfields, particles, smpi, istart, iend, ithread, ipart_ref,
+                     &( smpi->dynamics_Epart[ithread][0] ), &( smpi->dynamics_Bpart[ithread][0] ), nparts, ipart_ref );
+}
+
+void Interpolator3D2OrderV::fieldsInBuffers( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref,
+        double *Ebuffer, double *Bbuffer, int nbuffer, int ibuffer_ref )
 {
     if( istart[0] == iend[0] ) {
         return;    //Don't treat empty cells.
@@ -55,6 +76,16 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
     Field3D *By3D = static_cast<Field3D *>( EMfields->By_m );
     Field3D *Bz3D = static_cast<Field3D *>( EMfields->Bz_m );
     
+    // Fields around the cell, loaded once for all its particles
+    //   tile[(i+1)*16+(j+1)*4+k+1] = field(idxO+(i,j,k)), with 3 points along primal directions, 4 along dual ones
+    double Extile[64], Eytile[64], Eztile[64], Bxtile[64], Bytile[64], Bztile[64];
+    loadTile( Ex3D, idxO, 4, 3, 3, Extile );
+    loadTile( Ey3D, idxO, 3, 4, 3, Eytile );
+    loadTile( Ez3D, idxO, 3, 3, 4, Eztile );
+    loadTile( Bx3D, idxO, 3, 4, 4, Bxtile );
+    loadTile( By3D, idxO, 4, 3, 4, Bytile );
+    loadTile( Bz3D, idxO, 4, 4, 3, Bztile );
+    
     int nparts( ( smpi->dynamics_invgf[ithread] ).size() );
     
     double *Epart[3], *Bpart[3];
@@ -88,8 +119,8 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
         deltaO[2] = &( smpi->dynamics_deltaold[ithread][2*nparts + ivect + istart[0] - ipart_ref] );
         
         for( unsigned int k=0; k<3; k++ ) {
-            Epart[k]= &( smpi->dynamics_Epart[ithread][k*nparts-ipart_ref+ivect+istart[0]] );
-            Bpart[k]= &( smpi->dynamics_Bpart[ithread][k*nparts-ipart_ref+ivect+istart[0]] );
+            Epart[k]= &( Ebuffer[k*nbuffer-ibuffer_ref+ivect+istart[0]] );
+            Bpart[k]= &( Bbuffer[k*nbuffer-ibuffer_ref+ivect+istart[0]] );
         }
         
         #pragma omp simd
@@ -135,7 +166,7 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
                 for( int jloc=-1 ; jloc<2 ; jloc++ ) {
                     for( int kloc=-1 ; kloc<2 ; kloc++ ) {
                         interp_res += *( coeffxd+iloc*32 ) * *( coeffyp+jloc*32 ) * *( coeffzp+kloc*32 ) *
-                                      ( ( 1-dual[0][ipart] )*( *Ex3D )( idxO[0]+iloc, idxO[1]+jloc, idxO[2]+kloc ) + dual[0][ipart]*( *Ex3D )( idxO[0]+1+iloc, idxO[1]+jloc, idxO[2]+kloc ) );
+                                      ( ( 1-dual[0][ipart] )*Extile[( 1+iloc )*16+( 1+jloc )*4+1+kloc] + dual[0][ipart]*Extile[( 2+iloc )*16+( 1+jloc )*4+1+kloc] );
                     }
                 }
             }
@@ -147,7 +178,7 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
                 for( int jloc=-1 ; jloc<2 ; jloc++ ) {
                     for( int kloc=-1 ; kloc<2 ; kloc++ ) {
                         interp_res += *( coeffxp+iloc*32 ) * *( coeffyd+jloc*32 ) * *( coeffzp+kloc*32 ) *
-                                      ( ( 1-dual[1][ipart] )*( *Ey3D )( idxO[0]+iloc, idxO[1]+jloc, idxO[2]+kloc ) + dual[1][ipart]*( *Ey3D )( idxO[0]+iloc, idxO[1]+1+jloc, idxO[2]+kloc ) );
+                                      ( ( 1-dual[1][ipart] )*Eytile[( 1+iloc )*16+( 1+jloc )*4+1+kloc] + dual[1][ipart]*Eytile[( 1+iloc )*16+( 2+jloc )*4+1+kloc] );
                     }
                 }
             }
@@ -160,7 +191,7 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
                 for( int jloc=-1 ; jloc<2 ; jloc++ ) {
                     for( int kloc=-1 ; kloc<2 ; kloc++ ) {
                         interp_res += *( coeffxp+iloc*32 ) * *( coeffyp+jloc*32 ) * *( coeffzd+kloc*32 ) *
-                                      ( ( 1-dual[2][ipart] )*( *Ez3D )( idxO[0]+iloc, idxO[1]+jloc, idxO[2]+kloc ) + dual[2][ipart]*( *Ez3D )( idxO[0]+iloc, idxO[1]+jloc, idxO[2]+1+kloc ) );
+                                      ( ( 1-dual[2][ipart] )*Eztile[( 1+iloc )*16+( 1+jloc )*4+1+kloc] + dual[2][ipart]*Eztile[( 1+iloc )*16+( 1+jloc )*4+2+kloc] );
                     }
                 }
             }
@@ -173,8 +204,8 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
                 for( int jloc=-1 ; jloc<2 ; jloc++ ) {
                     for( int kloc=-1 ; kloc<2 ; kloc++ ) {
                         interp_res += *( coeffxp+iloc*32 ) * *( coeffyd+jloc*32 ) * *( coeffzd+kloc*32 ) *
-                                      ( ( 1-dual[2][ipart] ) * ( ( 1-dual[1][ipart] )*( *Bx3D )( idxO[0]+iloc, idxO[1]+jloc, idxO[2]+kloc ) + dual[1][ipart]*( *Bx3D )( idxO[0]+iloc, idxO[1]+1+jloc, idxO[2]+kloc ) )
-                                        +    dual[2][ipart]  * ( ( 1-dual[1][ipart] )*( *Bx3D )( idxO[0]+iloc, idxO[1]+jloc, idxO[2]+1+kloc ) + dual[1][ipart]*( *Bx3D )( idxO[0]+iloc, idxO[1]+1+jloc, idxO[2]+1+kloc ) ) );
+                                      ( ( 1-dual[2][ipart] ) * ( ( 1-dual[1][ipart] )*Bxtile[( 1+iloc )*16+( 1+jloc )*4+1+kloc] + dual[1][ipart]*Bxtile[( 1+iloc )*16+( 2+jloc )*4+1+kloc] )
+                                        +    dual[2][ipart]  * ( ( 1-dual[1][ipart] )*Bxtile[( 1+iloc )*16+( 1+jloc )*4+2+kloc] + dual[1][ipart]*Bxtile[( 1+iloc )*16+( 2+jloc )*4+2+kloc] ) );
                     }
                 }
             }
@@ -186,8 +217,8 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
                 for( int jloc=-1 ; jloc<2 ; jloc++ ) {
                     for( int kloc=-1 ; kloc<2 ; kloc++ ) {
                         interp_res += *( coeffxd+iloc*32 ) * *( coeffyp+jloc*32 ) * *( coeffzd+kloc*32 ) *
-                                      ( ( 1-dual[2][ipart] ) * ( ( 1-dual[0][ipart] )*( *By3D )( idxO[0]+iloc, idxO[1]+jloc, idxO[2]+kloc ) + dual[0][ipart]*( *By3D )( idxO[0]+1+iloc, idxO[1]+jloc, idxO[2]+kloc ) )
-                                        +    dual[2][ipart]  * ( ( 1-dual[0][ipart] )*( *By3D )( idxO[0]+iloc, idxO[1]+jloc, idxO[2]+1+kloc ) + dual[0][ipart]*( *By3D )( idxO[0]+1+iloc, idxO[1]+jloc, idxO[2]+1+kloc ) ) );
+                                      ( ( 1-dual[2][ipart] ) * ( ( 1-dual[0][ipart] )*Bytile[( 1+iloc )*16+( 1+jloc )*4+1+kloc] + dual[0][ipart]*Bytile[( 2+iloc )*16+( 1+jloc )*4+1+kloc] )
+                                        +    dual[2][ipart]  * ( ( 1-dual[0][ipart] )*Bytile[( 1+iloc )*16+( 1+jloc )*4+2+kloc] + dual[0][ipart]*Bytile[( 2+iloc )*16+( 1+jloc )*4+2+kloc] ) );
                     }
                 }
             }
@@ -199,8 +230,8 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
                 for( int jloc=-1 ; jloc<2 ; jloc++ ) {
                     for( int kloc=-1 ; kloc<2 ; kloc++ ) {
                         interp_res += *( coeffxd+iloc*32 ) * *( coeffyd+jloc*32 ) * *( coeffzp+kloc*32 ) *
-                                      ( ( 1-dual[1][ipart] ) * ( ( 1-dual[0][ipart] )*( *Bz3D )( idxO[0]+iloc, idxO[1]+jloc, idxO[2]+kloc ) + dual[0][ipart]*( *Bz3D )( idxO[0]+1+iloc, idxO[1]+jloc, idxO[2]+kloc ) )
-                                        +    dual[1][ipart]  * ( ( 1-dual[0][ipart] )*( *Bz3D )( idxO[0]+iloc, idxO[1]+1+jloc, idxO[2]+kloc ) + dual[0][ipart]*( *Bz3D )( idxO[0]+1+iloc, idxO[1]+1+jloc, idxO[2]+kloc ) ) );
+                                      ( ( 1-dual[1][ipart] ) * ( ( 1-dual[0][ipart] )*Bztile[( 1+iloc )*16+( 1+jloc )*4+1+kloc] + dual[0][ipart]*Bztile[( 2+iloc )*16+( 1+jloc )*4+1+kloc] )
+                                        +    dual[1][ipart]  * ( ( 1-dual[0][ipart] )*Bztile[( 1+iloc )*16+( 2+jloc )*4+1+kloc] + dual[0][ipart]*Bztile[( 2+iloc )*16+( 2+jloc )*4+1+kloc] ) );
                     }
                 }
             }
@@ -0,0 +1,380 @@
+#include "InterpolatorAM2OrderV.h"
+
+#include <cmath>
+#include <iostream>
+#include <math.h>
+#include "ElectroMagn.h"
+#include "ElectroMagnAM.h"
+#include "cField2D.h"
+#include "Particles.h"
+#include <complex>
+#include "dcomplex.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Creator for InterpolatorAM2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+InterpolatorAM2OrderV::InterpolatorAM2OrderV( Params &params, Patch *patch ) : InterpolatorAM( params, patch )
+{
+
+    dl_inv_ = 1.0/params.cell_length[0];
+    dr_inv_ = 1.0/params.cell_length[1];
+    nmodes = params.nmodes;
+    dr =  params.cell_length[1];
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// 2nd Order Interpolation of the fields at a the particle position (3 nodes are used), one particle at a time
+// ---------------------------------------------------------------------------------------------------------------------
+void InterpolatorAM2OrderV::fields( ElectroMagn *EMfields, Particles &particles, int ipart, int nparts, double *ELoc, double *BLoc )
+{
+    ElectroMagnAM *emAM = static_cast<ElectroMagnAM *>( EMfields );
+
+    // Normalized particle position
+    double xpn = particles.position( 0, ipart ) * dl_inv_;
+    double r = sqrt( particles.position( 1, ipart )*particles.position( 1, ipart )+particles.position( 2, ipart )*particles.position( 2, ipart ) ) ;
+    double rpn = r * dr_inv_;
+    complex<double> exp_m_theta = 1., exp_mm_theta = 1. ;
+    if( r > 0 ) {
+        exp_m_theta = ( particles.position( 1, ipart ) - Icpx * particles.position( 2, ipart ) ) / r ; //exp(-i theta)
+    }
+    // Calculate coeffs
+    coeffs( xpn, rpn );
+
+    for( unsigned int i=0; i<3; i++ ) {
+        *( ELoc+i*nparts ) = 0.;
+        *( BLoc+i*nparts ) = 0.;
+    }
+
+    //Here we assume that mode 0 is real !!
+    for( unsigned int imode = 0; imode < nmodes ; imode++ ) {
+        *( ELoc+0*nparts ) += std::real( compute( &coeffxd_[1], &coeffyp_[1], emAM->El_[imode], id_, jp_ )* exp_mm_theta ) ;
+        *( ELoc+1*nparts ) += std::real( compute( &coeffxp_[1], &coeffyd_[1], emAM->Er_[imode], ip_, jd_ )* exp_mm_theta ) ;
+        *( ELoc+2*nparts ) += std::real( compute( &coeffxp_[1], &coeffyp_[1], emAM->Et_[imode], ip_, jp_ )* exp_mm_theta ) ;
+        *( BLoc+0*nparts ) += std::real( compute( &coeffxp_[1], &coeffyd_[1], emAM->Bl_m[imode], ip_, jd_ )* exp_mm_theta ) ;
+        *( BLoc+1*nparts ) += std::real( compute( &coeffxd_[1], &coeffyp_[1], emAM->Br_m[imode], id_, jp_ )* exp_mm_theta ) ;
+        *( BLoc+2*nparts ) += std::real( compute( &coeffxd_[1], &coeffyd_[1], emAM->Bt_m[imode], id_, jd_ )* exp_mm_theta ) ;
+        exp_mm_theta *= exp_m_theta ;
+    }
+
+    //Translate field into the cartesian y,z coordinates
+    double delta2 = std::real( exp_m_theta ) * *( ELoc+1*nparts ) + std::imag( exp_m_theta ) * *( ELoc+2*nparts );
+    *( ELoc+2*nparts ) = -std::imag( exp_m_theta ) * *( ELoc+1*nparts ) + std::real( exp_m_theta ) * *( ELoc+2*nparts );
+    *( ELoc+1*nparts ) = delta2 ;
+    delta2 = std::real( exp_m_theta ) * *( BLoc+1*nparts ) + std::imag( exp_m_theta ) * *( BLoc+2*nparts );
+    *( BLoc+2*nparts ) = -std::imag( exp_m_theta ) * *( BLoc+1*nparts ) + std::real( exp_m_theta ) * *( BLoc+2*nparts );
+    *( BLoc+1*nparts ) = delta2 ;
+
+} // END InterpolatorAM2OrderV
+
+void InterpolatorAM2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    int nparts( ( smpi->dynamics_invgf[ithread] ).size() );
+    fieldsInBuffers( EMfields, particles, smpi, istart, iend, ithread, ipart_ref,
+                     &( smpi->dynamics_Epart[ithread][0] ), &( smpi->dynamics_Bpart[ithread][0] ), nparts, ipart_ref );
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Vectorized interpolation of the fields for all the particles of a cell
+// Particles are treated by blocks of 32 : the coefficients and exp(-i theta) are computed once per particle,
+// then all the modes are interpolated on the same block before moving to the next one
+// ---------------------------------------------------------------------------------------------------------------------
+void InterpolatorAM2OrderV::fieldsInBuffers( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref,
+        double *Ebuffer, double *Bbuffer, int nbuffer, int ibuffer_ref )
+{
+    if( istart[0] == iend[0] ) {
+        return;    //Don't treat empty cells.
+    }
+
+    int nparts( ( smpi->dynamics_invgf[ithread] ).size() );
+
+    double *Epart[3], *Bpart[3];
+
+    double *deltaO[2];
+    deltaO[0] = &( smpi->dynamics_deltaold[ithread][0] );
+    deltaO[1] = &( smpi->dynamics_deltaold[ithread][nparts] );
+    double *theta_old = &( smpi->dynamics_thetaold[ithread][0] );
+
+    for( unsigned int k=0; k<3; k++ ) {
+        Epart[k]= Ebuffer + k*nbuffer + ipart_ref - ibuffer_ref;
+        Bpart[k]= Bbuffer + k*nbuffer + ipart_ref - ibuffer_ref;
+    }
+
+    ElectroMagnAM *emAM = static_cast<ElectroMagnAM *>( EMfields );
+
+    int idx[2], idxO[2];
+    //Primal indices are constant over the all cell
+    idx[0]  = round( particles.position( 0, *istart ) * dl_inv_ );
+    idxO[0] = idx[0] - i_domain_begin -1 ;
+    idx[1]  = round( sqrt( particles.position( 1, *istart )*particles.position( 1, *istart )
+                           + particles.position( 2, *istart )*particles.position( 2, *istart ) ) * dr_inv_ );
+    idxO[1] = idx[1] - j_domain_begin -1 ;
+
+    double coeff[2][2][3][32];
+    int dual[2][32]; // Size ndim. Boolean indicating if the part has a dual indice equal to the primal one (dual=0) or if it is +1 (dual=1).
+    // exp(-i theta) and exp(-i m theta) of each particle of the block
+    double exp_m_theta_r[32], exp_m_theta_i[32];
+    double exp_mm_theta_r[32], exp_mm_theta_i[32];
+
+    int vecSize = 32;
+
+    int cell_nparts( ( int )iend[0]-( int )istart[0] );
+
+    for( int ivect=0 ; ivect < cell_nparts; ivect += vecSize ) {
+
+        int np_computed = min( cell_nparts-ivect, vecSize );
+
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+
+            int ipart2 = ipart+ivect+istart[0];
+            double yp = particles.position( 1, ipart2 );
+            double zp = particles.position( 2, ipart2 );
+            double r = sqrt( yp*yp + zp*zp );
+
+            double delta0[2], delta;
+            double delta2;
+            delta0[0] = particles.position( 0, ipart2 ) * dl_inv_;
+            delta0[1] = r * dr_inv_;
+
+            for( int i=0; i<2; i++ ) { // for L/R
+                dual [i][ipart] = ( delta0[i] - ( double )idx[i] >=0. );
+
+                for( int j=0; j<2; j++ ) { // for dual
+
+                    delta   = delta0[i] - ( double )idx[i] + ( double )j*( 0.5-dual[i][ipart] );
+                    delta2  = delta*delta;
+
+                    coeff[i][j][0][ipart]    =  0.5 * ( delta2-delta+0.25 );
+                    coeff[i][j][1][ipart]    = ( 0.75 - delta2 );
+                    coeff[i][j][2][ipart]    =  0.5 * ( delta2+delta+0.25 );
+
+                    if( j==0 ) {
+                        deltaO[i][ipart2-ipart_ref] = delta;
+                    }
+
+                }
+            }
+            theta_old[ipart2-ipart_ref] = atan2( zp, yp );
+
+            if( r > 0 ) {
+                exp_m_theta_r[ipart] =  yp / r;
+                exp_m_theta_i[ipart] = -zp / r;
+            } else {
+                exp_m_theta_r[ipart] = 1.;
+                exp_m_theta_i[ipart] = 0.;
+            }
+            exp_mm_theta_r[ipart] = 1.;
+            exp_mm_theta_i[ipart] = 0.;
+
+            for( unsigned int k=0; k<3; k++ ) {
+                Epart[k][ipart2-ipart_ref] = 0.;
+                Bpart[k][ipart2-ipart_ref] = 0.;
+            }
+        }
+
+        //Here we assume that mode 0 is real !!
+        for( unsigned int imode = 0; imode < nmodes ; imode++ ) {
+
+            cField2D *El = emAM->El_[imode];
+            cField2D *Er = emAM->Er_[imode];
+            cField2D *Et = emAM->Et_[imode];
+            cField2D *Bl = emAM->Bl_m[imode];
+            cField2D *Br = emAM->Br_m[imode];
+            cField2D *Bt = emAM->Bt_m[imode];
+
+            #pragma omp simd
+            for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+
+                int ipart2 = ipart+ivect+istart[0]-ipart_ref;
+
+                double *coeffyp = &( coeff[1][0][1][ipart] );
+                double *coeffyd = &( coeff[1][1][1][ipart] );
+                double *coeffxd = &( coeff[0][1][1][ipart] );
+                double *coeffxp = &( coeff[0][0][1][ipart] );
+
+                if( imode > 0 ) {
+                    double tmp = exp_mm_theta_r[ipart]*exp_m_theta_r[ipart] - exp_mm_theta_i[ipart]*exp_m_theta_i[ipart];
+                    exp_mm_theta_i[ipart] = exp_mm_theta_r[ipart]*exp_m_theta_i[ipart] + exp_mm_theta_i[ipart]*exp_m_theta_r[ipart];
+                    exp_mm_theta_r[ipart] = tmp;
+                }
+                double emr = exp_mm_theta_r[ipart];
+                double emi = exp_mm_theta_i[ipart];
+
+                //El(dual, primal)
+                complex<double> interp_res = 0.;
+                for( int iloc=-1 ; iloc<2 ; iloc++ ) {
+                    for( int jloc=-1 ; jloc<2 ; jloc++ ) {
+                        interp_res += *( coeffxd+iloc*32 ) * *( coeffyp+jloc*32 ) *
+                                      ( ( double )( 1-dual[0][ipart] )*( *El )( idxO[0]+1+iloc, idxO[1]+1+jloc ) + ( double )dual[0][ipart]*( *El )( idxO[0]+2+iloc, idxO[1]+1+jloc ) );
+                    }
+                }
+                Epart[0][ipart2] += std::real( interp_res )*emr - std::imag( interp_res )*emi;
+
+                //Er(primal, dual)
+                interp_res = 0.;
+                for( int iloc=-1 ; iloc<2 ; iloc++ ) {
+                    for( int jloc=-1 ; jloc<2 ; jloc++ ) {
+                        interp_res += *( coeffxp+iloc*32 ) * *( coeffyd+jloc*32 ) *
+                                      ( ( double )( 1-dual[1][ipart] )*( *Er )( idxO[0]+1+iloc, idxO[1]+1+jloc ) + ( double )dual[1][ipart]*( *Er )( idxO[0]+1+iloc, idxO[1]+2+jloc ) );
+                    }
+                }
+                Epart[1][ipart2] += std::real( interp_res )*emr - std::imag( interp_res )*emi;
+
+                //Et(primal, primal)
+                interp_res = 0.;
+                for( int iloc=-1 ; iloc<2 ; iloc++ ) {
+                    for( int jloc=-1 ; jloc<2 ; jloc++ ) {
+                        interp_res += *( coeffxp+iloc*32 ) * *( coeffyp+jloc*32 ) * ( *Et )( idxO[0]+1+iloc, idxO[1]+1+jloc );
+                    }
+                }
+                Epart[2][ipart2] += std::real( interp_res )*emr - std::imag( interp_res )*emi;
+
+                //Bl(primal, dual)
+                interp_res = 0.;
+                for( int iloc=-1 ; iloc<2 ; iloc++ ) {
+                    for( int jloc=-1 ; jloc<2 ; jloc++ ) {
+                        interp_res += *( coeffxp+iloc*32 ) * *( coeffyd+jloc*32 ) *
+                                      ( ( double )( 1-dual[1][ipart] )*( *Bl )( idxO[0]+1+iloc, idxO[1]+1+jloc ) + ( double )dual[1][ipart]*( *Bl )( idxO[0]+1+iloc, idxO[1]+2+jloc ) );
+                    }
+                }
+                Bpart[0][ipart2] += std::real( interp_res )*emr - std::imag( interp_res )*emi;
+
+                //Br(dual, primal )
+                interp_res = 0.;
+                for( int iloc=-1 ; iloc<2 ; iloc++ ) {
+                    for( int jloc=-1 ; jloc<2 ; jloc++ ) {
+                        interp_res += *( coeffxd+iloc*32 ) * *( coeffyp+jloc*32 ) *
+                                      ( ( double )( 1-dual[0][ipart] )*( *Br )( idxO[0]+1+iloc, idxO[1]+1+jloc ) + ( double )dual[0][ipart]*( *Br )( idxO[0]+2+iloc, idxO[1]+1+jloc ) );
+                    }
+                }
+                Bpart[1][ipart2] += std::real( interp_res )*emr - std::imag( interp_res )*emi;
+
+                //Bt(dual, dual)
+                interp_res = 0.;
+                for( int iloc=-1 ; iloc<2 ; iloc++ ) {
+                    for( int jloc=-1 ; jloc<2 ; jloc++ ) {
+                        interp_res += *( coeffxd+iloc*32 ) * *( coeffyd+jloc*32 ) *
+                                      ( ( double )( 1-dual[1][ipart] ) * ( ( double )( 1-dual[0][ipart] )*( *Bt )( idxO[0]+1+iloc, idxO[1]+1+jloc ) + ( double )dual[0][ipart]*( *Bt )( idxO[0]+2+iloc, idxO[1]+1+jloc ) )
+                                        +    ( double )dual[1][ipart]  * ( ( double )( 1-dual[0][ipart] )*( *Bt )( idxO[0]+1+iloc, idxO[1]+2+jloc ) + ( double )dual[0][ipart]*( *Bt )( idxO[0]+2+iloc, idxO[1]+2+jloc ) ) );
+                    }
+                }
+                Bpart[2][ipart2] += std::real( interp_res )*emr - std::imag( interp_res )*emi;
+            }
+        } // END loop on modes
+
+        //Translate field into the cartesian y,z coordinates
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+            int ipart2 = ipart+ivect+istart[0]-ipart_ref;
+            double tmp = exp_m_theta_r[ipart] * Epart[1][ipart2] + exp_m_theta_i[ipart] * Epart[2][ipart2];
+            Epart[2][ipart2] = -exp_m_theta_i[ipart] * Epart[1][ipart2] + exp_m_theta_r[ipart] * Epart[2][ipart2];
+            Epart[1][ipart2] = tmp;
+            tmp = exp_m_theta_r[ipart] * Bpart[1][ipart2] + exp_m_theta_i[ipart] * Bpart[2][ipart2];
+            Bpart[2][ipart2] = -exp_m_theta_i[ipart] * Bpart[1][ipart2] + exp_m_theta_r[ipart] * Bpart[2][ipart2];
+            Bpart[1][ipart2] = tmp;
+        }
+    }
+
+} // END InterpolatorAM2OrderV
+
+void InterpolatorAM2OrderV::fieldsAndCurrents( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, LocalFields *JLoc, double *RhoLoc )
+{
+    int ipart = *istart;
+
+    double *ELoc = &( smpi->dynamics_Epart[ithread][ipart] );
+    double *BLoc = &( smpi->dynamics_Bpart[ithread][ipart] );
+
+    ElectroMagnAM *emAM = static_cast<ElectroMagnAM *>( EMfields );
+
+    // Normalized particle position
+    double xpn = particles.position( 0, ipart ) * dl_inv_;
+    double r = sqrt( particles.position( 1, ipart )*particles.position( 1, ipart )+particles.position( 2, ipart )*particles.position( 2, ipart ) ) ;
+    double rpn = r * dr_inv_;
+    complex<double> exp_m_theta = 1., exp_mm_theta = 1. ;
+    if( r > 0 ) {
+        exp_m_theta = ( particles.position( 1, ipart ) - Icpx * particles.position( 2, ipart ) ) / r ;
+    }
+
+    // Calculate coeffs
+    coeffs( xpn, rpn );
+
+    int nparts( particles.size() );
+
+    for( unsigned int i=0; i<3; i++ ) {
+        *( ELoc+i*nparts ) = 0.;
+        *( BLoc+i*nparts ) = 0.;
+    }
+    JLoc->x = 0.;
+    JLoc->y = 0.;
+    JLoc->z = 0.;
+    ( *RhoLoc ) = 0.;
+
+    for( unsigned int imode = 0; imode < nmodes ; imode++ ) {
+        *( ELoc+0*nparts ) += std::real( compute( &coeffxd_[1], &coeffyp_[1], emAM->El_[imode], id_, jp_ ) * exp_mm_theta ) ;
+        *( ELoc+1*nparts ) += std::real( compute( &coeffxp_[1], &coeffyd_[1], emAM->Er_[imode], ip_, jd_ ) * exp_mm_theta ) ;
+        *( ELoc+2*nparts ) += std::real( compute( &coeffxp_[1], &coeffyp_[1], emAM->Et_[imode], ip_, jp_ ) * exp_mm_theta ) ;
+        *( BLoc+0*nparts ) += std::real( compute( &coeffxp_[1], &coeffyd_[1], emAM->Bl_m[imode], ip_, jd_ ) * exp_mm_theta ) ;
+        *( BLoc+1*nparts ) += std::real( compute( &coeffxd_[1], &coeffyp_[1], emAM->Br_m[imode], id_, jp_ ) * exp_mm_theta ) ;
+        *( BLoc+2*nparts ) += std::real( compute( &coeffxd_[1], &coeffyd_[1], emAM->Bt_m[imode], id_, jd_ ) * exp_mm_theta ) ;
+        JLoc->x += std::real( compute( &coeffxd_[1], &coeffyp_[1], emAM->Jl_[imode], id_, jp_ ) * exp_mm_theta ) ;
+        JLoc->y += std::real( compute( &coeffxp_[1], &coeffyd_[1], emAM->Jr_[imode], ip_, jd_ ) * exp_mm_theta ) ;
+        JLoc->z += std::real( compute( &coeffxp_[1], &coeffyp_[1], emAM->Jt_[imode], ip_, jp_ ) * exp_mm_theta ) ;
+        ( *RhoLoc ) += std::real( compute( &coeffxp_[1], &coeffyp_[1], emAM->rho_AM_[imode], ip_, jp_ )* exp_mm_theta ) ;
+        exp_mm_theta *= exp_m_theta ;
+    }
+    double delta2 = std::real( exp_m_theta ) * *( ELoc+1*nparts ) + std::imag( exp_m_theta ) * *( ELoc+2*nparts );
+    *( ELoc+2*nparts ) = -std::imag( exp_m_theta ) * *( ELoc+1*nparts ) + std::real( exp_m_theta ) * *( ELoc+2*nparts );
+    *( ELoc+1*nparts ) = delta2 ;
+    delta2 = std::real( exp_m_theta ) * *( BLoc+1*nparts ) + std::imag( exp_m_theta ) *  *( BLoc+2*nparts );
+    *( BLoc+2*nparts ) = -std::imag( exp_m_theta ) * *( BLoc+1*nparts ) + std::real( exp_m_theta ) * *( BLoc+2*nparts );
+    *( BLoc+1*nparts ) = delta2 ;
+    delta2 = std::real( exp_m_theta ) * JLoc->y + std::imag( exp_m_theta ) * JLoc->z;
+    JLoc->z = -std::imag( exp_m_theta ) * JLoc->y + std::real( exp_m_theta ) * JLoc->z;
+    JLoc->y = delta2 ;
+
+}
+
+// Interpolator specific to tracked particles. A selection of particles may be provided
+void InterpolatorAM2OrderV::fieldsSelection( ElectroMagn *EMfields, Particles &particles, double *buffer, int offset, vector<unsigned int> *selection )
+{
+    if( selection ) {
+
+        int nsel_tot = selection->size();
+        for( int isel=0 ; isel<nsel_tot; isel++ ) {
+            fields( EMfields, particles, ( *selection )[isel], offset, buffer+isel, buffer+isel+3*offset );
+        }
+
+    } else {
+
+        int npart_tot = particles.size();
+        for( int ipart=0 ; ipart<npart_tot; ipart++ ) {
+            fields( EMfields, particles, ipart, offset, buffer+ipart, buffer+ipart+3*offset );
+        }
+    }
+}
+
+// Interpolator on another field than the basic ones
+void InterpolatorAM2OrderV::oneField( Field **field, Particles &particles, int *istart, int *iend, double *FieldLoc, double *l1, double *l2, double *l3 )
+{
+    ERROR( "Single field AM2O interpolator not available in vectorized mode" );
+}
+
+void InterpolatorAM2OrderV::fieldsAndEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    ERROR( "Vectorized interpolation for the envelope model is not implemented for AM geometry" );
+} // END InterpolatorAM2OrderV
+
+
+void InterpolatorAM2OrderV::timeCenteredEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    ERROR( "Vectorized interpolation for the envelope model is not implemented for AM geometry" );
+} // END InterpolatorAM2OrderV
+
+
+void InterpolatorAM2OrderV::envelopeAndSusceptibility( ElectroMagn *EMfields, Particles &particles, int ipart, double *Env_A_abs_Loc, double *Env_Chi_Loc, double *Env_E_abs_Loc, double *Env_Ex_abs_Loc )
+{
+    ERROR( "Vectorized interpolation for the envelope model is not implemented for AM geometry" );
+} // END InterpolatorAM2OrderV
@@ -0,0 +1,101 @@
+#ifndef INTERPOLATORAM2ORDERV_H
+#define INTERPOLATORAM2ORDERV_H
+
+
+#include "InterpolatorAM.h"
+#include "cField2D.h"
+
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class for vectorized 2nd order interpolator for AM simulations
+//  --------------------------------------------------------------------------------------------------------------------
+class InterpolatorAM2OrderV final : public InterpolatorAM
+{
+
+public:
+    InterpolatorAM2OrderV( Params &, Patch * );
+    ~InterpolatorAM2OrderV() override final {};
+
+    inline void fields( ElectroMagn *EMfields, Particles &particles, int ipart, int nparts, double *ELoc, double *BLoc );
+    void fieldsAndCurrents( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, LocalFields *JLoc, double *RhoLoc ) override final ;
+    void fieldsWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final ;
+    //! Same as fieldsWrapper, but E and B of the particle ipart go to Ebuffer[k*nbuffer+ipart-ibuffer_ref] and Bbuffer
+    void fieldsInBuffers( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref,
+                          double *Ebuffer, double *Bbuffer, int nbuffer, int ibuffer_ref );
+    void fieldsSelection( ElectroMagn *EMfields, Particles &particles, double *buffer, int offset, std::vector<unsigned int> *selection ) override final;
+    void oneField( Field **field, Particles &particles, int *istart, int *iend, double *FieldLoc, double *l1=NULL, double *l2=NULL, double *l3=NULL ) override final;
+
+    void fieldsAndEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final;
+    void timeCenteredEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final;
+    void envelopeAndSusceptibility( ElectroMagn *EMfields, Particles &particles, int ipart, double *Env_A_abs_Loc, double *Env_Chi_Loc, double *Env_E_abs_Loc, double *Env_Ex_abs_Loc ) override final;
+
+    inline std::complex<double> compute( double *coeffx, double *coeffy, cField2D *f, int idx, int idy )
+    {
+        std::complex<double> interp_res( 0. );
+        for( int iloc=-1 ; iloc<2 ; iloc++ ) {
+            for( int jloc=-1 ; jloc<2 ; jloc++ ) {
+                interp_res += *( coeffx+iloc ) * *( coeffy+jloc ) * ( ( *f )( idx+iloc, idy+jloc ) ) ;
+            }
+        }
+        return interp_res;
+    };
+
+private:
+    inline void coeffs( double xpn, double rpn )
+    {
+        // Indexes of the central nodes
+        ip_ = round( xpn );
+        id_ = round( xpn+0.5 );
+        jp_ = round( rpn );
+        jd_ = round( rpn+0.5 );
+
+        // Declaration and calculation of the coefficient for interpolation
+        double delta2;
+
+        deltax   = xpn - ( double )id_ + 0.5;
+        delta2  = deltax*deltax;
+        coeffxd_[0] = 0.5 * ( delta2-deltax+0.25 );
+        coeffxd_[1] = 0.75 - delta2;
+        coeffxd_[2] = 0.5 * ( delta2+deltax+0.25 );
+
+        deltax   = xpn - ( double )ip_;
+        delta2  = deltax*deltax;
+        coeffxp_[0] = 0.5 * ( delta2-deltax+0.25 );
+        coeffxp_[1] = 0.75 - delta2;
+        coeffxp_[2] = 0.5 * ( delta2+deltax+0.25 );
+
+        deltar   = rpn - ( double )jd_ + 0.5;
+        delta2  = deltar*deltar;
+        coeffyd_[0] = 0.5 * ( delta2-deltar+0.25 );
+        coeffyd_[1] = 0.75 - delta2;
+        coeffyd_[2] = 0.5 * ( delta2+deltar+0.25 );
+
+        deltar   = rpn - ( double )jp_;
+        delta2  = deltar*deltar;
+        coeffyp_[0] = 0.5 * ( delta2-deltar+0.25 );
+        coeffyp_[1] = 0.75 - delta2;
+        coeffyp_[2] = 0.5 * ( delta2+deltar+0.25 );
+
+        // First index for summation
+        ip_ = ip_ - i_domain_begin;
+        id_ = id_ - i_domain_begin;
+        jp_ = jp_ - j_domain_begin;
+        jd_ = jd_ - j_domain_begin;
+    };
+
+    // Last prim index computed
+    int ip_, jp_;
+    // Last dual index computed
+    int id_, jd_;
+    // Last delta computed
+    double deltax, deltar ;
+    // Interpolation coefficient on Prim grid
+    double coeffxp_[3], coeffyp_[3];
+    // Interpolation coefficient on Dual grid
+    double coeffxd_[3], coeffyd_[3];
+    //! Number of modes;
+    unsigned int nmodes;
+
+};//END class
+
+#endif
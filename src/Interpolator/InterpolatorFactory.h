@@ -13,9 +13,12 @@
 #include "InterpolatorAM2Order.h"
 
 #ifdef _VECTO
+#include "Interpolator1D2OrderV.h"
 #include "Interpolator2D2OrderV.h"
+#include "Interpolator2D4OrderV.h"
 #include "Interpolator3D2OrderV.h"
 #include "Interpolator3D4OrderV.h"
+#include "InterpolatorAM2OrderV.h"
 #endif
 
 #include "Params.h"
@@ -33,7 +36,14 @@ public:
         // 1Dcartesian simulation
         // ---------------
         if( ( params.geometry == "1Dcartesian" ) && ( params.interpolation_order == 2 ) ) {
-            Interp = new Interpolator1D2Order( params, patch );
+            if( !vectorization || params.Laser_Envelope_model ) {
+                Interp = new Interpolator1D2Order( params, patch );
+            }
+#ifdef _VECTO
+            else {
+                Interp = new Interpolator1D2OrderV( params, patch );
+            }
+#endif
         } else if( ( params.geometry == "1Dcartesian" ) && ( params.interpolation_order == 4 ) ) {
             Interp = new Interpolator1D4Order( params, patch );
         }
@@ -50,7 +60,14 @@ public:
             }
 #endif
         } else if( ( params.geometry == "2Dcartesian" ) && ( params.interpolation_order == 4 ) ) {
-            Interp = new Interpolator2D4Order( params, patch );
+            if( !vectorization ) {
+                Interp = new Interpolator2D4Order( params, patch );
+            }
+#ifdef _VECTO
+            else {
+                Interp = new Interpolator2D4OrderV( params, patch );
+            }
+#endif
         }
         // ---------------
         // 3Dcartesian simulation
@@ -78,11 +95,18 @@ public:
         // AM simulation
         // ---------------
         else if( params.geometry == "AMcylindrical" ) {
-            if ( !params.is_spectral){
-                Interp = new InterpolatorAM2Order( params, patch );
-            } else {
+            if( params.is_spectral ) {
                 Interp = new InterpolatorAM1Order( params, patch );
             }
+#ifdef _VECTO
+            // The envelope model keeps the scalar operators
+            else if( vectorization && !params.Laser_Envelope_model ) {
+                Interp = new InterpolatorAM2OrderV( params, patch );
+            }
+#endif
+            else {
+                Interp = new InterpolatorAM2Order( params, patch );
+            }
         } 
         else {
             ERROR( "Unknwon parameters : " << params.geometry << ", Order : " << params.interpolation_order );
@@ -11,6 +11,7 @@ Ionization::Ionization( Params &params, Species *species )
     nDim_field              = params.nDim_field;
     nDim_particle           = params.nDim_particle;
     ionized_species_invmass = 1./species->mass_;
+    rand_stream_            = Random::stream( species->species_number_, Random::ionization );
     
     // Normalization constant from Smilei normalization to/from atomic units
     eV_to_au   = 1.0 / 27.2116;
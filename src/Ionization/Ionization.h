@@ -41,6 +41,9 @@ protected:
     unsigned int nDim_particle;
     double ionized_species_invmass;
     
+    //! Stream of the counter-based random numbers (species, process)
+    uint32_t rand_stream_;
+    
 private:
 
 
@@ -8,6 +8,8 @@
 
 using namespace std;
 
+std::map<unsigned int, IonizationTunnelRates> IonizationTunnel::tabulated_rates_;
+
 
 
 IonizationTunnel::IonizationTunnel( Params &params, Species *species ) : Ionization( params, species )
@@ -42,6 +44,34 @@ IonizationTunnel::IonizationTunnel( Params &params, Species *species ) : Ionizat
         gamma_tunnel[Z] = 2.0 * pow( 2.0*Potential[Z], 1.5 );
     }
     
+    // Tabulate the logarithm of the rates in log(E), once per element
+    //   rate = beta exp( -delta/3 + alpha log(delta) ) with delta = gamma/E
+    //   Below delta = 2250, exp(-delta/3) underflows: the rate is null
+    //   Above E = gamma e^6, the rate is kept constant
+    #pragma omp critical (IonizationTunnel_rates)
+    {
+        IonizationTunnelRates &rates = tabulated_rates_[atomic_number_];
+        if( rates.ln_rate.empty() ) {
+            rates.ln_rate.resize( atomic_number_*rate_table_size );
+            rates.lnE_min.resize( atomic_number_ );
+            rates.inv_dlnE.resize( atomic_number_ );
+            for( unsigned int Z=0 ; Z<atomic_number_ ; Z++ ) {
+                double ln_gamma = log( gamma_tunnel[Z] );
+                double lnE_min = ln_gamma - log( 2250. );
+                double dlnE = ( log( 2250. ) + 6. ) / ( double )( rate_table_size-1 );
+                rates.lnE_min [Z] = lnE_min;
+                rates.inv_dlnE[Z] = 1./dlnE;
+                for( unsigned int i=0 ; i<rate_table_size ; i++ ) {
+                    double ln_delta = ln_gamma - ( lnE_min + i*dlnE );
+                    rates.ln_rate[Z*rate_table_size + i] = log( beta_tunnel[Z] ) - exp( ln_delta )*one_third + alpha_tunnel[Z]*ln_delta;
+                }
+            }
+        }
+        ln_rate_  = rates.ln_rate.data();
+        lnE_min_  = rates.lnE_min.data();
+        inv_dlnE_ = rates.inv_dlnE.data();
+    }
+    
     DEBUG( "Finished Creating the Tunnel Ionizaton class" );
     
 }
@@ -52,7 +82,7 @@ void IonizationTunnel::operator()( Particles *particles, unsigned int ipart_min,
 {
 
     unsigned int Z, Zp1, newZ, k_times;
-    double TotalIonizPot, E, invE, factorJion, delta, ran_p, Mult, D_sum, P_sum, Pint_tunnel;
+    double TotalIonizPot, E, invE, factorJion, ran_p, Mult, D_sum, P_sum, Pint_tunnel;
     vector<double> IonizRate_tunnel( atomic_number_ ), Dnom_tunnel( atomic_number_ );
     LocalFields Jion;
     double factorJion_0 = au_to_mec2 * EC_to_au*EC_to_au * invdt;
@@ -61,119 +91,149 @@ void IonizationTunnel::operator()( Particles *particles, unsigned int ipart_min,
     double *Ex = &( ( *Epart )[0*nparts] );
     double *Ey = &( ( *Epart )[1*nparts] );
     double *Ez = &( ( *Epart )[2*nparts] );
+    short *charge = particles->getPtrCharge();
     
-    for( unsigned int ipart=ipart_min ; ipart<ipart_max; ipart++ ) {
+    // The particles are treated by chunks:
+    //   - a vectorized loop finds, from the tabulated rates, the particles ionized at least once
+    //   - the ionized particles only go through the multiple ionization routine
+    //   - their new electrons are created at once
+    const unsigned int nchunk = 64;
+    double rand_chunk[nchunk], lnE_chunk[nchunk];
+    unsigned int ionized[nchunk], k_times_chunk[nchunk];
+    int first_ionization[nchunk];
+    const double ln_EC_to_au = log( EC_to_au );
+    const double lnE_threshold = log( 1e-10 );
+    const unsigned int last_Z = atomic_number_-1;
     
-        // Current charge state of the ion
-        Z = ( unsigned int )( particles->charge( ipart ) );
+    for( unsigned int istart=ipart_min ; istart<ipart_max; istart+=nchunk ) {
+    
+        unsigned int n = std::min( nchunk, ipart_max-istart );
         
-        // If ion already fully ionized then skip
-        if( Z==atomic_number_ ) {
-            continue;
-        }
+        // Random numbers from the counter-based generator
+        patch->rand_->uniforms( rand_chunk, n, rand_stream_, 0, istart );
         
-        // Absolute value of the electric field normalized in atomic units
-        E = EC_to_au * sqrt( pow( *( Ex+ipart-ipart_ref ), 2 )
-                             +pow( *( Ey+ipart-ipart_ref ), 2 )
-                             +pow( *( Ez+ipart-ipart_ref ), 2 ) );
-        if( E<1e-10 ) {
-            continue;
+        // Probability of the first ionization event
+        #pragma omp simd
+        for( unsigned int k=0; k<n; k++ ) {
+            unsigned int ipart = istart + k;
+            // Current charge state of the ion
+            unsigned int Zk = ( unsigned int )charge[ipart];
+            unsigned int Zt = std::min( Zk, last_Z );
+            // Logarithm of the absolute value of the electric field normalized in atomic units
+            double E2 = Ex[ipart-ipart_ref]*Ex[ipart-ipart_ref] + Ey[ipart-ipart_ref]*Ey[ipart-ipart_ref] + Ez[ipart-ipart_ref]*Ez[ipart-ipart_ref];
+            double lnE = 0.5*log( E2 ) + ln_EC_to_au;
+            lnE_chunk[k] = lnE;
+            // Probability not to be ionized
+            double P0 = exp( -exp( lnRate( Zt, lnE ) )*dt );
+            // Skip fully ionized ions and vanishing fields
+            bool ionizable = ( Zk < atomic_number_ ) && ( lnE >= lnE_threshold );
+            // Single ionization if last electron, else multiple ionization may occur (see below)
+            first_ionization[k] = ionizable && ( Zk == last_Z ? rand_chunk[k] < 1.0 - P0 : P0 < rand_chunk[k] );
         }
         
-        // --------------------------------
-        // Start of the Monte-Carlo routine
-        // --------------------------------
-        
-        invE = 1./E;
-        factorJion = factorJion_0 * invE*invE;
-        delta      = gamma_tunnel[Z]*invE;
-        ran_p = patch->rand_->uniform();
-        IonizRate_tunnel[Z] = beta_tunnel[Z] * exp( -delta*one_third + alpha_tunnel[Z]*log( delta ) );
-        
-        // Total ionization potential (used to compute the ionization current)
-        TotalIonizPot = 0.0;
-        
-        // k_times will give the nb of ionization events
-        k_times = 0;
-        Zp1=Z+1;
-        
-        if( Zp1 == atomic_number_ ) {
-            // if ionization of the last electron: single ionization
-            // -----------------------------------------------------
-            if( ran_p < 1.0 -exp( -IonizRate_tunnel[Z]*dt ) ) {
-                TotalIonizPot += Potential[Z];
-                k_times        = 1;
+        // Monte-Carlo routine of the ionized particles
+        unsigned int nionized = 0;
+        for( unsigned int k=0; k<n; k++ ) {
+            if( ! first_ionization[k] ) {
+                continue;
             }
+            unsigned int ipart = istart + k;
             
-        } else {
-            // else : multiple ionization can occur in one time-step
-            //        partial & final ionization are decoupled (see Nuter Phys. Plasmas)
-            // -------------------------------------------------------------------------
+            Z = ( unsigned int )( charge[ipart] );
+            E = exp( lnE_chunk[k] );
+            invE = 1./E;
+            ran_p = rand_chunk[k];
+            IonizRate_tunnel[Z] = exp( lnRate( Z, lnE_chunk[k] ) );
             
-            // initialization
-            Mult = 1.0;
-            Dnom_tunnel[0]=1.0;
-            Pint_tunnel = exp( -IonizRate_tunnel[Z]*dt ); // cummulative prob.
+            // Total ionization potential (used to compute the ionization current)
+            TotalIonizPot = 0.0;
             
-            //multiple ionization loop while Pint_tunnel < ran_p and still partial ionization
-            while( ( Pint_tunnel < ran_p ) and ( k_times < atomic_number_-Zp1 ) ) {
-                newZ = Zp1+k_times;
-                delta = gamma_tunnel[newZ]*invE;
-                IonizRate_tunnel[newZ] = beta_tunnel[newZ]
-                                         *                        exp( -delta*one_third+alpha_tunnel[newZ]*log( delta ) );
-                D_sum = 0.0;
-                P_sum = 0.0;
-                Mult  *= IonizRate_tunnel[Z+k_times];
-                for( unsigned int i=0; i<k_times+1; i++ ) {
-                    Dnom_tunnel[i]=Dnom_tunnel[i]/( IonizRate_tunnel[newZ]-IonizRate_tunnel[Z+i] );
-                    D_sum += Dnom_tunnel[i];
-                    P_sum += exp( -IonizRate_tunnel[Z+i]*dt )*Dnom_tunnel[i];
-                }
-                Dnom_tunnel[k_times+1] -= D_sum;
-                P_sum                   = P_sum + Dnom_tunnel[k_times+1]*exp( -IonizRate_tunnel[newZ]*dt );
-                Pint_tunnel             = Pint_tunnel + P_sum*Mult;
+            // k_times will give the nb of ionization events
+            k_times = 0;
+            Zp1=Z+1;
+            
+            if( Zp1 == atomic_number_ ) {
+                // if ionization of the last electron: single ionization
+                // -----------------------------------------------------
+                TotalIonizPot += Potential[Z];
+                k_times        = 1;
+                
+            } else {
+                // else : multiple ionization can occur in one time-step
+                //        partial & final ionization are decoupled (see Nuter Phys. Plasmas)
+                // -------------------------------------------------------------------------
+                
+                // initialization
+                Mult = 1.0;
+                Dnom_tunnel[0]=1.0;
+                Pint_tunnel = exp( -IonizRate_tunnel[Z]*dt ); // cummulative prob.
+                
+                //multiple ionization loop while Pint_tunnel < ran_p and still partial ionization
+                while( ( Pint_tunnel < ran_p ) and ( k_times < atomic_number_-Zp1 ) ) {
+                    newZ = Zp1+k_times;
+                    IonizRate_tunnel[newZ] = exp( lnRate( newZ, lnE_chunk[k] ) );
+                    D_sum = 0.0;
+                    P_sum = 0.0;
+                    Mult  *= IonizRate_tunnel[Z+k_times];
+                    for( unsigned int i=0; i<k_times+1; i++ ) {
+                        Dnom_tunnel[i]=Dnom_tunnel[i]/( IonizRate_tunnel[newZ]-IonizRate_tunnel[Z+i] );
+                        D_sum += Dnom_tunnel[i];
+                        P_sum += exp( -IonizRate_tunnel[Z+i]*dt )*Dnom_tunnel[i];
+                    }
+                    Dnom_tunnel[k_times+1] -= D_sum;
+                    P_sum                   = P_sum + Dnom_tunnel[k_times+1]*exp( -IonizRate_tunnel[newZ]*dt );
+                    Pint_tunnel             = Pint_tunnel + P_sum*Mult;
+                    
+                    TotalIonizPot += Potential[Z+k_times];
+                    k_times++;
+                }//END while
                 
-                TotalIonizPot += Potential[Z+k_times];
-                k_times++;
-            }//END while
+                // final ionization (of last electron)
+                if( ( ( 1.0-Pint_tunnel )>ran_p ) && ( k_times==atomic_number_-Zp1 ) ) {
+                    TotalIonizPot += Potential[atomic_number_-1];
+                    k_times++;
+                }
+            }//END Multiple ionization routine
             
-            // final ionization (of last electron)
-            if( ( ( 1.0-Pint_tunnel )>ran_p ) && ( k_times==atomic_number_-Zp1 ) ) {
-                TotalIonizPot += Potential[atomic_number_-1];
-                k_times++;
+            // Compute ionization current
+            if (patch->EMfields->Jx_ != NULL){  // For the moment ionization current is not accounted for in AM geometry
+                factorJion = factorJion_0 * invE*invE * TotalIonizPot;
+                Jion.x = factorJion * *( Ex+ipart );
+                Jion.y = factorJion * *( Ey+ipart );
+                Jion.z = factorJion * *( Ez+ipart );
+                
+                Proj->ionizationCurrents( patch->EMfields->Jx_, patch->EMfields->Jy_, patch->EMfields->Jz_, *particles, ipart, Jion );
             }
-        }//END Multiple ionization routine
-        
-        // Compute ionization current
-        if (patch->EMfields->Jx_ != NULL){  // For the moment ionization current is not accounted for in AM geometry
-            factorJion *= TotalIonizPot;
-            Jion.x = factorJion * *( Ex+ipart );
-            Jion.y = factorJion * *( Ey+ipart );
-            Jion.z = factorJion * *( Ez+ipart );
             
-            Proj->ionizationCurrents( patch->EMfields->Jx_, patch->EMfields->Jy_, patch->EMfields->Jz_, *particles, ipart, Jion );
+            if( k_times !=0 ) {
+                ionized[nionized] = ipart;
+                k_times_chunk[nionized] = k_times;
+                nionized++;
+            }
         }
         
         // Creation of the new electrons
         // (variable weights are used)
         // -----------------------------
-        if( k_times !=0 ) {
-            new_electrons.createParticle();
-            //new_electrons.initialize( new_electrons.size()+1, new_electrons.dimension() );
-            int idNew = new_electrons.size() - 1;
+        if( nionized == 0 ) {
+            continue;
+        }
+        unsigned int idNew = new_electrons.size();
+        new_electrons.createParticles( nionized );
+        for( unsigned int k=0; k<nionized; k++, idNew++ ) {
+            unsigned int ipart = ionized[k];
             for( unsigned int i=0; i<new_electrons.dimension(); i++ ) {
                 new_electrons.position( i, idNew )=particles->position( i, ipart );
             }
             for( unsigned int i=0; i<3; i++ ) {
                 new_electrons.momentum( i, idNew ) = particles->momentum( i, ipart )*ionized_species_invmass;
             }
-            new_electrons.weight( idNew )=double( k_times )*particles->weight( ipart );
+            new_electrons.weight( idNew )=double( k_times_chunk[k] )*particles->weight( ipart );
             new_electrons.charge( idNew )=-1;
             
             // Increase the charge of the particle
-            particles->charge( ipart ) += k_times;
+            particles->charge( ipart ) += k_times_chunk[k];
         }
         
-        
-    } // Loop on particles
+    } // Loop on chunks of particles
 }
@@ -4,12 +4,20 @@
 #include <cmath>
 
 #include <vector>
+#include <map>
+#include <algorithm>
 
 #include "Ionization.h"
 #include "Tools.h"
 
 class Particles;
 
+//! Logarithm of the tunnel ionization rates of all the charge states of an element, tabulated in log(E)
+struct IonizationTunnelRates {
+    //! ln_rate[Z*size+i] is the log of the rate of the charge state Z at log(E) = lnE_min[Z] + i/inv_dlnE[Z]
+    std::vector<double> ln_rate, lnE_min, inv_dlnE;
+};
+
 //! calculate the particle tunnel ionization
 class IonizationTunnel : public Ionization
 {
@@ -28,6 +36,23 @@ private:
     
     double one_third;
     std::vector<double> alpha_tunnel, beta_tunnel, gamma_tunnel;
+    
+    //! Number of points of the rate table of each charge state
+    static const unsigned int rate_table_size = 4096;
+    //! Rate tables of each element, shared by all patches
+    static std::map<unsigned int, IonizationTunnelRates> tabulated_rates_;
+    //! Pointers to the rate tables of this element
+    const double *ln_rate_, *lnE_min_, *inv_dlnE_;
+    
+    //! Logarithm of the ionization rate of the charge state Z in a field of logarithm lnE (interpolated in the table)
+    inline double lnRate( unsigned int Z, double lnE ) const
+    {
+        double x = ( lnE - lnE_min_[Z] ) * inv_dlnE_[Z];
+        x = std::min( std::max( x, 0. ), ( double )( rate_table_size-1 ) );
+        unsigned int i = std::min( ( unsigned int )x, rate_table_size-2 );
+        const double *t = &ln_rate_[Z*rate_table_size + i];
+        return t[0] + ( x-( double )i )*( t[1]-t[0] );
+    }
 };
 
 
@@ -43,6 +43,7 @@ MultiphotonBreitWheeler::MultiphotonBreitWheeler( Params &params, Species *speci
 
     // Local random generator
     rand_ = rand;
+    rand_stream_ = Random::stream( species->species_number_, Random::multiphoton_Breit_Wheeler );
 
 }
 
@@ -216,9 +217,9 @@ void MultiphotonBreitWheeler::operator()( Particles &particles,
             // If tau[ipart] <= 0, this is a new process
             if( tau[ipart] <= epsilon_tau_ ) {
                 // New final optical depth to reach for emision
+                uint32_t draw = 0;
                 while( tau[ipart] <= epsilon_tau_ ) {
-                    //tau[ipart] = -log( 1.-Rand::uniform() );
-                    tau[ipart] = -log( 1.-rand_->uniform() );
+                    tau[ipart] = -log( rand_->uniform( rand_stream_, draw++, ipart ) );
                 }
 
             }
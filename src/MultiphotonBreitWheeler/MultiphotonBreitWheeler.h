@@ -146,6 +146,9 @@ private:
     //! Local random generator
     Random * rand_;
 
+    //! Stream of the counter-based random numbers (species, process)
+    uint32_t rand_stream_;
+
     // _________________________________________
     // Factors
 
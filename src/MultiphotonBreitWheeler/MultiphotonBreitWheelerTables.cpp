@@ -81,6 +81,10 @@ void MultiphotonBreitWheelerTables::initialization( Params &params, SmileiMPI *s
             MESSAGE(1,"Default tables (stored in the code) are used:");
         }
         
+        // A single copy of the tables per node, in shared memory
+        T_.table_.share( smpi );
+        xi_.table_.share( smpi );
+        
         MESSAGE( "" )
         MESSAGE( 1,"--- Table `integration_dt_dchi`:" );
         MESSAGE( 2,"Dimension quantum parameter: "
@@ -285,8 +289,9 @@ void MultiphotonBreitWheelerTables::readTableT( SmileiMPI *smpi )
             d.attr( "max_photon_chi", T_.max_photon_chi_ );
             
             // Resize and read table
-            T_.table_.resize( T_.size_photon_chi_ );
-            f.vect( "integration_dt_dchi", T_.table_ );
+            std::vector<double> table( T_.size_photon_chi_ );
+            f.vect( "integration_dt_dchi", table );
+            T_.table_ = table;
             
         }
     }
@@ -296,7 +301,7 @@ void MultiphotonBreitWheelerTables::readTableT( SmileiMPI *smpi )
               << table_path_<<"`. Please check that the path is correct.")
     }
 
-    // Bcast the table to all MPI ranks
+    // Bcast the table parameters to all MPI ranks
     MultiphotonBreitWheelerTables::bcastTableT( smpi );
 
 }
@@ -324,9 +329,10 @@ void MultiphotonBreitWheelerTables::readTableXi( SmileiMPI *smpi )
             
             // Allocate and read arrays
             xi_.min_particle_chi_.resize( xi_.size_photon_chi_ );
-            xi_.table_.resize( xi_.size_particle_chi_*xi_.size_photon_chi_ );
+            std::vector<double> table( xi_.size_particle_chi_*xi_.size_photon_chi_ );
             f.vect( "min_particle_chi_for_xi", xi_.min_particle_chi_ );
-            f.vect( "xi", xi_.table_ );
+            f.vect( "xi", table );
+            xi_.table_ = table;
             
         }
     }
@@ -337,7 +343,7 @@ void MultiphotonBreitWheelerTables::readTableXi( SmileiMPI *smpi )
               << table_path_<<"`. Please check that the path is correct.")
     }
     
-    // Bcast the table to all MPI ranks
+    // Bcast the table parameters to all MPI ranks
     MultiphotonBreitWheelerTables::bcastTableXi( smpi );
 
 }
@@ -385,9 +391,6 @@ void MultiphotonBreitWheelerTables::bcastTableT( SmileiMPI *smpi )
         buf_size = position;
         MPI_Pack_size( 2, MPI_DOUBLE, smpi->world(), &position );
         buf_size += position;
-        MPI_Pack_size( T_.size_photon_chi_, MPI_DOUBLE, smpi->world(),
-                       &position );
-        buf_size += position;
     }
 
     //MESSAGE( 2,"Buffer size: " << buf_size );
@@ -408,9 +411,6 @@ void MultiphotonBreitWheelerTables::bcastTableT( SmileiMPI *smpi )
         MPI_Pack( &T_.max_photon_chi_,
                   1, MPI_DOUBLE, buffer, buf_size, &position, smpi->world() );
 
-        MPI_Pack( &T_.table_[0], T_.size_photon_chi_,
-                  MPI_DOUBLE, buffer, buf_size, &position, smpi->world() );
-
     }
 
     // Bcast all parameters
@@ -426,12 +426,6 @@ void MultiphotonBreitWheelerTables::bcastTableT( SmileiMPI *smpi )
         MPI_Unpack( buffer, buf_size, &position,
                     &T_.max_photon_chi_, 1, MPI_DOUBLE, smpi->world() );
 
-        // Resize table before unpacking values
-        T_.table_.resize( T_.size_photon_chi_ );
-
-        MPI_Unpack( buffer, buf_size, &position, &T_.table_[0],
-                    T_.size_photon_chi_, MPI_DOUBLE, smpi->world() );
-
     }
 
     delete[] buffer;
@@ -472,9 +466,6 @@ void MultiphotonBreitWheelerTables::bcastTableXi( SmileiMPI *smpi )
         MPI_Pack_size( xi_.size_photon_chi_, MPI_DOUBLE, smpi->world(),
                        &position );
         buf_size += position;
-        MPI_Pack_size( xi_.size_photon_chi_*xi_.size_particle_chi_, MPI_DOUBLE,
-                       smpi->world(), &position );
-        buf_size += position;
     }
 
     //MESSAGE( 2,"Buffer size for MPI exchange: " << buf_size );
@@ -499,9 +490,6 @@ void MultiphotonBreitWheelerTables::bcastTableXi( SmileiMPI *smpi )
 
         MPI_Pack( &xi_.min_particle_chi_[0], xi_.size_photon_chi_,
                   MPI_DOUBLE, buffer, buf_size, &position, smpi->world() );
-
-        MPI_Pack( &xi_.table_[0], xi_.size_particle_chi_*xi_.size_photon_chi_,
-                  MPI_DOUBLE, buffer, buf_size, &position, smpi->world() );
     }
 
     // Bcast all parameters
@@ -519,15 +507,11 @@ void MultiphotonBreitWheelerTables::bcastTableXi( SmileiMPI *smpi )
         MPI_Unpack( buffer, buf_size, &position,
                     &xi_.max_photon_chi_, 1, MPI_DOUBLE, smpi->world() );
 
-        // Resize tables before unpacking values
+        // Resize table before unpacking values
         xi_.min_particle_chi_.resize( xi_.size_photon_chi_ );
-        xi_.table_.resize( xi_.size_particle_chi_*xi_.size_photon_chi_ );
 
         MPI_Unpack( buffer, buf_size, &position, &xi_.min_particle_chi_[0],
                     xi_.size_photon_chi_, MPI_DOUBLE, smpi->world() );
-
-        MPI_Unpack( buffer, buf_size, &position, &xi_.table_[0],
-                    xi_.size_particle_chi_*xi_.size_photon_chi_, MPI_DOUBLE, smpi->world() );
     }
 
     delete[] buffer;
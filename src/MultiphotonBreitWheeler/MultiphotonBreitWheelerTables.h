@@ -22,6 +22,7 @@
 #include "Params.h"
 #include "userFunctions.h"
 #include "Random.h"
+#include "NodeSharedArray.h"
 
 //------------------------------------------------------------------------------
 //! MutliphotonBreitWheelerTables class: holds parameters, tables and
@@ -95,7 +96,7 @@ public:
     struct T {
         
         //! Array containing tabulated values of the function T
-        std::vector<double > table_;
+        NodeSharedArray table_;
         
         //! Minimum boundary of the table T
         double min_photon_chi_;
@@ -129,7 +130,7 @@ public:
         //! that gives gives the probability for a photon to decay into pair
         //! with an electron of energy in the range \f$[0, \chi_{e^-}]\f$
         //! This enables to compute the energy repartition between the electron and the positron
-        std::vector<double> table_;
+        NodeSharedArray table_;
         
         //! Table containing the particle_chi min values
         //! Under this value, electron kinetic energy of the pair is
@@ -204,13 +204,17 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     keep_python_running_ = PyTools::runPyFunction<bool>( "_keep_python_running" );
     
     // random seed
-    if( PyTools::extractOrNone( "random_seed", random_seed, "Main" ) ) {
-        // Init of the seed for the vectorized C++ random generator recommended by Intel
-        // See https://software.intel.com/en-us/articles/random-number-function-vectorization
-        srand48( random_seed );
-        // Init of the seed for the C++ random generator
-        Rand::gen = std::mt19937( random_seed );
-    }
+    if( ! PyTools::extractOrNone( "random_seed", random_seed, "Main" ) ) {
+        // Seed from the clock of the master, so that all processes share the same key
+        int seed = ( int )std::time( NULL );
+        smpi->bcast( seed );
+        random_seed = ( unsigned int )seed;
+    }
+    // Init of the seed for the vectorized C++ random generator recommended by Intel
+    // See https://software.intel.com/en-us/articles/random-number-function-vectorization
+    srand48( random_seed );
+    // Init of the seed for the C++ random generator
+    Rand::gen = std::mt19937( random_seed );
 
     // communication pattern initialized as partial B exchange
     full_B_exchange = false;
@@ -261,6 +265,11 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
         is_pxr = true;
     }
 
+    PyTools::extract( "fused_maxwell_solver", fused_maxwell_solver, "Main" );
+    if( fused_maxwell_solver && ( geometry != "3Dcartesian" || ( maxwell_sol != "Yee" && maxwell_sol != "Lehe" ) ) ) {
+        ERROR( "Main.fused_maxwell_solver is only available for the Yee and Lehe solvers in 3Dcartesian geometry" );
+    }
+
 #ifndef _PICSAR
     if (is_pxr) {
         ERROR( "Smilei not linked with picsar, use make config=picsar" );
@@ -468,6 +477,25 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     PyTools::extract( "solve_relativistic_poisson", solve_relativistic_poisson, "Main"   );
     PyTools::extract( "relativistic_poisson_max_iteration", relativistic_poisson_max_iteration, "Main"   );
     PyTools::extract( "relativistic_poisson_max_error", relativistic_poisson_max_error, "Main"   );
+    // Conjugate gradient variant
+    std::string poisson_solver;
+    PyTools::extract( "poisson_solver", poisson_solver, "Main" );
+    if( poisson_solver != "cg" && poisson_solver != "pipelined_cg" ) {
+        ERROR( "Main.poisson_solver must be `cg` or `pipelined_cg`" );
+    }
+    poisson_pipelined = ( poisson_solver == "pipelined_cg" );
+    std::string poisson_preconditioner;
+    PyTools::extract( "poisson_preconditioner", poisson_preconditioner, "Main" );
+    if( poisson_preconditioner != "none" && poisson_preconditioner != "block_jacobi" ) {
+        ERROR( "Main.poisson_preconditioner must be `none` or `block_jacobi`" );
+    }
+    poisson_block_jacobi = ( poisson_preconditioner == "block_jacobi" );
+    if( poisson_block_jacobi && !poisson_pipelined ) {
+        ERROR( "Main.poisson_preconditioner requires Main.poisson_solver = `pipelined_cg`" );
+    }
+    if( poisson_pipelined && geometry == "AMcylindrical" ) {
+        ERROR( "Main.poisson_solver = `pipelined_cg` is not available in AMcylindrical geometry" );
+    }
 
     // Current filter properties
     int nCurrentFilter = PyTools::nComponents( "CurrentFilter" );
@@ -603,6 +631,8 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
 
 
 
+    measured_load_balancing = false;
+    load_smoothing = 0.;
     if( PyTools::nComponents( "LoadBalancing" )>0 ) {
         // get parameter "every" which describes a timestep selection
         load_balancing_time_selection = new TimeSelection(
@@ -611,6 +641,17 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
         PyTools::extract( "cell_load", cell_load, "LoadBalancing"   );
         PyTools::extract( "frozen_particle_load", frozen_particle_load, "LoadBalancing"   );
         PyTools::extract( "initial_balance", initial_balance, "LoadBalancing"   );
+        std::string load_model;
+        PyTools::extract( "load_model", load_model, "LoadBalancing"   );
+        if( load_model == "measured" ) {
+            measured_load_balancing = true;
+        } else if( load_model != "particles" ) {
+            ERROR( "LoadBalancing.load_model must be `particles` or `measured`" );
+        }
+        PyTools::extract( "load_smoothing", load_smoothing, "LoadBalancing"   );
+        if( load_smoothing < 0. || load_smoothing >= 1. ) {
+            ERROR( "LoadBalancing.load_smoothing must be in [0, 1)" );
+        }
     } else {
         load_balancing_time_selection = new TimeSelection();
     }
@@ -700,6 +741,41 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
         }
             
     }
+    
+    // Collisions shared between threads per patch or per bin
+    string collisions_threading( "patches" );
+    PyTools::extract( "collisions_threading", collisions_threading, "Main" );
+    if( collisions_threading == "patches" ) {
+        collisions_bin_threading = false;
+    } else if( collisions_threading == "bins" ) {
+        collisions_bin_threading = true;
+    } else {
+        ERROR( "`collisions_threading` must be 'patches' or 'bins'" );
+    }
+    PyTools::extract( "reproducible_collisions", reproducible_collisions, "Main" );
+
+    // Task-based scheduling of the patches
+    PyTools::extract( "task_scheduling", task_scheduling, "Main" );
+#ifdef _NO_MPI_TM
+    if( task_scheduling ) {
+        ERROR( "`task_scheduling` requires MPI_THREAD_MULTIPLE (code compiled with -D_NO_MPI_TM)" );
+    }
+#endif
+
+    // Halo exchange of the fields : per patch or aggregated per neighbouring MPI rank
+    string halo_exchange( "patch" );
+    PyTools::extract( "halo_exchange", halo_exchange, "Main" );
+    if( halo_exchange == "patch" ) {
+        aggregated_exchange = false;
+    } else if( halo_exchange == "rank" ) {
+        aggregated_exchange = true;
+        if( geometry == "AMcylindrical" ) {
+            ERROR( "`halo_exchange = 'rank'` is not available in AMcylindrical geometry" );
+        }
+    } else {
+        ERROR( "`halo_exchange` must be 'patch' or 'rank'" );
+    }
+    PyTools::extract( "persistent_communications", persistent_communications, "Main" );
 
     // Read the "print_every" parameter
     print_every = ( int )( simulation_time/timestep )/10;
@@ -1082,15 +1158,6 @@ void Params::check_consistency()
 {
     if( vectorization_mode != "off" ) {
 
-        if( ( geometry=="1Dcartesian" ) ) {
-            ERROR( "Vectorized algorithms not implemented for this geometry" );
-        }
-
-        if( ( geometry=="2Dcartesian" ) && ( interpolation_order==4 ) ) {
-            ERROR( "4th order vectorized algorithms not implemented in 2D" );
-        }
-
-
         if( hasMultiphotonBreitWheeler ) {
             WARNING( "Performances of advanced physical processes which generates new particles could be degraded for the moment !" );
             WARNING( "\t The improvment of their integration in vectorized algorithm is in progress." );
@@ -1132,7 +1199,7 @@ void Params::print_init()
 {
     TITLE( "Geometry: " << geometry );
     MESSAGE( 1, "Interpolation order : " <<  interpolation_order );
-    MESSAGE( 1, "Maxwell solver : " <<  maxwell_sol );
+    MESSAGE( 1, "Maxwell solver : " <<  maxwell_sol << ( fused_maxwell_solver ? " (Maxwell-Ampere and Maxwell-Faraday fused)" : "" ) );
     MESSAGE( 1, "simulation duration = " << simulation_time <<",   total number of iterations = " << n_time);
     MESSAGE( 1, "timestep = " << timestep << " = " << timestep/dtCFL << " x CFL,   time resolution = " << res_time);
     
@@ -1209,6 +1276,9 @@ void Params::print_init()
         MESSAGE( 1, "Happens: " << load_balancing_time_selection->info() );
         MESSAGE( 1, "Cell load coefficient = " << cell_load );
         MESSAGE( 1, "Frozen particle load coefficient = " << frozen_particle_load );
+        if( measured_load_balancing ) {
+            MESSAGE( 1, "Load model: measured per-patch wall time (smoothing = " << load_smoothing << ")" );
+        }
     }
 
     TITLE( "Vectorization: " );
@@ -1301,6 +1371,15 @@ void Params::print_parallelism_params( SmileiMPI *smpi )
         MESSAGE( 1, ps.str() );
         
         MESSAGE( 1, "Dynamic load balancing: " << load_balancing_time_selection->info() );
+        if( task_scheduling ) {
+            MESSAGE( 1, "Patch scheduling: OpenMP tasks" );
+        }
+        if( aggregated_exchange ) {
+            MESSAGE( 1, "Fields halo exchange: aggregated per MPI rank" );
+        }
+        if( persistent_communications ) {
+            MESSAGE( 1, "Fields halo exchange: persistent MPI requests" );
+        }
     }
 
 }
@@ -162,6 +162,11 @@ public:
     //! Maxium relativistic poisson error tolerated
     double relativistic_poisson_max_error;
 
+    //! Pipelined conjugate gradient for both Poisson solvers (Main.poisson_solver="pipelined_cg")
+    bool poisson_pipelined;
+    //! Block Jacobi preconditioner of the pipelined conjugate gradient (Main.poisson_preconditioner="block_jacobi")
+    bool poisson_block_jacobi;
+
     //! Do we need to exchange full B (default=0 <=> only 2 components are exchanged by dimension)
     bool full_B_exchange;
     //! Do we need to exchange full A,Phi,Chi (default=0 <=> only 2 components are exchanged by dimension)
@@ -169,6 +174,8 @@ public:
     
     //! Maxwell Solver (default='Yee')
     std::string maxwell_sol;
+    //! Maxwell-Ampere and Maxwell-Faraday solved in a single sweep of the patch (3D Yee and Lehe)
+    bool fused_maxwell_solver;
 
     //! Current spatial filter: number of binomial passes
     std::vector<unsigned int> currentFilter_passes;
@@ -274,6 +281,10 @@ public:
     bool one_patch_per_MPI;
     //! Compute an initially balanced patch distribution right from the start
     bool initial_balance;
+    //! Balance the load measured by per-patch timers instead of the load estimated from particle counts
+    bool measured_load_balancing;
+    //! Weight of the history in the exponential moving average of the measured load of each patch
+    double load_smoothing;
 
     //! String containing the vectorization mode: off, on, adaptive, adaptive_mixed_sort
     std::string vectorization_mode;
@@ -362,6 +373,21 @@ public:
     unsigned int timestep_width;
 
     bool cell_sorting;
+
+    //! Schedule particle dynamics and particle exchange as a graph of OpenMP tasks per patch
+    bool task_scheduling;
+
+    //! Exchange the fields halos with a single message per neighbouring MPI rank (Main.halo_exchange = "rank")
+    bool aggregated_exchange;
+
+    //! Reuse the MPI requests of the halo exchanges between two decomposition changes
+    bool persistent_communications;
+
+    //! Collisions: all threads share the bins of each patch, instead of sharing the patches (Main.collisions_threading = "bins")
+    bool collisions_bin_threading;
+
+    //! Collisions: one random stream per bin, so that the results do not depend on the number of threads
+    bool reproducible_collisions;
 };
 
 #endif
@@ -83,6 +83,7 @@ public:
         this_particle_injector = new ParticleInjector(params, patch);
         
         this_particle_injector->name_ = injector_name;
+        this_particle_injector->injector_number_ = injector_index;
         this_particle_injector->species_name_ = species_name;
         this_particle_injector->species_number_ = species_number;
         this_particle_injector->box_side_ = box_side;
@@ -0,0 +1,111 @@
+#include "ParticleArena.h"
+
+#include <cstdlib>
+
+#include "Tools.h"
+
+using namespace std;
+
+ParticleArena::ParticleArena() :
+    base_( NULL ),
+    bytes_( 0 ),
+    capacity_( 0 )
+{
+}
+
+ParticleArena::~ParticleArena()
+{
+    release();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Register a new property: existing slots are kept, the new one starts empty
+// ---------------------------------------------------------------------------------------------------------------------
+unsigned int ParticleArena::addProperty( size_t element_size )
+{
+    element_size_.push_back( element_size );
+    offset_.push_back( 0 );
+    size_.push_back( 0 );
+    relayout( capacity_ );
+    return element_size_.size()-1;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set the shared capacity to at least n elements
+// ---------------------------------------------------------------------------------------------------------------------
+void ParticleArena::reserve( size_t n )
+{
+    if( n > capacity_ ) {
+        relayout( n );
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Remove the extra capacity of all the slots
+// ---------------------------------------------------------------------------------------------------------------------
+void ParticleArena::shrinkToFit()
+{
+    size_t n = 0;
+    for( unsigned int islot=0 ; islot<size_.size() ; islot++ ) {
+        if( size_[islot] > n ) {
+            n = size_[islot];
+        }
+    }
+    if( n < capacity_ ) {
+        relayout( n );
+    }
+}
+
+void ParticleArena::release()
+{
+    free( base_ );
+    base_ = NULL;
+    bytes_ = 0;
+    capacity_ = 0;
+    for( unsigned int islot=0 ; islot<size_.size() ; islot++ ) {
+        offset_[islot] = 0;
+        size_[islot] = 0;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Allocate a new block where each slot starts on an aligned address, and copy the existing data
+// ---------------------------------------------------------------------------------------------------------------------
+void ParticleArena::relayout( size_t new_capacity )
+{
+    unsigned int nslots = element_size_.size();
+
+    // Offsets of the slots in the new block
+    vector<size_t> new_offset( nslots );
+    size_t new_bytes = 0;
+    for( unsigned int islot=0 ; islot<nslots ; islot++ ) {
+        new_offset[islot] = new_bytes;
+        size_t slot_bytes = new_capacity * element_size_[islot];
+        new_bytes += ( ( slot_bytes + alignment - 1 ) / alignment ) * alignment;
+    }
+
+    char *new_base = NULL;
+    if( new_bytes > 0 ) {
+        void *p = NULL;
+        if( posix_memalign( &p, alignment, new_bytes ) != 0 ) {
+            ERROR( "Cannot allocate " << new_bytes << " bytes for the particles" );
+        }
+        new_base = ( char * ) p;
+    }
+
+    // Copy the content of each slot
+    for( unsigned int islot=0 ; islot<nslots ; islot++ ) {
+        if( size_[islot] > new_capacity ) {
+            size_[islot] = new_capacity;
+        }
+        if( size_[islot] > 0 ) {
+            memcpy( new_base + new_offset[islot], base_ + offset_[islot], size_[islot]*element_size_[islot] );
+        }
+    }
+
+    free( base_ );
+    base_ = new_base;
+    bytes_ = new_bytes;
+    capacity_ = new_capacity;
+    offset_ = new_offset;
+}
@@ -0,0 +1,320 @@
+#ifndef PARTICLEARENA_H
+#define PARTICLEARENA_H
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------------------------
+//! ParticleArena class: a single 64-byte aligned memory block holding all the
+//! properties (positions, momenta, weight, charge, ...) of a Particles object.
+//! Each property owns a slot located at a fixed offset in the block and all
+//! slots share the same capacity, so that a reallocation touches one block only.
+//----------------------------------------------------------------------------------------------------------------------
+class ParticleArena
+{
+public:
+    //! Alignment (in bytes) of the block and of each property slot
+    static const std::size_t alignment = 64;
+
+    ParticleArena();
+    ~ParticleArena();
+
+    //! Register a new property whose elements are element_size bytes long, returns its slot
+    unsigned int addProperty( std::size_t element_size );
+
+    //! Make sure that every property can hold n elements without reallocation
+    void reserve( std::size_t n );
+
+    //! Grow the shared capacity (geometrically) when a property needs n elements
+    inline void grow( std::size_t n )
+    {
+        if( n > capacity_ ) {
+            reserve( n > 2*capacity_ ? n : 2*capacity_ );
+        }
+    }
+
+    //! Reduce the shared capacity to the largest property size
+    void shrinkToFit();
+
+    //! Free the block (all the properties become empty)
+    void release();
+
+    //! Shared capacity (in number of elements)
+    inline std::size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    //! Address of the first element of a property
+    inline char *data( unsigned int slot ) const
+    {
+        return base_ + offset_[slot];
+    }
+
+    //! Number of elements stored in a property
+    inline std::size_t &size( unsigned int slot )
+    {
+        return size_[slot];
+    }
+
+    //! True if the address p lies inside the block
+    inline bool owns( const void *p ) const
+    {
+        return base_ && ( const char * )p >= base_ && ( const char * )p < base_ + bytes_;
+    }
+
+    //! Total number of bytes allocated
+    inline std::size_t bytes() const
+    {
+        return bytes_;
+    }
+
+private:
+    //! The arena cannot be shared between two Particles
+    ParticleArena( const ParticleArena & );
+    ParticleArena &operator=( const ParticleArena & );
+
+    //! Reallocate the block with a new capacity, and move every slot in it
+    void relayout( std::size_t new_capacity );
+
+    //! Start of the aligned block
+    char *base_;
+    //! Size of the block in bytes
+    std::size_t bytes_;
+    //! Number of elements that each slot can hold
+    std::size_t capacity_;
+
+    //! Size of one element, offset in the block and number of elements of each slot
+    std::vector<std::size_t> element_size_;
+    std::vector<std::size_t> offset_;
+    std::vector<std::size_t> size_;
+};
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//! ArenaVector class: a std::vector-like view on one slot of a ParticleArena.
+//! The slot is registered the first time the property needs storage, so that
+//! unused properties (Id, Chi, Tau, ...) do not consume any memory.
+//! As for std::vector, growing a property invalidates pointers to its elements,
+//! but here it also invalidates pointers to the other properties of the arena.
+//----------------------------------------------------------------------------------------------------------------------
+template<typename T>
+class ArenaVector
+{
+public:
+    typedef T value_type;
+    typedef T *iterator;
+    typedef const T *const_iterator;
+
+    ArenaVector() : arena_( NULL ), slot_( -1 ) {};
+
+    //! A slot belongs to one property only: properties can be moved but not copy-constructed
+    ArenaVector( const ArenaVector & ) = delete;
+    ArenaVector( ArenaVector &&v ) noexcept : arena_( v.arena_ ), slot_( v.slot_ )
+    {
+        v.arena_ = NULL;
+        v.slot_ = -1;
+    }
+
+    //! Copying a property copies its content, the destination keeps its own arena
+    ArenaVector &operator=( const ArenaVector &v )
+    {
+        if( this != &v ) {
+            clear();
+            insert( end(), v.begin(), v.end() );
+        }
+        return *this;
+    }
+
+    //! Attach this property to an arena (no memory is used until the first element)
+    inline void bind( ParticleArena *arena )
+    {
+        if( ! arena_ ) {
+            arena_ = arena;
+        }
+    }
+
+    inline std::size_t size() const
+    {
+        return slot_ < 0 ? 0 : arena_->size( slot_ );
+    }
+    inline std::size_t capacity() const
+    {
+        return slot_ < 0 ? 0 : arena_->capacity();
+    }
+    inline bool empty() const
+    {
+        return size() == 0;
+    }
+
+    inline T *data() const
+    {
+        return slot_ < 0 ? NULL : ( T * ) arena_->data( slot_ );
+    }
+    inline T &operator[]( std::size_t i )
+    {
+        return data()[i];
+    }
+    inline const T &operator[]( std::size_t i ) const
+    {
+        return data()[i];
+    }
+    inline T &back()
+    {
+        return data()[size()-1];
+    }
+
+    inline iterator begin()
+    {
+        return data();
+    }
+    inline iterator end()
+    {
+        return data() + size();
+    }
+    inline const_iterator begin() const
+    {
+        return data();
+    }
+    inline const_iterator end() const
+    {
+        return data() + size();
+    }
+
+    inline void reserve( std::size_t n )
+    {
+        if( n > 0 ) {
+            allocate();
+            arena_->reserve( n );
+        }
+    }
+
+    void resize( std::size_t n, const T &value = T() )
+    {
+        std::size_t s = size();
+        if( n > s ) {
+            T v = value;
+            grow( n );
+            T *d = data();
+            for( std::size_t i = s; i < n; i++ ) {
+                d[i] = v;
+            }
+        }
+        if( slot_ >= 0 ) {
+            arena_->size( slot_ ) = n;
+        }
+    }
+
+    inline void push_back( const T &value )
+    {
+        // value may refer to an element of the arena: copy it before growing
+        T v = value;
+        std::size_t s = size();
+        grow( s+1 );
+        data()[s] = v;
+        arena_->size( slot_ ) = s+1;
+    }
+
+    inline void clear()
+    {
+        if( slot_ >= 0 ) {
+            arena_->size( slot_ ) = 0;
+        }
+    }
+
+    //! Insert one value before pos
+    iterator insert( iterator pos, const T &value )
+    {
+        return insert( pos, 1, value );
+    }
+
+    //! Insert n copies of value before pos
+    iterator insert( iterator pos, std::size_t n, const T &value )
+    {
+        T v = value;
+        std::size_t ipos = pos - begin();
+        std::size_t s = size();
+        if( n == 0 ) {
+            return begin() + ipos;
+        }
+        grow( s+n );
+        T *d = data();
+        std::memmove( d+ipos+n, d+ipos, ( s-ipos )*sizeof( T ) );
+        for( std::size_t i = 0; i < n; i++ ) {
+            d[ipos+i] = v;
+        }
+        arena_->size( slot_ ) = s+n;
+        return d + ipos;
+    }
+
+    //! Insert the range [first, last) before pos
+    template<class InputIt>
+    typename std::enable_if<!std::is_integral<InputIt>::value, iterator>::type
+    insert( iterator pos, InputIt first, InputIt last )
+    {
+        std::size_t ipos = pos - begin();
+        std::size_t s = size();
+        std::size_t n = last - first;
+        if( n == 0 ) {
+            return begin() + ipos;
+        }
+        // The source may be located in the arena that is about to be reallocated
+        const T *src = &( *first );
+        std::vector<T> copy;
+        if( arena_->owns( src ) ) {
+            copy.assign( first, last );
+            src = &copy[0];
+        }
+        grow( s+n );
+        T *d = data();
+        std::memmove( d+ipos+n, d+ipos, ( s-ipos )*sizeof( T ) );
+        std::memcpy( d+ipos, src, n*sizeof( T ) );
+        arena_->size( slot_ ) = s+n;
+        return d + ipos;
+    }
+
+    //! Remove the element at pos
+    inline iterator erase( iterator pos )
+    {
+        return erase( pos, pos+1 );
+    }
+
+    //! Remove the elements in [first, last)
+    iterator erase( iterator first, iterator last )
+    {
+        T *d = data();
+        std::size_t i0 = first - d;
+        std::size_t i1 = last - d;
+        std::size_t s = size();
+        if( i1 > i0 ) {
+            std::memmove( d+i0, d+i1, ( s-i1 )*sizeof( T ) );
+            arena_->size( slot_ ) = s - ( i1-i0 );
+        }
+        return data() + i0;
+    }
+
+private:
+    //! Register the slot in the arena if not done yet
+    inline void allocate()
+    {
+        if( slot_ < 0 ) {
+            slot_ = arena_->addProperty( sizeof( T ) );
+        }
+    }
+
+    //! Make sure that the slot can hold n elements
+    inline void grow( std::size_t n )
+    {
+        allocate();
+        arena_->grow( n );
+    }
+
+    //! Arena holding the data
+    ParticleArena *arena_;
+    //! Index of the slot in the arena (-1 if no storage yet)
+    int slot_;
+};
+
+#endif
@@ -78,6 +78,8 @@ void ParticleCreator::associate( ParticleInjector * particle_injector, Particles
     particles_per_cell_profile_ = particle_injector->particles_per_cell_profile_;
     
     regular_number_array_ = particle_injector->regular_number_array_;
+    
+    rand_stream_ = Random::stream( particle_injector->injector_number_, Random::particle_injection );
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -107,6 +109,8 @@ void ParticleCreator::associate( Species * species)
     particles_per_cell_profile_ = species->particles_per_cell_profile_;
     
     regular_number_array_ = species->regular_number_array_;
+    
+    rand_stream_ = Random::stream( species->species_number_, Random::particle_creation );
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -121,6 +125,9 @@ int ParticleCreator::create( struct SubSpace sub_space,
     unsigned int n_existing_particles = particles_->size();
     unsigned int n_new_particles = 0;
     
+    // Counter-based random numbers of this timestep
+    patch->rand_->setCounter( params.random_seed, patch->hindex, itime );
+    
     std::vector<unsigned int> n_space_to_create( 3, 0 );
     for( unsigned int idim=0 ; idim<3 ; idim++ ) {
         n_space_to_create[idim] = sub_space.box_size_[idim];
@@ -280,7 +287,9 @@ int ParticleCreator::create( struct SubSpace sub_space,
             if( species_->getNbrOfParticles() != patch->vecSpecies[ispec]->getNbrOfParticles() ) {
                 ERROR( "Copying particles: species '"<<species_->name_<<"' and '"<<patch->vecSpecies[ispec]->name_<<"' should have the same number of particles");
             }
-            particles_->Position = patch->vecSpecies[ispec]->particles->Position;
+            for( unsigned int idim=0 ; idim<particles_->Position.size() ; idim++ ) {
+                particles_->Position[idim] = patch->vecSpecies[ispec]->particles->Position[idim];
+            }
         }
         
         // In AM, normalization of weights might be required
@@ -324,9 +333,9 @@ int ParticleCreator::create( struct SubSpace sub_space,
                         temp[2] = temperature[2]( i, j, k );
                         
                         if( (! position_initialization_on_species_) && (! disable_position_initialization_) ) {
-                            ParticleCreator::createPosition( position_initialization_, regular_number_array_,  particles_, species_, nPart, iPart, indexes, params );
+                            ParticleCreator::createPosition( position_initialization_, regular_number_array_,  particles_, species_, nPart, iPart, indexes, params, patch->rand_, rand_stream_ );
                         }
-                        ParticleCreator::createMomentum( momentum_initialization_, particles_, species_,  nPart, iPart, &temp[0], &vel[0] );
+                        ParticleCreator::createMomentum( momentum_initialization_, particles_, species_,  nPart, iPart, &temp[0], &vel[0], patch->rand_, rand_stream_ );
                         ParticleCreator::createWeight( position_initialization_, particles_, nPart, iPart, density( i, j, k ), params, renormalize );
                         ParticleCreator::createCharge( particles_, species_, nPart, iPart, charge( i, j, k ) );
                         
@@ -499,7 +508,7 @@ int ParticleCreator::create( struct SubSpace sub_space,
                     temp[0] = temperature[0]( int_ijk[0], int_ijk[1], int_ijk[2] );
                     temp[1] = temperature[1]( int_ijk[0], int_ijk[1], int_ijk[2] );
                     temp[2] = temperature[2]( int_ijk[0], int_ijk[1], int_ijk[2] );
-                    ParticleCreator::createMomentum( momentum_initialization_, particles_, species_, 1, ip, temp, vel );
+                    ParticleCreator::createMomentum( momentum_initialization_, particles_, species_, 1, ip, temp, vel, patch->rand_, rand_stream_ );
                 }
                 // Assign weight
                 particles_->weight( ip ) = weight[ippy];
@@ -532,7 +541,9 @@ void ParticleCreator::createPosition( std::string position_initialization,
                                     unsigned int nPart,
                                     unsigned int iPart,
                                     double *indexes,
-                                    Params &params )
+                                    Params &params,
+                                    Random *rand,
+                                    uint32_t rand_stream )
 {
     if( position_initialization == "regular" ) {
 
@@ -619,7 +630,7 @@ void ParticleCreator::createPosition( std::string position_initialization,
                 for( unsigned int ir = 0 ; ir < Np_array[1]; ir++ ) {
                     double qr = indexes[1] + dr*( ir+0.5 );
                     int nr = ir*( Np_array[2] );
-                    theta_offset = Rand::uniform()*2.*M_PI;
+                    theta_offset = rand->uniform( rand_stream, 0, nx+nr+iPart )*2.*M_PI;
                     for( unsigned int itheta = 0 ; itheta < Np_array[2]; itheta++ ) {
                         int p = nx+nr+itheta+iPart;
                         double theta = theta_offset + itheta*dtheta;
@@ -632,19 +643,25 @@ void ParticleCreator::createPosition( std::string position_initialization,
         }
 
     } else if( position_initialization == "random" ) {
+        // One array of random numbers per dimension (draw number = dimension)
+        std::vector<double> U( 3*nPart );
+        for( unsigned int i=0; i<species->nDim_particle ; i++ ) {
+            rand->uniforms( &U[i*nPart], nPart, rand_stream, i, iPart );
+        }
         if( params.geometry=="AMcylindrical" ) {
             double particles_r, particles_theta;
             for( unsigned int p= iPart; p<iPart+nPart; p++ ) {
-                particles->position( 0, p )=indexes[0]+Rand::uniform()*species->cell_length[0];
-                particles_r=sqrt( indexes[1]*indexes[1]+ 2.*Rand::uniform()*( indexes[1]+species->cell_length[1]*0.5 )*species->cell_length[1] );
-                particles_theta=Rand::uniform()*2.*M_PI;
+                particles->position( 0, p )=indexes[0]+U[p-iPart]*species->cell_length[0];
+                particles_r=sqrt( indexes[1]*indexes[1]+ 2.*U[nPart+p-iPart]*( indexes[1]+species->cell_length[1]*0.5 )*species->cell_length[1] );
+                particles_theta=U[2*nPart+p-iPart]*2.*M_PI;
                 particles->position( 2, p )=particles_r*sin( particles_theta );
                 particles->position( 1, p )= particles_r*cos( particles_theta );
             }
         } else {
-            for( unsigned int p= iPart; p<iPart+nPart; p++ ) {
-                for( unsigned int i=0; i<species->nDim_particle ; i++ ) {
-                    particles->position( i, p )=indexes[i]+Rand::uniform()*species->cell_length[i];
+            for( unsigned int i=0; i<species->nDim_particle ; i++ ) {
+                double *Ui = &U[i*nPart];
+                for( unsigned int p= iPart; p<iPart+nPart; p++ ) {
+                    particles->position( i, p )=indexes[i]+Ui[p-iPart]*species->cell_length[i];
                 }
             }
         }
@@ -669,7 +686,9 @@ void ParticleCreator::createMomentum( std::string momentum_initialization,
                                     unsigned int nPart,
                                     unsigned int iPart,
                                     double * temp,
-                                    double * vel )
+                                    double * vel,
+                                    Random * rand,
+                                    uint32_t rand_stream )
 {
     // -------------------------------------------------------------------------
     // Particles
@@ -689,12 +708,15 @@ void ParticleCreator::createMomentum( std::string momentum_initialization,
         } else if( momentum_initialization == "maxwell-juettner" ) {
 
             // Sample the energies in the MJ distribution
-            std::vector<double> energies = maxwellJuttner( species, nPart, temp[0]/species->mass_ );
+            std::vector<double> energies = maxwellJuttner( species, nPart, temp[0]/species->mass_, rand, rand_stream, iPart );
 
             // Sample angles randomly and calculate the momentum
+            std::vector<double> U( 2*nPart );
+            rand->uniforms( &U[0], nPart, rand_stream, draw_angles, iPart );
+            rand->uniforms( &U[nPart], nPart, rand_stream, draw_angles+1, iPart );
             for( unsigned int p=iPart; p<iPart+nPart; p++ ) {
-                double phi   = acos( -Rand::uniform2() );
-                double theta = 2.0*M_PI*Rand::uniform();
+                double phi   = acos( 1. - 2.*U[p-iPart] );
+                double theta = 2.0*M_PI*U[nPart+p-iPart];
                 double psm = sqrt( pow( 1.0+energies[p-iPart], 2 )-1.0 );
 
                 particles->momentum( 0, p ) = psm*cos( theta )*sin( phi );
@@ -714,11 +736,13 @@ void ParticleCreator::createMomentum( std::string momentum_initialization,
             // Rectangular distribution
         } else if( momentum_initialization == "rectangular" ) {
 
-            double t0 = sqrt( temp[0]/species->mass_ ), t1 = sqrt( temp[1]/species->mass_ ), t2 = sqrt( temp[2]/species->mass_ );
-            for( unsigned int p= iPart; p<iPart+nPart; p++ ) {
-                particles->momentum( 0, p ) = Rand::uniform2() * t0;
-                particles->momentum( 1, p ) = Rand::uniform2() * t1;
-                particles->momentum( 2, p ) = Rand::uniform2() * t2;
+            double t[3] = { sqrt( temp[0]/species->mass_ ), sqrt( temp[1]/species->mass_ ), sqrt( temp[2]/species->mass_ ) };
+            std::vector<double> U( nPart );
+            for( unsigned int i=0; i<3; i++ ) {
+                rand->uniforms( &U[0], nPart, rand_stream, draw_energy+i, iPart );
+                for( unsigned int p= iPart; p<iPart+nPart; p++ ) {
+                    particles->momentum( i, p ) = ( 2.*U[p-iPart] - 1. ) * t[i];
+                }
             }
         }
 
@@ -753,6 +777,8 @@ void ParticleCreator::createMomentum( std::string momentum_initialization,
             // Volume transformation method (here is the correction by Zenitani)
             double Volume_Acc;
             double CheckVelocity;
+            std::vector<double> U( nPart );
+            rand->uniforms( &U[0], nPart, rand_stream, draw_boost, iPart );
 
             // Lorentz transformation of the momentum
             for( unsigned int p=iPart; p<iPart+nPart; p++ ) {
@@ -764,7 +790,7 @@ void ParticleCreator::createMomentum( std::string momentum_initialization,
                 CheckVelocity = ( vx*particles->momentum( 0, p )
                               + vy*particles->momentum( 1, p )
                               + vz*particles->momentum( 2, p ) ) * inverse_gamma;
-                Volume_Acc = Rand::uniform();
+                Volume_Acc = U[p-iPart];
                 if( CheckVelocity > Volume_Acc ) {
 
                     double Phi, Theta, vfl, vflx, vfly, vflz, vpx, vpy, vpz ;
@@ -819,10 +845,12 @@ void ParticleCreator::createMomentum( std::string momentum_initialization,
         } else if( momentum_initialization == "rectangular" ) {
 
             //double gamma =sqrt(temp[0]*temp[0] + temp[1]*temp[1] + temp[2]*temp[2]);
-            for( unsigned int p= iPart; p<iPart+nPart; p++ ) {
-                particles->momentum( 0, p ) = Rand::uniform2()*temp[0];
-                particles->momentum( 1, p ) = Rand::uniform2()*temp[1];
-                particles->momentum( 2, p ) = Rand::uniform2()*temp[2];
+            std::vector<double> U( nPart );
+            for( unsigned int i=0; i<3; i++ ) {
+                rand->uniforms( &U[0], nPart, rand_stream, draw_energy+i, iPart );
+                for( unsigned int p= iPart; p<iPart+nPart; p++ ) {
+                    particles->momentum( i, p ) = ( 2.*U[p-iPart] - 1. )*temp[i];
+                }
             }
 
         }
@@ -908,7 +936,8 @@ void ParticleCreator::createCharge( Particles * particles, Species * species,
 // ---------------------------------------------------------------------------------------------------------------------
 //! Provides a Maxwell-Juttner distribution of energies
 // ---------------------------------------------------------------------------------------------------------------------
-std::vector<double> ParticleCreator::maxwellJuttner( Species * species, unsigned int npoints, double temperature )
+std::vector<double> ParticleCreator::maxwellJuttner( Species * species, unsigned int npoints, double temperature,
+                                                     Random * rand, uint32_t rand_stream, unsigned int first )
 {
     if( temperature==0. ) {
         ERROR( "The species " << species->species_number_ << " is initializing its momentum with the following temperature : " << temperature );
@@ -920,10 +949,11 @@ std::vector<double> ParticleCreator::maxwellJuttner( Species * species, unsigned
         double U, lnlnU, invF, I, remainder;
         const double invdU_F = 999./( 2.+19. );
         unsigned int index;
+        // Pick the random numbers of all particles
+        rand->uniforms( &energies[0], npoints, rand_stream, draw_energy, first );
         // For each particle
         for( unsigned int i=0; i<npoints; i++ ) {
-            // Pick a random number
-            U = Rand::uniform();
+            U = energies[i];
             // Calculate the inverse of F
             lnlnU = log( -log( U ) );
             if( lnlnU>2. ) {
@@ -950,9 +980,10 @@ std::vector<double> ParticleCreator::maxwellJuttner( Species * species, unsigned
         double H0 = -invT + log( 1. + invT + 0.5*invT*invT );
         // For each particle
         for( unsigned int i=0; i<npoints; i++ ) {
+            uint32_t draw = draw_rejection;
             do {
-                // Pick a random number
-                U = Rand::uniform();
+                // Pick a random number in [0,1[
+                U = 1. - rand->uniform( rand_stream, draw++, first+i );
                 // Calculate the inverse of H at the point log(1.-U) + H0
                 lnU = log( -log( 1.-U ) - H0 );
                 if( lnU<-26. ) {
@@ -968,7 +999,7 @@ std::vector<double> ParticleCreator::maxwellJuttner( Species * species, unsigned
                 // Make a first guess for the value of gamma
                 gamma = temperature * invH;
                 // We use the rejection method, so we pick another random number
-                U = Rand::uniform();
+                U = 1. - rand->uniform( rand_stream, draw++, first+i );
                 // And we are done only if U < beta, otherwise we try again
             } while( U >= sqrt( 1.-1./( gamma*gamma ) ) );
             // Store that value of the energy
@@ -18,6 +18,7 @@
 #include "Particles.h"
 #include "Species.h"
 #include "ParticleInjector.h"
+#include "Random.h"
 #include "Field3D.h"
 #include "H5.h"
 
@@ -58,7 +59,8 @@ public:
                               Particles * particles,
                               Species * species,
                               unsigned int nPart,
-                              unsigned int iPart, double *indexes, Params &params );
+                              unsigned int iPart, double *indexes, Params &params,
+                              Random *rand, uint32_t rand_stream );
     
     //! Creation of the particle momentum
     static void createMomentum( std::string momentum_initialization,
@@ -67,7 +69,8 @@ public:
                             unsigned int nPart,
                             unsigned int iPart,
                             double *temp,
-                            double *vel);
+                            double *vel,
+                            Random *rand, uint32_t rand_stream );
     
     //! Creation of the particle weight
     static void createWeight( std::string position_initialization,
@@ -130,10 +133,17 @@ public:
     //! Pointer toward regular number of particles array
     std::vector<int> regular_number_array_;
 
+    //! Stream of the counter-based random numbers (species or injector, process)
+    uint32_t rand_stream_;
+
 private:
 
+    //! Draw numbers of the counter-based random numbers of a particle (positions use 0 to 2)
+    enum { draw_energy = 3, draw_angles = 4, draw_boost = 6, draw_rejection = 7 };
+
     //! Provides a Maxwell-Juttner distribution of energies
-    static std::vector<double> maxwellJuttner( Species * species, unsigned int npoints, double temperature );
+    static std::vector<double> maxwellJuttner( Species * species, unsigned int npoints, double temperature,
+                                               Random *rand, uint32_t rand_stream, unsigned int first );
     //! Array used in the Maxwell-Juttner sampling (see doc)
     static const double lnInvF[1000];
     //! Array used in the Maxwell-Juttner sampling (see doc)
@@ -89,25 +89,25 @@ public:
         start = i;
     };
 
-    // Expose a vector to numpy
-    inline PyArrayObject *vector2numpy( std::vector<double> &vec )
+    // Expose an array to numpy
+    inline PyArrayObject *vector2numpy( double *data )
     {
-        return ( PyArrayObject * ) PyArray_SimpleNewFromData( 1, dims, NPY_DOUBLE, ( double * )( &vec[start] ) );
+        return ( PyArrayObject * ) PyArray_SimpleNewFromData( 1, dims, NPY_DOUBLE, data );
     };
-    inline PyArrayObject *vector2numpy( std::vector<uint64_t> &vec )
+    inline PyArrayObject *vector2numpy( uint64_t *data )
     {
-        return ( PyArrayObject * ) PyArray_SimpleNewFromData( 1, dims, NPY_UINT64, ( uint64_t * )( &vec[start] ) );
+        return ( PyArrayObject * ) PyArray_SimpleNewFromData( 1, dims, NPY_UINT64, data );
     };
-    inline PyArrayObject *vector2numpy( std::vector<short> &vec )
+    inline PyArrayObject *vector2numpy( short *data )
     {
-        return ( PyArrayObject * ) PyArray_SimpleNewFromData( 1, dims, NPY_SHORT, ( short * )( &vec[start] ) );
+        return ( PyArrayObject * ) PyArray_SimpleNewFromData( 1, dims, NPY_SHORT, data );
     };
 
-    // Add a C++ vector as an attribute, but exposed as a numpy array
-    template <typename T>
-    inline void setVectorAttr( std::vector<T> &vec, std::string name )
+    // Add a C++ vector (std::vector or particle property) as an attribute, but exposed as a numpy array
+    template <typename V>
+    inline void setVectorAttr( V &vec, std::string name )
     {
-        PyArrayObject *numpy_vector = vector2numpy( vec );
+        PyArrayObject *numpy_vector = vector2numpy( &vec[start] );
         PyObject_SetAttrString( particles, name.c_str(), ( PyObject * )numpy_vector );
         attrs.push_back( numpy_vector );
     };
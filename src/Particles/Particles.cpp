@@ -30,7 +30,42 @@ Particles::Particles():
     double_prop.resize( 0 );
     short_prop.resize( 0 );
     uint64_prop.resize( 0 );
+
+#ifdef __PARTICLE_ARENA
+    bindToArena();
+#endif
+}
+
+#ifdef __PARTICLE_ARENA
+// ---------------------------------------------------------------------------------------------------------------------
+// Copy constructor (required by containers of Particles): properties are copied in a new arena
+// ---------------------------------------------------------------------------------------------------------------------
+Particles::Particles( const Particles &part ) :
+    Particles()
+{
+    is_test = part.is_test;
+    tracked = part.tracked;
+    isQuantumParameter = part.isQuantumParameter;
+    isMonteCarlo = part.isMonteCarlo;
+
+    if( ! part.double_prop.empty() ) {
+        initialize( part.size(), part.dimension(), part.Position_old.size() > 0 );
+        for( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) {
+            *double_prop[iprop] = *part.double_prop[iprop];
+        }
+        for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
+            *short_prop[iprop] = *part.short_prop[iprop];
+        }
+        for( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) {
+            *uint64_prop[iprop] = *part.uint64_prop[iprop];
+        }
+    }
+
+    cell_keys = part.cell_keys;
+    first_index = part.first_index;
+    last_index = part.last_index;
 }
+#endif
 
 Particles::~Particles()
 {
@@ -167,18 +202,24 @@ void Particles::initializeReserve( unsigned int npart_max, Particles &part )
 void Particles::resize( unsigned int nParticles, unsigned int nDim, bool keep_position_old )
 {
     Position.resize( nDim );
+    if( keep_position_old ) {
+        Position_old.resize( nDim );
+    }
+    Momentum.resize( 3 );
+#ifdef __PARTICLE_ARENA
+    bindToArena();
+#endif
+
     for( unsigned int i=0 ; i<nDim ; i++ ) {
         Position[i].resize( nParticles, 0. );
     }
     
     if( keep_position_old ) {
-        Position_old.resize( nDim );
         for( unsigned int i=0 ; i<nDim ; i++ ) {
             Position_old[i].resize( nParticles, 0. );
         }
     }
 
-    Momentum.resize( 3 );
     for( unsigned int i=0 ; i< 3 ; i++ ) {
         Momentum[i].resize( nParticles, 0. );
     }
@@ -239,6 +280,9 @@ void Particles::resizeCellKeys(unsigned int nParticles)
 void Particles::shrinkToFit()
 {
 
+#ifdef __PARTICLE_ARENA
+    arena_.shrinkToFit();
+#else
     for( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) {
         std::vector<double>( *double_prop[iprop] ).swap( *double_prop[iprop] );
     }
@@ -250,6 +294,7 @@ void Particles::shrinkToFit()
     for( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) {
         std::vector<uint64_t>( *uint64_prop[iprop] ).swap( *uint64_prop[iprop] );
     }
+#endif
     
     //cell_keys.swap(cell_keys);
     
@@ -998,6 +1043,30 @@ void Particles::savePositions() {
     }
 }
 
+#ifdef __PARTICLE_ARENA
+// ---------------------------------------------------------------------------------------------------------------------
+// Attach all the property vectors to the arena of this Particles object
+// Properties already attached are not affected
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::bindToArena()
+{
+    for( unsigned int i=0 ; i<Position.size() ; i++ ) {
+        Position[i].bind( &arena_ );
+    }
+    for( unsigned int i=0 ; i<Position_old.size() ; i++ ) {
+        Position_old[i].bind( &arena_ );
+    }
+    for( unsigned int i=0 ; i<Momentum.size() ; i++ ) {
+        Momentum[i].bind( &arena_ );
+    }
+    Weight.bind( &arena_ );
+    Chi.bind( &arena_ );
+    Tau.bind( &arena_ );
+    Charge.bind( &arena_ );
+    Id.bind( &arena_ );
+}
+#endif
+
 #ifdef __DEBUG
 bool Particles::testMove( int iPartStart, int iPartEnd, Params &params )
 {
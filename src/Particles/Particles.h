@@ -10,6 +10,15 @@
 #include "Tools.h"
 #include "TimeSelection.h"
 
+#ifdef __PARTICLE_ARENA
+#include "ParticleArena.h"
+//! With config=particle_arena, all the properties live in one aligned block
+template<typename T> using ParticleVector = ArenaVector<T>;
+#else
+//! By default, each property is an independent std::vector
+template<typename T> using ParticleVector = std::vector<T>;
+#endif
+
 class Particle;
 
 class Params;
@@ -27,6 +36,11 @@ public:
     //! Constructor for Particle
     Particles();
 
+#ifdef __PARTICLE_ARENA
+    //! Copy constructor: the copy owns its own arena
+    Particles( const Particles &part );
+#endif
+
     //! Destructor for Particle
     virtual ~Particles();
 
@@ -182,7 +196,7 @@ public:
     }
 
     //! Method used to get the list of Particle position
-    inline std::vector<double>  position( unsigned int idim ) const
+    inline const ParticleVector<double> &position( unsigned int idim ) const
     {
         return Position[idim];
     }
@@ -198,7 +212,7 @@ public:
         return Momentum[idim][ipart];
     }
     //! Method used to get the Particle momentum
-    inline std::vector<double>  momentum( unsigned int idim ) const
+    inline const ParticleVector<double> &momentum( unsigned int idim ) const
     {
         return Momentum[idim];
     }
@@ -214,7 +228,7 @@ public:
         return Weight[ipart];
     }
     //! Method used to get the Particle weight
-    inline std::vector<double>  weight() const
+    inline const ParticleVector<double> &weight() const
     {
         return Weight;
     }
@@ -230,7 +244,7 @@ public:
         return Charge[ipart];
     }
     //! Method used to get the list of Particle charges
-    inline std::vector<short>  charge() const
+    inline const ParticleVector<short> &charge() const
     {
         return Charge;
     }
@@ -257,28 +271,28 @@ public:
     //! Partiles properties, respect type order : all double, all short, all unsigned int
 
     //! array containing the particle position
-    std::vector< std::vector<double> > Position;
+    std::vector< ParticleVector<double> > Position;
 
     //! array containing the particle former (old) positions
-    std::vector< std::vector<double> >Position_old;
+    std::vector< ParticleVector<double> >Position_old;
 
     //! array containing the particle moments
-    std::vector< std::vector<double> >  Momentum;
+    std::vector< ParticleVector<double> >  Momentum;
 
     //! containing the particle weight: equivalent to a charge density
-    std::vector<double> Weight;
+    ParticleVector<double> Weight;
 
     //! containing the particle quantum parameter
-    std::vector<double> Chi;
+    ParticleVector<double> Chi;
 
     //! Incremental optical depth for the Monte-Carlo process
-    std::vector<double> Tau;
+    ParticleVector<double> Tau;
 
     //! charge state of the particle (multiples of e>0)
-    std::vector<short> Charge;
+    ParticleVector<short> Charge;
 
     //! Id of the particle
-    std::vector<uint64_t> Id;
+    ParticleVector<uint64_t> Id;
 
     //! cell_keys of the particle
     std::vector<int> cell_keys;
@@ -309,7 +323,7 @@ public:
         return Id[ipart];
     }
     //! Method used to get the Particle Ids
-    inline std::vector<uint64_t> id() const
+    inline const ParticleVector<uint64_t> &id() const
     {
         return Id;
     }
@@ -335,7 +349,7 @@ public:
         return Chi[ipart];
     }
     //! Method used to get the Particle chi factor
-    inline std::vector<double>  chi() const
+    inline const ParticleVector<double> &chi() const
     {
         return Chi;
     }
@@ -352,16 +366,16 @@ public:
         return Tau[ipart];
     }
     //! Method used to get the Particle optical depth
-    inline std::vector<double>  tau() const
+    inline const ParticleVector<double> &tau() const
     {
         return Tau;
     }
     
     void savePositions();
-    
-    std::vector< std::vector<double  >*> double_prop;
-    std::vector< std::vector<short   >*> short_prop;
-    std::vector< std::vector<uint64_t>*> uint64_prop;
+
+    std::vector< ParticleVector<double  >*> double_prop;
+    std::vector< ParticleVector<short   >*> short_prop;
+    std::vector< ParticleVector<uint64_t>*> uint64_prop;
 
 #ifdef __DEBUG
     bool testMove( int iPartStart, int iPartEnd, Params &params );
@@ -385,15 +399,15 @@ public:
     Particle operator()( unsigned int iPart );
 
     //! Methods to obtain any property, given its index in the arrays double_prop, uint64_prop, or short_prop
-    void getProperty( unsigned int iprop, std::vector<uint64_t> *&prop )
+    void getProperty( unsigned int iprop, ParticleVector<uint64_t> *&prop )
     {
         prop = uint64_prop[iprop];
     }
-    void getProperty( unsigned int iprop, std::vector<short> *&prop )
+    void getProperty( unsigned int iprop, ParticleVector<short> *&prop )
     {
         prop = short_prop[iprop];
     }
-    void getProperty( unsigned int iprop, std::vector<double> *&prop )
+    void getProperty( unsigned int iprop, ParticleVector<double> *&prop )
     {
         prop = double_prop[iprop];
     }
@@ -432,6 +446,14 @@ public:
 
 private:
 
+#ifdef __PARTICLE_ARENA
+    //! Memory block holding all the properties
+    ParticleArena arena_;
+
+    //! Attach the property vectors to the arena
+    void bindToArena();
+#endif
+
 };
 
 #endif
@@ -46,6 +46,10 @@ Patch::Patch( Params &params, SmileiMPI *smpi, DomainDecomposition *domain_decom
 
     initStep1( params );
 
+    load_timers.resize( 3, 0. );
+    load_iterations = 0;
+    measured_load = -1.;
+
 #ifdef  __DETAILED_TIMERS
     // Initialize timers
     // 0 - Interpolation
@@ -79,6 +83,10 @@ Patch::Patch( Patch *patch, Params &params, SmileiMPI *smpi, DomainDecomposition
 
     initStep1( params );
 
+    load_timers.resize( 3, 0. );
+    load_iterations = 0;
+    measured_load = -1.;
+
 #ifdef  __DETAILED_TIMERS
     // Initialize timers
     patch_timers.resize( 15, 0. );
@@ -1273,18 +1281,28 @@ void Patch::initExchange( Field *field, int iDim, SmileiMPI *smpi )
         if( is_a_MPI_neighbor( iDim, iNeighbor ) ) {
 
             int tag = field->MPIbuff.send_tags_[iDim][iNeighbor];
-            MPI_Isend( field->sendFields_[iDim*2+iNeighbor]->data_, field->sendFields_[iDim*2+iNeighbor]->globalDims_,
-                       MPI_DOUBLE, MPI_neighbor_[iDim][iNeighbor], tag,
-                       MPI_COMM_WORLD, &( field->MPIbuff.srequest[iDim][iNeighbor] ) );
+            if( smpi->persistentCommunications() ) {
+                field->MPIbuff.startPersistentSend( iDim, iNeighbor, field->sendFields_[iDim*2+iNeighbor]->data_, field->sendFields_[iDim*2+iNeighbor]->globalDims_,
+                                                    MPI_neighbor_[iDim][iNeighbor], tag );
+            } else {
+                MPI_Isend( field->sendFields_[iDim*2+iNeighbor]->data_, field->sendFields_[iDim*2+iNeighbor]->globalDims_,
+                           MPI_DOUBLE, MPI_neighbor_[iDim][iNeighbor], tag,
+                           MPI_COMM_WORLD, &( field->MPIbuff.srequest[iDim][iNeighbor] ) );
+            }
 
         } // END of Send
 
         if( is_a_MPI_neighbor( iDim, ( iNeighbor+1 )%2 ) ) {
 
             int tag = field->MPIbuff.recv_tags_[iDim][iNeighbor];
-            MPI_Irecv( field->recvFields_[iDim*2+(iNeighbor+1)%2]->data_, field->recvFields_[iDim*2+(iNeighbor+1)%2]->globalDims_,
-                       MPI_DOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag,
-                       MPI_COMM_WORLD, &( field->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
+            if( smpi->persistentCommunications() ) {
+                field->MPIbuff.startPersistentRecv( iDim, ( iNeighbor+1 )%2, field->recvFields_[iDim*2+(iNeighbor+1)%2]->data_, field->recvFields_[iDim*2+(iNeighbor+1)%2]->globalDims_,
+                                                    MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag );
+            } else {
+                MPI_Irecv( field->recvFields_[iDim*2+(iNeighbor+1)%2]->data_, field->recvFields_[iDim*2+(iNeighbor+1)%2]->globalDims_,
+                           MPI_DOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag,
+                           MPI_COMM_WORLD, &( field->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
+            }
 
         } // END of Recv
 
@@ -1386,16 +1404,26 @@ void Patch::initSumField( Field *field, int iDim, SmileiMPI *smpi )
 
         if( is_a_MPI_neighbor( iDim, iNeighbor ) ) {
             int tag = field->MPIbuff.send_tags_[iDim][iNeighbor];
-            MPI_Isend( field->sendFields_[iDim*2+iNeighbor]->data_, field->sendFields_[iDim*2+iNeighbor]->globalDims_,
-                       MPI_DOUBLE, MPI_neighbor_[iDim][iNeighbor], tag,
-                       MPI_COMM_WORLD, &( field->MPIbuff.srequest[iDim][iNeighbor] ) );
+            if( smpi->persistentCommunications() ) {
+                field->MPIbuff.startPersistentSend( iDim, iNeighbor, field->sendFields_[iDim*2+iNeighbor]->data_, field->sendFields_[iDim*2+iNeighbor]->globalDims_,
+                                                    MPI_neighbor_[iDim][iNeighbor], tag );
+            } else {
+                MPI_Isend( field->sendFields_[iDim*2+iNeighbor]->data_, field->sendFields_[iDim*2+iNeighbor]->globalDims_,
+                           MPI_DOUBLE, MPI_neighbor_[iDim][iNeighbor], tag,
+                           MPI_COMM_WORLD, &( field->MPIbuff.srequest[iDim][iNeighbor] ) );
+            }
         } // END of Send
 
         if( is_a_MPI_neighbor( iDim, ( iNeighbor+1 )%2 ) ) {
             int tag = field->MPIbuff.recv_tags_[iDim][iNeighbor];
-            MPI_Irecv( field->recvFields_[iDim*2+(iNeighbor+1)%2]->data_, field->recvFields_[iDim*2+(iNeighbor+1)%2]->globalDims_,
-                       MPI_DOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag,
-                       MPI_COMM_WORLD, &( field->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
+            if( smpi->persistentCommunications() ) {
+                field->MPIbuff.startPersistentRecv( iDim, ( iNeighbor+1 )%2, field->recvFields_[iDim*2+(iNeighbor+1)%2]->data_, field->recvFields_[iDim*2+(iNeighbor+1)%2]->globalDims_,
+                                                    MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag );
+            } else {
+                MPI_Irecv( field->recvFields_[iDim*2+(iNeighbor+1)%2]->data_, field->recvFields_[iDim*2+(iNeighbor+1)%2]->globalDims_,
+                           MPI_DOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag,
+                           MPI_COMM_WORLD, &( field->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
+            }
         } // END of Recv
 
     } // END for iNeighbor
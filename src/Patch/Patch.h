@@ -31,6 +31,7 @@ class Patch
     friend class SimWindow;
     friend class SyncVectorPatch;
     friend class AsyncMPIbuffers;
+    friend class AggregatedMPIbuffers;
 public:
     //! Constructor for Patch
     Patch( Params &params, SmileiMPI *smpi, DomainDecomposition *domain_decomposition, unsigned int ipatch, unsigned int n_moved );
@@ -95,6 +96,13 @@ public:
     //! Timers for the patch
     std::vector<double> patch_timers;
 #endif
+
+    //! Wall time spent on the patch since the last load balancing (0 particles, 1 collisions, 2 Maxwell)
+    std::vector<double> load_timers;
+    //! Number of iterations accumulated in load_timers
+    unsigned int load_iterations;
+    //! Measured load of the patch (seconds per iteration, smoothed in time), negative if never measured
+    double measured_load;
     
     // Random number generator.
     Random * rand_;
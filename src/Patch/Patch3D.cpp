@@ -216,7 +216,7 @@ void Patch3D::exchangeField_movewin( Field* field, int clrw )
         ix = idx[0]*istart;
         iy = idx[1]*istart;
         iz = idx[2]*istart;
-        MPI_Bsend( &(f3D->data_3D[ix][iy][iz]), 1, ntype, MPI_neighbor_[iDim][iNeighbor], 0, MPI_COMM_WORLD);
+        MPI_Bsend( &(f3D->data_[f3D->index( ix, iy, iz )]), 1, ntype, MPI_neighbor_[iDim][iNeighbor], 0, MPI_COMM_WORLD);
     } // END of Send
 
     //Once the message is in the buffer we can safely shift the field in memory.
@@ -231,7 +231,7 @@ void Patch3D::exchangeField_movewin( Field* field, int clrw )
         ix = idx[0]*istart;
         iy = idx[1]*istart;
         iz = idx[2]*istart;
-        MPI_Irecv( &(f3D->data_3D[ix][iy][iz]), 1, ntype, MPI_neighbor_[iDim][(iNeighbor+1)%2], 0, MPI_COMM_WORLD, &rrequest);
+        MPI_Irecv( &(f3D->data_[f3D->index( ix, iy, iz )]), 1, ntype, MPI_neighbor_[iDim][(iNeighbor+1)%2], 0, MPI_COMM_WORLD, &rrequest);
     } // END of Recv
 
 
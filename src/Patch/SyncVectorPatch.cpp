@@ -224,6 +224,65 @@ void SyncVectorPatch::sumRhoJs( Params &params, VectorPatch &vecPatches, int imo
     }
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Aggregated exchanges (Main.halo_exchange = "rank") :
+//   - the sub-fields of all patches have been extracted (implicit barrier of the previous loop)
+//   - 1 message per neighbouring MPI rank, threads share the ranks
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::initAggregated( AggregatedMPIbuffers &buffers )
+{
+#ifndef _NO_MPI_TM
+    #pragma omp for schedule(dynamic)
+#else
+    #pragma omp single
+#endif
+    for( unsigned int irank=0 ; irank<buffers.size() ; irank++ ) {
+        buffers.init( irank );
+    }
+}
+
+// The following injection loop starts after the implicit barrier
+void SyncVectorPatch::finalizeAggregated( AggregatedMPIbuffers &buffers )
+{
+#ifndef _NO_MPI_TM
+    #pragma omp for schedule(dynamic)
+#else
+    #pragma omp single
+#endif
+    for( unsigned int irank=0 ; irank<buffers.size() ; irank++ ) {
+        buffers.finalize( irank );
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Initialize the sum of currents along X for the ifield-th patch of vecPatches.MPIxIdx :
+//   - copy of the borders to exchange in sub-fields
+//   - Isend/Irecv of these sub-fields
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::initSumDensitiesMPIx( VectorPatch &vecPatches, unsigned int ifield, SmileiMPI *smpi )
+{
+    unsigned int oversize = vecPatches( 0 )->EMfields->oversize[0];
+    unsigned int nPatchMPIx = vecPatches.MPIxIdx.size();
+    unsigned int ipatch = vecPatches.MPIxIdx[ifield];
+    for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+        if ( vecPatches( ipatch )->is_a_MPI_neighbor( 0, iNeighbor ) ) {
+            vecPatches.densitiesMPIx[ifield             ]->create_sub_fields ( 0, iNeighbor, 2*oversize+1+1 ); // +1, Jx dual in X
+            vecPatches.densitiesMPIx[ifield+nPatchMPIx  ]->create_sub_fields ( 0, iNeighbor, 2*oversize+1+0 ); // +0, Jy prim in X
+            vecPatches.densitiesMPIx[ifield+2*nPatchMPIx]->create_sub_fields ( 0, iNeighbor, 2*oversize+1+0 ); // +0, Jz prim in X
+            vecPatches.densitiesMPIx[ifield             ]->extract_fields_sum( 0, iNeighbor, oversize );
+            vecPatches.densitiesMPIx[ifield+nPatchMPIx  ]->extract_fields_sum( 0, iNeighbor, oversize );
+            vecPatches.densitiesMPIx[ifield+2*nPatchMPIx]->extract_fields_sum( 0, iNeighbor, oversize );
+        }
+    }
+    if( vecPatches.aggregated_exchange ) {
+        return; // sent per MPI rank, once all patches extracted
+    }
+    vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield             ], 0, smpi ); // Jx
+    vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield+  nPatchMPIx], 0, smpi ); // Jy
+    vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0, smpi ); // Jz
+}
+
+
 // The idea is to minimize the number of implicit barriers and maximize the workload between barriers
 // fields : contains all (Jx then Jy then Jz) components of a field for all patches of vecPatches
 //     - fields is not directly used in the exchange process, just to find local neighbor's field
@@ -255,27 +314,20 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
     // Sum per direction :
 
     // iDim = 0, initialize comms : Isend/Irecv
+    //   (already done patch per patch at the end of their dynamics if task scheduling is used)
     unsigned int nPatchMPIx = vecPatches.MPIxIdx.size();
+    if( ! vecPatches.sum_densities_x_started ) {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ifield=0 ; ifield<nPatchMPIx ; ifield++ ) {
-        unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
-            if ( vecPatches( ipatch )->is_a_MPI_neighbor( 0, iNeighbor ) ) {
-                vecPatches.densitiesMPIx[ifield             ]->create_sub_fields ( 0, iNeighbor, 2*oversize[0]+1+1 ); // +1, Jx dual in X
-                vecPatches.densitiesMPIx[ifield+nPatchMPIx  ]->create_sub_fields ( 0, iNeighbor, 2*oversize[0]+1+0 ); // +0, Jy prim in X
-                vecPatches.densitiesMPIx[ifield+2*nPatchMPIx]->create_sub_fields ( 0, iNeighbor, 2*oversize[0]+1+0 ); // +0, Jz prim in X
-                vecPatches.densitiesMPIx[ifield             ]->extract_fields_sum( 0, iNeighbor, oversize[0] );
-                vecPatches.densitiesMPIx[ifield+nPatchMPIx  ]->extract_fields_sum( 0, iNeighbor, oversize[0] );
-                vecPatches.densitiesMPIx[ifield+2*nPatchMPIx]->extract_fields_sum( 0, iNeighbor, oversize[0] );
-            }
+        for( unsigned int ifield=0 ; ifield<nPatchMPIx ; ifield++ ) {
+            SyncVectorPatch::initSumDensitiesMPIx( vecPatches, ifield, smpi );
         }
-        vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield             ], 0, smpi ); // Jx
-        vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield+  nPatchMPIx], 0, smpi ); // Jy
-        vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0, smpi ); // Jz
+    }
+    if( vecPatches.aggregated_exchange ) {
+        SyncVectorPatch::initAggregated( vecPatches.densities_MPI_aggregated[0] );
     }
     // iDim = 0, local
     int nFieldLocalx = vecPatches.densitiesLocalx.size()/3;
@@ -315,6 +367,9 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
     }
 
     // iDim = 0, finalize (waitall)
+    if( vecPatches.aggregated_exchange ) {
+        SyncVectorPatch::finalizeAggregated( vecPatches.densities_MPI_aggregated[0] );
+    }
 #ifndef _NO_MPI_TM
     #pragma omp for schedule(static)
 #else
@@ -322,9 +377,11 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
 #endif
     for( unsigned int ifield=0 ; ifield<nPatchMPIx ; ifield++ ) {
         unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield             ], 0 ); // Jx
-        vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield+nPatchMPIx  ], 0 ); // Jy
-        vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0 ); // Jz
+        if( !vecPatches.aggregated_exchange ) {
+            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield             ], 0 ); // Jx
+            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield+nPatchMPIx  ], 0 ); // Jy
+            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0 ); // Jz
+        }
         for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
             if ( vecPatches( ipatch )->is_a_MPI_neighbor( 0, ( iNeighbor+1 )%2 ) ) {
                 vecPatches.densitiesMPIx[ifield             ]->inject_fields_sum( 0, iNeighbor, oversize[0] );
@@ -337,6 +394,9 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
     // END iDim = 0 sync
     // -----------------
 
+    #pragma omp single nowait
+    vecPatches.sum_densities_x_started = false;
+
     if( nDim>1 ) {
         // -----------------
         // Sum per direction :
@@ -360,9 +420,14 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
                     vecPatches.densitiesMPIy[ifield+2*nPatchMPIy]->extract_fields_sum( 1, iNeighbor, oversize[1] );
                 }
             }
-            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield             ], 1, smpi ); // Jx
-            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1, smpi ); // Jy
-            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1, smpi ); // Jz
+            if( !vecPatches.aggregated_exchange ) {
+                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield             ], 1, smpi ); // Jx
+                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1, smpi ); // Jy
+                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1, smpi ); // Jz
+            }
+        }
+        if( vecPatches.aggregated_exchange ) {
+            SyncVectorPatch::initAggregated( vecPatches.densities_MPI_aggregated[1] );
         }
 
         // iDim = 1,
@@ -407,6 +472,9 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
         }
 
         // iDim = 1, finalize (waitall)
+        if( vecPatches.aggregated_exchange ) {
+            SyncVectorPatch::finalizeAggregated( vecPatches.densities_MPI_aggregated[1] );
+        }
 #ifndef _NO_MPI_TM
         #pragma omp for schedule(static)
 #else
@@ -414,9 +482,11 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
 #endif
         for( unsigned int ifield=0 ; ifield<nPatchMPIy ; ifield=ifield+1 ) {
             unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield             ], 1 ); // Jx
-            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1 ); // Jy
-            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1 ); // Jz
+            if( !vecPatches.aggregated_exchange ) {
+                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield             ], 1 ); // Jx
+                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1 ); // Jy
+                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1 ); // Jz
+            }
             for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
                 if ( vecPatches( ipatch )->is_a_MPI_neighbor( 1, ( iNeighbor+1 )%2 ) ) {
                     vecPatches.densitiesMPIy[ifield             ]->inject_fields_sum( 1, iNeighbor, oversize[1] );
@@ -451,9 +521,14 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
                         vecPatches.densitiesMPIz[ifield+2*nPatchMPIz]->extract_fields_sum( 2, iNeighbor, oversize[2] );
                     }
                 }
-                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield             ], 2, smpi ); // Jx
-                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2, smpi ); // Jy
-                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2, smpi ); // Jz
+                if( !vecPatches.aggregated_exchange ) {
+                    vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield             ], 2, smpi ); // Jx
+                    vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2, smpi ); // Jy
+                    vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2, smpi ); // Jz
+                }
+            }
+            if( vecPatches.aggregated_exchange ) {
+                SyncVectorPatch::initAggregated( vecPatches.densities_MPI_aggregated[2] );
             }
 
             // iDim = 2 local
@@ -499,6 +574,9 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
             }
 
             // iDim = 2, complete non local sync through MPIfinalize (waitall)
+            if( vecPatches.aggregated_exchange ) {
+                SyncVectorPatch::finalizeAggregated( vecPatches.densities_MPI_aggregated[2] );
+            }
 #ifndef _NO_MPI_TM
             #pragma omp for schedule(static)
 #else
@@ -506,9 +584,11 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
 #endif
             for( unsigned int ifield=0 ; ifield<nPatchMPIz ; ifield=ifield+1 ) {
                 unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield             ], 2 ); // Jx
-                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2 ); // Jy
-                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2 ); // Jz
+                if( !vecPatches.aggregated_exchange ) {
+                    vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield             ], 2 ); // Jx
+                    vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2 ); // Jy
+                    vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2 ); // Jz
+                }
                 for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
                     if ( vecPatches( ipatch )->is_a_MPI_neighbor( 2, ( iNeighbor+1 )%2 ) ) {
                         vecPatches.densitiesMPIz[ifield             ]->inject_fields_sum( 2, iNeighbor, oversize[2] );
@@ -1315,8 +1395,13 @@ void SyncVectorPatch::exchangeAllComponentsAlongX( std::vector<Field *> &fields,
                 vecPatches.B_MPIx[ifield+nMPIx]->extract_fields_exch( 0, iNeighbor, oversize );
             }
         }
-        vecPatches( ipatch )->initExchange( vecPatches.B_MPIx[ifield      ], 0, smpi ); // By
-        vecPatches( ipatch )->initExchange( vecPatches.B_MPIx[ifield+nMPIx], 0, smpi ); // Bz
+        if( !vecPatches.aggregated_exchange ) {
+            vecPatches( ipatch )->initExchange( vecPatches.B_MPIx[ifield      ], 0, smpi ); // By
+            vecPatches( ipatch )->initExchange( vecPatches.B_MPIx[ifield+nMPIx], 0, smpi ); // Bz
+        }
+    }
+    if( vecPatches.aggregated_exchange ) {
+        SyncVectorPatch::initAggregated( vecPatches.B_MPI_aggregated[0] );
     }
 
     unsigned int h0, n_space;
@@ -1368,6 +1453,9 @@ void SyncVectorPatch::finalizeExchangeAllComponentsAlongX( std::vector<Field *>
     unsigned oversize = vecPatches( 0 )->EMfields->oversize[0];
 
     unsigned int nMPIx = vecPatches.MPIxIdx.size();
+    if( vecPatches.aggregated_exchange ) {
+        SyncVectorPatch::finalizeAggregated( vecPatches.B_MPI_aggregated[0] );
+    }
 #ifndef _NO_MPI_TM
     #pragma omp for schedule(static)
 #else
@@ -1375,8 +1463,10 @@ void SyncVectorPatch::finalizeExchangeAllComponentsAlongX( std::vector<Field *>
 #endif
     for( unsigned int ifield=0 ; ifield<nMPIx ; ifield++ ) {
         unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B_MPIx[ifield      ], 0 ); // By
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B_MPIx[ifield+nMPIx], 0 ); // Bz
+        if( !vecPatches.aggregated_exchange ) {
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B_MPIx[ifield      ], 0 ); // By
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B_MPIx[ifield+nMPIx], 0 ); // Bz
+        }
         for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
             if ( vecPatches( ipatch )->is_a_MPI_neighbor( 0, ( iNeighbor+1 )%2 ) ) {
                 vecPatches.B_MPIx[ifield      ]->inject_fields_exch( 0, iNeighbor, oversize );
@@ -1415,8 +1505,13 @@ void SyncVectorPatch::exchangeAllComponentsAlongY( std::vector<Field *> &fields,
                 vecPatches.B1_MPIy[ifield+nMPIy]->extract_fields_exch( 1, iNeighbor, oversize );
             }
         }
-        vecPatches( ipatch )->initExchange( vecPatches.B1_MPIy[ifield      ], 1, smpi ); // Bx
-        vecPatches( ipatch )->initExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1, smpi ); // Bz
+        if( !vecPatches.aggregated_exchange ) {
+            vecPatches( ipatch )->initExchange( vecPatches.B1_MPIy[ifield      ], 1, smpi ); // Bx
+            vecPatches( ipatch )->initExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1, smpi ); // Bz
+        }
+    }
+    if( vecPatches.aggregated_exchange ) {
+        SyncVectorPatch::initAggregated( vecPatches.B_MPI_aggregated[1] );
     }
 
     unsigned int h0, n_space;
@@ -1472,6 +1567,9 @@ void SyncVectorPatch::finalizeExchangeAllComponentsAlongY( std::vector<Field *>
     unsigned oversize = vecPatches( 0 )->EMfields->oversize[1];
 
     unsigned int nMPIy = vecPatches.MPIyIdx.size();
+    if( vecPatches.aggregated_exchange ) {
+        SyncVectorPatch::finalizeAggregated( vecPatches.B_MPI_aggregated[1] );
+    }
 #ifndef _NO_MPI_TM
     #pragma omp for schedule(static)
 #else
@@ -1479,8 +1577,10 @@ void SyncVectorPatch::finalizeExchangeAllComponentsAlongY( std::vector<Field *>
 #endif
     for( unsigned int ifield=0 ; ifield<nMPIy ; ifield++ ) {
         unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B1_MPIy[ifield      ], 1 ); // By
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1 ); // Bz
+        if( !vecPatches.aggregated_exchange ) {
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B1_MPIy[ifield      ], 1 ); // By
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1 ); // Bz
+        }
         for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
             if ( vecPatches( ipatch )->is_a_MPI_neighbor( 1, ( iNeighbor+1 )%2 ) ) {
                 vecPatches.B1_MPIy[ifield      ]->inject_fields_exch( 1, iNeighbor, oversize );
@@ -1519,8 +1619,13 @@ void SyncVectorPatch::exchangeAllComponentsAlongZ( std::vector<Field *> fields,
                 vecPatches.B2_MPIz[ifield+nMPIz]->extract_fields_exch( 2, iNeighbor, oversize );
             }
         }
-        vecPatches( ipatch )->initExchange( vecPatches.B2_MPIz[ifield],       2, smpi ); // Bx
-        vecPatches( ipatch )->initExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2, smpi ); // By
+        if( !vecPatches.aggregated_exchange ) {
+            vecPatches( ipatch )->initExchange( vecPatches.B2_MPIz[ifield      ], 2, smpi ); // Bx
+            vecPatches( ipatch )->initExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2, smpi ); // By
+        }
+    }
+    if( vecPatches.aggregated_exchange ) {
+        SyncVectorPatch::initAggregated( vecPatches.B_MPI_aggregated[2] );
     }
 
     unsigned int h0, n_space;
@@ -1573,6 +1678,9 @@ void SyncVectorPatch::finalizeExchangeAllComponentsAlongZ( std::vector<Field *>
     unsigned oversize = vecPatches( 0 )->EMfields->oversize[2];
 
     unsigned int nMPIz = vecPatches.MPIzIdx.size();
+    if( vecPatches.aggregated_exchange ) {
+        SyncVectorPatch::finalizeAggregated( vecPatches.B_MPI_aggregated[2] );
+    }
 #ifndef _NO_MPI_TM
     #pragma omp for schedule(static)
 #else
@@ -1580,8 +1688,10 @@ void SyncVectorPatch::finalizeExchangeAllComponentsAlongZ( std::vector<Field *>
 #endif
     for( unsigned int ifield=0 ; ifield<nMPIz ; ifield++ ) {
         unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B2_MPIz[ifield      ], 2 ); // Bx
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2 ); // By
+        if( !vecPatches.aggregated_exchange ) {
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B2_MPIz[ifield      ], 2 ); // Bx
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2 ); // By
+        }
         for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
             if ( vecPatches( ipatch )->is_a_MPI_neighbor( 2, ( iNeighbor+1 )%2 ) ) {
                 vecPatches.B2_MPIz[ifield      ]->inject_fields_exch( 2, iNeighbor, oversize );
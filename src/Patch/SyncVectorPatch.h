@@ -286,6 +286,12 @@ public :
     }
 
     static void sumAllComponents( std::vector<Field *> &fields, VectorPatch &vecPatches, SmileiMPI *smpi, Timers &timers, int itime );
+    //! Extract the borders of the currents of the ifield-th patch having a MPI neighbour along X, and send them
+    static void initSumDensitiesMPIx( VectorPatch &vecPatches, unsigned int ifield, SmileiMPI *smpi );
+    //! Pack and send the sub-fields of an aggregated exchange, per neighbouring MPI rank
+    static void initAggregated( AggregatedMPIbuffers &buffers );
+    //! Receive and unpack the sub-fields of an aggregated exchange, per neighbouring MPI rank
+    static void finalizeAggregated( AggregatedMPIbuffers &buffers );
 
     void templateGenerator();
 
@@ -5,6 +5,7 @@
 #include <iomanip>
 #include <fstream>
 #include <cstring>
+#include <algorithm>
 #include <math.h>
 //#include <string>
 
@@ -31,12 +32,18 @@ using namespace std;
 VectorPatch::VectorPatch()
 {
     domain_decomposition_ = NULL ;
+    sum_densities_x_started = false;
+    aggregated_exchange = false;
 }
 
 
 VectorPatch::VectorPatch( Params &params )
 {
     domain_decomposition_ = DomainDecompositionFactory::create( params );
+    sum_densities_x_started = false;
+    aggregated_exchange = params.aggregated_exchange;
+    B_MPI_aggregated.resize( 3 );
+    densities_MPI_aggregated.resize( 3 );
 }
 
 
@@ -321,61 +328,23 @@ void VectorPatch::dynamics( Params &params,
     #pragma omp single
     {
         diag_flag = ( needsRhoJsNow( itime ) || params.is_spectral );
+        // Counter-based random numbers of this timestep
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            ( *this )( ipatch )->rand_->setCounter( params.random_seed, ( *this )( ipatch )->hindex, itime );
+        }
     }
     
+    if( params.task_scheduling ) {
+        dynamicsWithTasks( params, smpi, simWindow, RadiationTables, MultiphotonBreitWheelerTables, time_dual, timers, itime );
+        return;
+    }
+
     timers.particles.restart();
-    ostringstream t;
     #pragma omp for schedule(runtime)
     for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
-        ( *this )( ipatch )->EMfields->restartRhoJ();
-        for( unsigned int ispec=0 ; ispec<( *this )( ipatch )->vecSpecies.size() ; ispec++ ) {
-            Species *spec = species( ipatch, ispec );
-            
-            if( params.keep_position_old ) {
-                spec->particles->savePositions();
-            }
-            
-            if( spec->ponderomotive_dynamics ) {
-                continue;
-            }
-            
-            if( spec->isProj( time_dual, simWindow ) || diag_flag ) {
-                // Dynamics with vectorized operators
-                if( spec->vectorized_operators || params.cell_sorting ) {
-                    spec->dynamics( time_dual, ispec,
-                                    emfields( ipatch ),
-                                    params, diag_flag, partwalls( ipatch ),
-                                    ( *this )( ipatch ), smpi,
-                                    RadiationTables,
-                                    MultiphotonBreitWheelerTables,
-                                    localDiags );
-                }
-                // Dynamics with scalar operators
-                else {
-                    if( params.vectorization_mode == "adaptive" ) {
-                        spec->scalarDynamics( time_dual, ispec,
-                                               emfields( ipatch ),
-                                               params, diag_flag, partwalls( ipatch ),
-                                               ( *this )( ipatch ), smpi,
-                                               RadiationTables,
-                                               MultiphotonBreitWheelerTables,
-                                               localDiags );
-                    } else {
-                        spec->Species::dynamics( time_dual, ispec,
-                                                 emfields( ipatch ),
-                                                 params, diag_flag, partwalls( ipatch ),
-                                                 ( *this )( ipatch ), smpi,
-                                                 RadiationTables,
-                                                 MultiphotonBreitWheelerTables,
-                                                 localDiags );
-                    }
-                } // end if condition on vectorization
-            } // end if condition on species
-        } // end loop on species
-        //MESSAGE("species dynamics");
+        patchDynamics( ipatch, params, smpi, simWindow, RadiationTables, MultiphotonBreitWheelerTables, time_dual );
     } // end loop on patches
 
-
     timers.particles.update( params.printNow( itime ) );
 #ifdef __DETAILED_TIMERS
     timers.interpolator.update( *this, params.printNow( itime ) );
@@ -402,6 +371,196 @@ void VectorPatch::dynamics( Params &params,
 #endif
 } // END dynamics
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Move the particles of all species of the patch ipatch (restartRhoJ(s) and dynamics)
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::patchDynamics( unsigned int ipatch,
+                                 Params &params,
+                                 SmileiMPI *smpi,
+                                 SimWindow *simWindow,
+                                 RadiationTables &RadiationTables,
+                                 MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
+                                 double time_dual )
+{
+    double timer = MPI_Wtime();
+
+    ( *this )( ipatch )->EMfields->restartRhoJ();
+    for( unsigned int ispec=0 ; ispec<( *this )( ipatch )->vecSpecies.size() ; ispec++ ) {
+        Species *spec = species( ipatch, ispec );
+        
+        if( params.keep_position_old ) {
+            spec->particles->savePositions();
+        }
+        
+        if( spec->ponderomotive_dynamics ) {
+            continue;
+        }
+        
+        if( spec->isProj( time_dual, simWindow ) || diag_flag ) {
+            // Dynamics with vectorized operators
+            if( spec->vectorized_operators || params.cell_sorting ) {
+                spec->dynamics( time_dual, ispec,
+                                emfields( ipatch ),
+                                params, diag_flag, partwalls( ipatch ),
+                                ( *this )( ipatch ), smpi,
+                                RadiationTables,
+                                MultiphotonBreitWheelerTables,
+                                localDiags );
+            }
+            // Dynamics with scalar operators
+            else {
+                if( params.vectorization_mode == "adaptive" ) {
+                    spec->scalarDynamics( time_dual, ispec,
+                                           emfields( ipatch ),
+                                           params, diag_flag, partwalls( ipatch ),
+                                           ( *this )( ipatch ), smpi,
+                                           RadiationTables,
+                                           MultiphotonBreitWheelerTables,
+                                           localDiags );
+                } else {
+                    spec->Species::dynamics( time_dual, ispec,
+                                             emfields( ipatch ),
+                                             params, diag_flag, partwalls( ipatch ),
+                                             ( *this )( ipatch ), smpi,
+                                             RadiationTables,
+                                             MultiphotonBreitWheelerTables,
+                                             localDiags );
+                }
+            } // end if condition on vectorization
+        } // end if condition on species
+    } // end loop on species
+
+    if( params.measured_load_balancing ) {
+        ( *this )( ipatch )->load_timers[0] += MPI_Wtime() - timer;
+        ( *this )( ipatch )->load_iterations++;
+    }
+} // END patchDynamics
+
+// ---------------------------------------------------------------------------------------------------------------------
+// For all patches, move particles and initiate their exchange with a graph of OpenMP tasks:
+//   - dynamics( ipatch ) : restartRhoJ(s), particles push and projection (+ total densities if needed)
+//   - sum( ipatch )      : Isend/Irecv of the currents along X, as soon as dynamics( ipatch ) is done
+//   - extract( ipatch, ispec ) : selection of the particles leaving the patch, as soon as dynamics( ipatch ) is done
+// Patches having MPI neighbours are submitted first, with a higher priority, for MPI communications to start early.
+// The implicit barrier at the end of the single construct waits for the completion of all tasks.
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::dynamicsWithTasks( Params &params,
+                                     SmileiMPI *smpi,
+                                     SimWindow *simWindow,
+                                     RadiationTables &RadiationTables,
+                                     MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
+                                     double time_dual, Timers &timers, int itime )
+{
+    timers.particles.restart();
+
+    #pragma omp single
+    {
+        unsigned int npatches = this->size();
+        unsigned int nspecies = ( *this )( 0 )->vecSpecies.size();
+
+        // Species which particles move, hence must be exchanged
+        std::vector<unsigned int> moving_species;
+        for( unsigned int ispec=0 ; ispec<nspecies ; ispec++ ) {
+            Species *spec = species( 0, ispec );
+            if( !spec->ponderomotive_dynamics && spec->isProj( time_dual, simWindow ) ) {
+                moving_species.push_back( ispec );
+            }
+        }
+
+        // The sum of currents can start within the tasks only if nothing modifies currents in between
+        bool start_sum = ( moving_species.size() > 0 || diag_flag )
+                         && params.geometry != "AMcylindrical"
+                         && !params.Laser_Envelope_model
+                         && !params.multiple_decomposition;
+        std::vector<int> MPIx_field( npatches, -1 );
+        if( start_sum ) {
+            for( unsigned int ifield=0 ; ifield<MPIxIdx.size() ; ifield++ ) {
+                MPIx_field[MPIxIdx[ifield]] = ifield;
+            }
+        }
+        sum_densities_x_started = start_sum;
+
+        // Submission order : patches at the border of the MPI domain first
+        std::vector<unsigned int> order;
+        std::vector<int> priority( npatches, 0 );
+        order.reserve( npatches );
+        for( unsigned int ipatch=0 ; ipatch<npatches ; ipatch++ ) {
+            for( unsigned int iDim=0 ; iDim<params.nDim_field ; iDim++ ) {
+                if( ( *this )( ipatch )->is_a_MPI_neighbor( iDim, 0 ) || ( *this )( ipatch )->is_a_MPI_neighbor( iDim, 1 ) ) {
+                    priority[ipatch] = 1;
+                }
+            }
+            if( priority[ipatch] ) {
+                order.push_back( ipatch );
+            }
+        }
+        for( unsigned int ipatch=0 ; ipatch<npatches ; ipatch++ ) {
+            if( !priority[ipatch] ) {
+                order.push_back( ipatch );
+            }
+        }
+
+        // Dependency tokens (only referenced in the depend clauses, unused without OpenMP)
+        std::vector<char> dynamics_token( npatches );
+        char *dyn = dynamics_token.data();
+        ( void ) dyn;
+
+        for( unsigned int iorder=0 ; iorder<npatches ; iorder++ ) {
+            unsigned int ipatch = order[iorder];
+            int prio = priority[ipatch];
+
+            #pragma omp task default(shared) firstprivate(ipatch) priority(prio) depend(out:dyn[ipatch])
+            {
+                patchDynamics( ipatch, params, smpi, simWindow, RadiationTables, MultiphotonBreitWheelerTables, time_dual );
+                if( start_sum && diag_flag ) {
+                    ( *this )( ipatch )->EMfields->computeTotalRhoJ();
+                }
+            }
+
+            if( MPIx_field[ipatch] >= 0 ) {
+                unsigned int ifield = MPIx_field[ipatch];
+                #pragma omp task default(shared) firstprivate(ifield) priority(prio) depend(in:dyn[ipatch])
+                SyncVectorPatch::initSumDensitiesMPIx( *this, ifield, smpi );
+            }
+
+            for( unsigned int imov=0 ; imov<moving_species.size() ; imov++ ) {
+                unsigned int ispec = moving_species[imov];
+                #pragma omp task default(shared) firstprivate(ipatch,ispec) priority(prio) depend(in:dyn[ipatch])
+                {
+                    species( ipatch, ispec )->extractParticles();
+                    ( *this )( ipatch )->initExchParticles( smpi, ispec, params );
+                }
+            }
+        }
+    } // end single : implicit barrier, all tasks are completed
+
+    timers.particles.update( params.printNow( itime ) );
+
+    // Exchange of the number of particles along X, once all currents sums were initiated
+    // (the MPI tags of these messages may coincide with those of the currents)
+    timers.syncPart.restart();
+    for( unsigned int ispec=0 ; ispec<( *this )( 0 )->vecSpecies.size(); ispec++ ) {
+        Species *spec = species( 0, ispec );
+        if( !spec->ponderomotive_dynamics && spec->isProj( time_dual, simWindow ) ) {
+            #pragma omp for schedule(runtime)
+            for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+                ( *this )( ipatch )->exchNbrOfParticles( smpi, ispec, params, 0, this );
+            }
+        }
+    }
+    timers.syncPart.update( params.printNow( itime ) );
+#ifdef __DETAILED_TIMERS
+    timers.interpolator.update( *this, params.printNow( itime ) );
+    timers.pusher.update( *this, params.printNow( itime ) );
+    timers.projector.update( *this, params.printNow( itime ) );
+    timers.cell_keys.update( *this, params.printNow( itime ) );
+    timers.ionization.update( *this, params.printNow( itime ) );
+    timers.radiation.update( *this, params.printNow( itime ) );
+    timers.multiphoton_Breit_Wheeler_timer.update( *this, params.printNow( itime ) );
+    timers.sorting.update( *this, params.printNow( itime ) );
+#endif
+} // END dynamicsWithTasks
+
 // ---------------------------------------------------------------------------------------------------------------------
 // For all patches, project charge and current densities with standard scheme for diag purposes at t=0
 // ---------------------------------------------------------------------------------------------------------------------
@@ -942,7 +1101,8 @@ void VectorPatch::sumDensities( Params &params, double time_dual, Timers &timers
     }
 
     timers.densities.restart();
-    if( diag_flag ) {
+    // Total densities already computed by the tasks of dynamicsWithTasks if the sum has started
+    if( diag_flag && !sum_densities_x_started ) {
         #pragma omp for schedule(static)
         for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
             // Per species in global, Attention if output -> Sync / per species fields
@@ -1111,6 +1271,7 @@ void VectorPatch::solveMaxwell( Params &params, SimWindow *simWindow, int itime,
 
     #pragma omp for schedule(static)
     for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+        double timer = MPI_Wtime();
         if( !params.is_spectral ) {
             // Saving magnetic fields (to compute centered fields used in the particle pusher)
             // Stores B at time n in B_m.
@@ -1119,12 +1280,19 @@ void VectorPatch::solveMaxwell( Params &params, SimWindow *simWindow, int itime,
         // Computes Ex_, Ey_, Ez_ on all points.
         // E is already synchronized because J has been synchronized before.
         ( *( *this )( ipatch )->EMfields->MaxwellAmpereSolver_ )( ( *this )( ipatch )->EMfields );
+        if( params.measured_load_balancing ) {
+            ( *this )( ipatch )->load_timers[2] += MPI_Wtime() - timer;
+        }
     }
 
     #pragma omp for schedule(static)
     for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+        double timer = MPI_Wtime();
         // Computes Bx_, By_, Bz_ at time n+1 on interior points.
         ( *( *this )( ipatch )->EMfields->MaxwellFaradaySolver_ )( ( *this )( ipatch )->EMfields );
+        if( params.measured_load_balancing ) {
+            ( *this )( ipatch )->load_timers[2] += MPI_Wtime() - timer;
+        }
     }
     //Synchronize B fields between patches.
     timers.maxwell.update( params.printNow( itime ) );
@@ -1510,13 +1678,17 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI *smpi )
     // compute control parameter
     double ctrl = rnew_dot_rnew / ( double )( nx_p2_global );
 
+    if( params.poisson_pipelined ) {
+        iteration = solvePoissonPipelined( params, smpi, 0., iteration_max, error_max, ( double )( nx_p2_global ), ctrl );
+    }
+
     // ---------------------------------------------------------
     // Starting iterative loop for the conjugate gradient method
     // ---------------------------------------------------------
     if( smpi->isMaster() ) {
         DEBUG( "Starting iterative loop for CG method" );
     }
-    while( ( ctrl > error_max ) && ( iteration<iteration_max ) ) {
+    while( !params.poisson_pipelined && ( ctrl > error_max ) && ( iteration<iteration_max ) ) {
         iteration++;
         if( smpi->isMaster() ) {
             DEBUG( "iteration " << iteration << " started with control parameter ctrl = " << ctrl*1.e14 << " x 1e-14" );
@@ -1731,6 +1903,146 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI *smpi )
 
 } // END solvePoisson
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Pipelined (preconditioned) conjugate gradient, for the Poisson and relativistic Poisson problems
+//   Same iterates as the preconditioned conjugate gradient, but the 3 scalar products of an iteration are reduced
+//   in a single non-blocking MPI_Iallreduce, which is overlapped by the preconditioner and the operator
+//   applications (and their ghost exchanges) of the next iteration.
+//   See P. Ghysels & W. Vanroose, Parallel Computing 40 (2014) 224
+//   The recurrences accumulate rounding errors : every residual_replacement iterations, the residual and the
+//   vectors derived from it are recomputed from phi and p (S. Cools et al., SIAM J. Matrix Anal. Appl. 39 (2018) 426).
+//   The iterations stop, with a warning, when the residual has not decreased for stagnation_iterations.
+//   gamma_mean>0 selects the relativistic operator, and ctrl = sqrt(r.r)/ctrl_norm instead of r.r/ctrl_norm
+//   Starts from the fields of initPoisson, returns the number of iterations.
+// ---------------------------------------------------------------------------------------------------------------------
+unsigned int VectorPatch::solvePoissonPipelined( Params &params, SmileiMPI *smpi, double gamma_mean, unsigned int iteration_max, double error_max, double ctrl_norm, double &ctrl )
+{
+    const unsigned int residual_replacement  = 50;
+    const unsigned int stagnation_iterations = 2*residual_replacement;
+    bool block_jacobi = params.poisson_block_jacobi;
+
+    std::vector<Field *> phi_, r_, p_, b_, u_, w_, m_, n_, z_, q_, s_;
+    for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+        ElectroMagn *EMfields = ( *this )( ipatch )->EMfields;
+        EMfields->initPipelinedPoisson();
+        phi_.push_back( EMfields->phi_ );
+        r_.push_back( EMfields->r_ );
+        p_.push_back( EMfields->p_ );
+        b_.push_back( EMfields->b_ );
+        u_.push_back( EMfields->u_ );
+        w_.push_back( EMfields->w_ );
+        m_.push_back( EMfields->m_ );
+        n_.push_back( EMfields->n_ );
+        z_.push_back( EMfields->z_ );
+        q_.push_back( EMfields->q_ );
+        s_.push_back( EMfields->s_ );
+    }
+
+    // b = r + A phi, for the residual replacement
+    applyPoissonPipelined( smpi, false, phi_, n_, gamma_mean, block_jacobi );
+    for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+        ( *this )( ipatch )->EMfields->pipelinedPoissonResidual( true );
+    }
+
+    // u = M^-1 r, w = A u
+    applyPoissonPipelined( smpi, true, r_, u_, gamma_mean, block_jacobi );
+    applyPoissonPipelined( smpi, false, u_, w_, gamma_mean, block_jacobi );
+
+    std::vector<double> history;
+    unsigned int iteration = 0, best_iteration = 0;
+    double alpha = 0., gamma_old = 0., best_ctrl = 0.;
+    bool stagnated = false;
+    while( true ) {
+        // gamma = r.u, delta = w.u, and r.r for the convergence test
+        double dots_local[3] = { 0., 0., 0. }, dots[3];
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            ElectroMagn *EMfields = ( *this )( ipatch )->EMfields;
+            dots_local[0] += EMfields->poissonDot( ( *this )( ipatch ), EMfields->r_, EMfields->u_ );
+            dots_local[1] += EMfields->poissonDot( ( *this )( ipatch ), EMfields->w_, EMfields->u_ );
+            dots_local[2] += EMfields->poissonDot( ( *this )( ipatch ), EMfields->r_, EMfields->r_ );
+        }
+        MPI_Request request;
+        MPI_Iallreduce( dots_local, dots, 3, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD, &request );
+
+        // m = M^-1 w, n = A m, while the reduction is in flight
+        applyPoissonPipelined( smpi, true, w_, m_, gamma_mean, block_jacobi );
+        applyPoissonPipelined( smpi, false, m_, n_, gamma_mean, block_jacobi );
+
+        MPI_Wait( &request, MPI_STATUS_IGNORE );
+        ctrl = gamma_mean > 0. ? sqrt( dots[2] )/ctrl_norm : dots[2]/ctrl_norm;
+        history.push_back( ctrl );
+        if( iteration == 0 || ctrl < best_ctrl ) {
+            best_ctrl = ctrl;
+            best_iteration = iteration;
+        }
+        stagnated = iteration >= best_iteration + stagnation_iterations;
+        if( ctrl <= error_max || iteration >= iteration_max || stagnated ) {
+            break;
+        }
+        iteration++;
+
+        double beta = 0.;
+        if( iteration > 1 ) {
+            beta  = dots[0] / gamma_old;
+            alpha = dots[0] / ( dots[1] - beta * dots[0] / alpha );
+        } else {
+            alpha = dots[0] / dots[1];
+        }
+        gamma_old = dots[0];
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            ( *this )( ipatch )->EMfields->updatePipelinedPoisson( alpha, beta );
+        }
+
+        // Residual replacement : r = b - A phi, u = M^-1 r, w = A u, s = A p, q = M^-1 s, z = A q
+        if( iteration % residual_replacement == 0 ) {
+            applyPoissonPipelined( smpi, false, phi_, n_, gamma_mean, block_jacobi );
+            for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+                ( *this )( ipatch )->EMfields->pipelinedPoissonResidual( false );
+            }
+            applyPoissonPipelined( smpi, true, r_, u_, gamma_mean, block_jacobi );
+            applyPoissonPipelined( smpi, false, u_, w_, gamma_mean, block_jacobi );
+            applyPoissonPipelined( smpi, false, p_, s_, gamma_mean, block_jacobi );
+            applyPoissonPipelined( smpi, true, s_, q_, gamma_mean, block_jacobi );
+            applyPoissonPipelined( smpi, false, q_, z_, gamma_mean, block_jacobi );
+        }
+    }
+
+    // Residual history, about 10 values, in the units of the convergence status
+    if( smpi->isMaster() ) {
+        double scale     = gamma_mean > 0. ? 1.0e22 : 1.0e14;
+        std::string unit = gamma_mean > 0. ? " x 1.e-22" : " x 1e-14";
+        MESSAGE( 1, "Pipelined conjugate gradient, preconditioner: " << ( block_jacobi ? "block_jacobi" : "none" ) );
+        unsigned int step = std::max( ( unsigned int )1, ( unsigned int )( history.size()/10 ) );
+        for( unsigned int i=0 ; i<history.size() ; i+=step ) {
+            MESSAGE( 2, "iteration " << i << " : ctrl = " << scale*history[i] << unit );
+        }
+        if( ( history.size()-1 )%step != 0 ) {
+            MESSAGE( 2, "iteration " << history.size()-1 << " : ctrl = " << scale*history.back() << unit );
+        }
+    }
+    if( stagnated ) {
+        WARNING( "Pipelined conjugate gradient stagnated at ctrl = " << best_ctrl << " after " << iteration << " iterations: the maximum error ("
+                 << error_max << ") is below the attainable accuracy" );
+    }
+
+    return iteration;
+}
+
+// y = M^-1 x (preconditioner) or y = A x (operator) in all patches, then exchange of y
+void VectorPatch::applyPoissonPipelined( SmileiMPI *smpi, bool preconditioner, std::vector<Field *> &x, std::vector<Field *> &y, double gamma_mean, bool block_jacobi )
+{
+    for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+        ElectroMagn *EMfields = ( *this )( ipatch )->EMfields;
+        if( preconditioner ) {
+            EMfields->applyPoissonPreconditioner( ( *this )( ipatch ), x[ipatch], y[ipatch], gamma_mean, block_jacobi );
+        } else {
+            EMfields->applyPoissonOperator( ( *this )( ipatch ), x[ipatch], y[ipatch], gamma_mean );
+        }
+    }
+    SyncVectorPatch::exchangeAlongAllDirectionsNoOMP<double,Field>( y, *this, smpi );
+    SyncVectorPatch::finalizeExchangeAlongAllDirectionsNoOMP( y, *this );
+}
+
 void VectorPatch::solvePoissonAM( Params &params, SmileiMPI *smpi )
 {
     
@@ -2125,13 +2437,17 @@ void VectorPatch::solveRelativisticPoisson( Params &params, SmileiMPI *smpi, dou
     //double ctrl = rnew_dot_rnew / (double)(nx_p2_global);
     double ctrl = sqrt( rnew_dot_rnew ) / norm2_source_term; // initially is equal to one
 
+    if( params.poisson_pipelined ) {
+        iteration = solvePoissonPipelined( params, smpi, gamma_mean, iteration_max, error_max, norm2_source_term, ctrl );
+    }
+
     // ---------------------------------------------------------
     // Starting iterative loop for the conjugate gradient method
     // ---------------------------------------------------------
     if( smpi->isMaster() ) {
         DEBUG( "Starting iterative loop for CG method" );
     }
-    while( ( ctrl > error_max ) && ( iteration<iteration_max ) ) {
+    while( !params.poisson_pipelined && ( ctrl > error_max ) && ( iteration<iteration_max ) ) {
         iteration++;
 
         if( ( smpi->isMaster() ) && ( iteration%1000==0 ) ) {
@@ -3414,6 +3730,20 @@ void VectorPatch::updateFieldList( SmileiMPI *smpi )
 
     }
 
+    // Patches moved : rebuild the plans of the aggregated exchanges
+    if( aggregated_exchange ) {
+        B_MPI_aggregated[0].build( B_MPIx, MPIxIdx, 2, *this, 0, smpi->haloComm(), 0, smpi->persistentCommunications() );
+        densities_MPI_aggregated[0].build( densitiesMPIx, MPIxIdx, 3, *this, 0, smpi->haloComm(), 3, smpi->persistentCommunications() );
+        if( nDim>1 ) {
+            B_MPI_aggregated[1].build( B1_MPIy, MPIyIdx, 2, *this, 1, smpi->haloComm(), 1, smpi->persistentCommunications() );
+            densities_MPI_aggregated[1].build( densitiesMPIy, MPIyIdx, 3, *this, 1, smpi->haloComm(), 4, smpi->persistentCommunications() );
+            if( nDim>2 ) {
+                B_MPI_aggregated[2].build( B2_MPIz, MPIzIdx, 2, *this, 2, smpi->haloComm(), 2, smpi->persistentCommunications() );
+                densities_MPI_aggregated[2].build( densitiesMPIz, MPIzIdx, 3, *this, 2, smpi->haloComm(), 5, smpi->persistentCommunications() );
+            }
+        }
+    }
+
     if( !dynamic_cast<ElectroMagnAM *>( patches_[0]->EMfields ) ) {
         for( unsigned int ipatch = 0 ; ipatch < size() ; ipatch++ ) {
             listJx_[ipatch]->MPIbuff.defineTags( patches_[ipatch], smpi, 1 );
@@ -3670,10 +4000,28 @@ void VectorPatch::applyCollisions( Params &params, int itime, Timers &timers )
     
     unsigned int ncoll = patches_[0]->vecCollisions.size();
     
-    #pragma omp for schedule(runtime)
-    for( unsigned int ipatch=0 ; ipatch<size() ; ipatch++ ) {
-        for( unsigned int icoll=0 ; icoll<ncoll; icoll++ ) {
-            patches_[ipatch]->vecCollisions[icoll]->collide( params, patches_[ipatch], itime, localDiags );
+    if( params.collisions_bin_threading ) {
+        // All threads collide the bins of one patch after the other
+        for( unsigned int ipatch=0 ; ipatch<size() ; ipatch++ ) {
+            double timer = MPI_Wtime();
+            for( unsigned int icoll=0 ; icoll<ncoll; icoll++ ) {
+                patches_[ipatch]->vecCollisions[icoll]->collideThreads( params, patches_[ipatch], itime, localDiags );
+            }
+            #pragma omp master
+            if( params.measured_load_balancing ) {
+                patches_[ipatch]->load_timers[1] += MPI_Wtime() - timer;
+            }
+        }
+    } else {
+        #pragma omp for schedule(runtime)
+        for( unsigned int ipatch=0 ; ipatch<size() ; ipatch++ ) {
+            double timer = MPI_Wtime();
+            for( unsigned int icoll=0 ; icoll<ncoll; icoll++ ) {
+                patches_[ipatch]->vecCollisions[icoll]->collide( params, patches_[ipatch], itime, localDiags );
+            }
+            if( params.measured_load_balancing ) {
+                patches_[ipatch]->load_timers[1] += MPI_Wtime() - timer;
+            }
         }
     }
     
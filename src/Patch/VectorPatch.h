@@ -19,6 +19,7 @@
 #include "Timers.h"
 #include "RadiationTables.h"
 #include "ParticleCreator.h"
+#include "AggregatedMPIbuffers.h"
 
 class Field;
 class Timer;
@@ -121,6 +122,24 @@ public :
                    MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
                    double time_dual,
                    Timers &timers, int itime );
+
+    //! Same as dynamics, but each patch is a graph of OpenMP tasks (push, particle exchange, start of the current sum)
+    void dynamicsWithTasks( Params &params,
+                            SmileiMPI *smpi,
+                            SimWindow *simWindow,
+                            RadiationTables &RadiationTables,
+                            MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
+                            double time_dual,
+                            Timers &timers, int itime );
+
+    //! Move the particles of all species of one patch
+    void patchDynamics( unsigned int ipatch,
+                        Params &params,
+                        SmileiMPI *smpi,
+                        SimWindow *simWindow,
+                        RadiationTables &RadiationTables,
+                        MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
+                        double time_dual );
     
     //! For all patches, exchange particles and sort them.
     void finalizeAndSortParticles( Params &params, SmileiMPI *smpi, SimWindow *simWindow,
@@ -192,6 +211,10 @@ public :
     void solvePoisson( Params &params, SmileiMPI *smpi );
     void runNonRelativisticPoissonModule( Params &params, SmileiMPI* smpi,  Timers &timers );
     void solvePoissonAM( Params &params, SmileiMPI *smpi);
+    //! Pipelined conjugate gradient for solvePoisson and solveRelativisticPoisson (Main.poisson_solver="pipelined_cg")
+    unsigned int solvePoissonPipelined( Params &params, SmileiMPI *smpi, double gamma_mean, unsigned int iteration_max, double error_max, double ctrl_norm, double &ctrl );
+    //! y = M^-1 x or y = A x in all patches, then exchange of y (see solvePoissonPipelined)
+    void applyPoissonPipelined( SmileiMPI *smpi, bool preconditioner, std::vector<Field *> &x, std::vector<Field *> &y, double gamma_mean, bool block_jacobi );
     
     //! Solve relativistic Poisson problem to initialize E and B of a relativistic bunch
     void runRelativisticModule( double time_prim, Params &params, SmileiMPI* smpi,  Timers &timers );
@@ -268,6 +291,11 @@ public :
     std::vector<Field *> B2_localz;
     std::vector<Field *> B2_MPIz;
     
+    //! Exchange of B_MPIx, B1_MPIy, B2_MPIz aggregated per MPI rank (if aggregated_exchange)
+    std::vector<AggregatedMPIbuffers> B_MPI_aggregated;
+    //! Sum of densitiesMPIx, densitiesMPIy, densitiesMPIz aggregated per MPI rank (if aggregated_exchange)
+    std::vector<AggregatedMPIbuffers> densities_MPI_aggregated;
+    
     std::vector<Field *> listJx_;
     std::vector<Field *> listJy_;
     std::vector<Field *> listJz_;
@@ -370,6 +398,12 @@ public :
     // Keep track if we need the needsRhoJsNow
     int diag_flag;
     
+    //! True when the MPI sum of currents along X has already been initiated by the tasks of dynamicsWithTasks
+    bool sum_densities_x_started;
+    
+    //! True if the halos of B and J are exchanged with a single message per neighbouring MPI rank
+    bool aggregated_exchange;
+    
     int nrequests;
     
     //! Tells which iteration was last time the patches moved (by moving window or load balancing)
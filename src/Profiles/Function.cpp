@@ -117,6 +117,214 @@ PyArrayObject *Function_Python4D::complexValueAt( std::vector<PyArrayObject *> x
 
 #endif
 
+// Profiles translated from python
+Function_Native::Function_Native( vector<double> &program, unsigned int nvariables ) :
+    nvariables_( nvariables )
+{
+    opcodes_ .resize( program.size()/2 );
+    operands_.resize( program.size()/2 );
+    for( unsigned int i=0; i<opcodes_.size(); i++ ) {
+        opcodes_ [i] = ( int ) program[2*i];
+        operands_[i] = program[2*i+1];
+    }
+}
+
+// Modulo with the sign of the divisor, as in python
+static inline double native_mod( double a, double b )
+{
+    double r = fmod( a, b );
+    return ( r != 0. && ( ( r < 0. ) != ( b < 0. ) ) ) ? r + b : r;
+}
+
+double Function_Native::evaluate( const double *x )
+{
+    double s[max_stack];
+    unsigned int n = 0;
+    for( unsigned int iop=0; iop<opcodes_.size(); iop++ ) {
+        switch( opcodes_[iop] ) {
+            case NATIVE_CONST : s[n++] = operands_[iop]; break;
+            case NATIVE_VAR   : s[n++] = x[( int ) operands_[iop]]; break;
+            case NATIVE_ADD   : s[n-2] = s[n-2] + s[n-1]; n--; break;
+            case NATIVE_SUB   : s[n-2] = s[n-2] - s[n-1]; n--; break;
+            case NATIVE_MUL   : s[n-2] = s[n-2] * s[n-1]; n--; break;
+            case NATIVE_DIV   : s[n-2] = s[n-2] / s[n-1]; n--; break;
+            case NATIVE_POW   : s[n-2] = pow( s[n-2], s[n-1] ); n--; break;
+            case NATIVE_MOD   : s[n-2] = native_mod( s[n-2], s[n-1] ); n--; break;
+            case NATIVE_NEG   : s[n-1] = -s[n-1]; break;
+            case NATIVE_LT    : s[n-2] = s[n-2] <  s[n-1]; n--; break;
+            case NATIVE_LE    : s[n-2] = s[n-2] <= s[n-1]; n--; break;
+            case NATIVE_GT    : s[n-2] = s[n-2] >  s[n-1]; n--; break;
+            case NATIVE_GE    : s[n-2] = s[n-2] >= s[n-1]; n--; break;
+            case NATIVE_EQ    : s[n-2] = s[n-2] == s[n-1]; n--; break;
+            case NATIVE_NE    : s[n-2] = s[n-2] != s[n-1]; n--; break;
+            case NATIVE_AND   : s[n-2] = ( s[n-2] != 0. ) && ( s[n-1] != 0. ); n--; break;
+            case NATIVE_OR    : s[n-2] = ( s[n-2] != 0. ) || ( s[n-1] != 0. ); n--; break;
+            case NATIVE_NOT   : s[n-1] = s[n-1] == 0.; break;
+            case NATIVE_WHERE : s[n-3] = s[n-3] != 0. ? s[n-2] : s[n-1]; n -= 2; break;
+            case NATIVE_MIN   : s[n-2] = fmin( s[n-2], s[n-1] ); n--; break;
+            case NATIVE_MAX   : s[n-2] = fmax( s[n-2], s[n-1] ); n--; break;
+            case NATIVE_ATAN2 : s[n-2] = atan2( s[n-2], s[n-1] ); n--; break;
+            case NATIVE_EXP   : s[n-1] = exp( s[n-1] ); break;
+            case NATIVE_LOG   : s[n-1] = log( s[n-1] ); break;
+            case NATIVE_LOG10 : s[n-1] = log10( s[n-1] ); break;
+            case NATIVE_SQRT  : s[n-1] = sqrt( s[n-1] ); break;
+            case NATIVE_SIN   : s[n-1] = sin( s[n-1] ); break;
+            case NATIVE_COS   : s[n-1] = cos( s[n-1] ); break;
+            case NATIVE_TAN   : s[n-1] = tan( s[n-1] ); break;
+            case NATIVE_ASIN  : s[n-1] = asin( s[n-1] ); break;
+            case NATIVE_ACOS  : s[n-1] = acos( s[n-1] ); break;
+            case NATIVE_ATAN  : s[n-1] = atan( s[n-1] ); break;
+            case NATIVE_SINH  : s[n-1] = sinh( s[n-1] ); break;
+            case NATIVE_COSH  : s[n-1] = cosh( s[n-1] ); break;
+            case NATIVE_TANH  : s[n-1] = tanh( s[n-1] ); break;
+            case NATIVE_ABS   : s[n-1] = fabs( s[n-1] ); break;
+            case NATIVE_FLOOR : s[n-1] = floor( s[n-1] ); break;
+            case NATIVE_CEIL  : s[n-1] = ceil( s[n-1] ); break;
+        }
+    }
+    return s[0];
+}
+
+double Function_Native::valueAt( double time )
+{
+    return evaluate( &time );
+}
+double Function_Native::valueAt( vector<double> x_cell, double time )
+{
+    // As Function_Python1D, a 1D profile only depends on time
+    if( nvariables_ == 1 ) {
+        return evaluate( &time );
+    }
+    x_cell.resize( nvariables_-1 );
+    x_cell.push_back( time );
+    return evaluate( x_cell.data() );
+}
+double Function_Native::valueAt( vector<double> x_cell )
+{
+    return evaluate( x_cell.data() );
+}
+std::complex<double> Function_Native::complexValueAt( vector<double> x_cell, double time )
+{
+    return valueAt( x_cell, time );
+}
+std::complex<double> Function_Native::complexValueAt( vector<double> x_cell )
+{
+    return valueAt( x_cell );
+}
+
+// Each operation is applied to a block of points before the next one, so that the loops vectorize
+#define NATIVE_BLOCK Function_Native::block_size
+#define NATIVE_UNARY( expr ) { double *a = s[n-1]; _Pragma( "omp simd" ) for( unsigned int i=0; i<np; i++ ) { a[i] = expr; } }
+#define NATIVE_BINARY( expr ) { double *p = s[n-2], *a = s[n-1]; _Pragma( "omp simd" ) for( unsigned int i=0; i<np; i++ ) { p[i] = expr; } n--; }
+
+void Function_Native::valuesAt( const double *const *variables, unsigned int np, double *ret )
+{
+    double s[max_stack][NATIVE_BLOCK];
+    unsigned int n = 0;
+    for( unsigned int iop=0; iop<opcodes_.size(); iop++ ) {
+        switch( opcodes_[iop] ) {
+            case NATIVE_CONST : {
+                double c = operands_[iop], *r = s[n++];
+                #pragma omp simd
+                for( unsigned int i=0; i<np; i++ ) {
+                    r[i] = c;
+                }
+                break;
+            }
+            case NATIVE_VAR : {
+                unsigned int ivar = ( unsigned int ) operands_[iop];
+                const double *x = variables[ivar];
+                double *r = s[n++];
+                #pragma omp simd
+                for( unsigned int i=0; i<np; i++ ) {
+                    r[i] = x[i];
+                }
+                break;
+            }
+            case NATIVE_ADD   : NATIVE_BINARY( p[i] + a[i] ); break;
+            case NATIVE_SUB   : NATIVE_BINARY( p[i] - a[i] ); break;
+            case NATIVE_MUL   : NATIVE_BINARY( p[i] * a[i] ); break;
+            case NATIVE_DIV   : NATIVE_BINARY( p[i] / a[i] ); break;
+            case NATIVE_POW   : NATIVE_BINARY( pow( p[i], a[i] ) ); break;
+            case NATIVE_MOD   : NATIVE_BINARY( native_mod( p[i], a[i] ) ); break;
+            case NATIVE_NEG   : NATIVE_UNARY( -a[i] ); break;
+            case NATIVE_LT    : NATIVE_BINARY( p[i] <  a[i] ? 1. : 0. ); break;
+            case NATIVE_LE    : NATIVE_BINARY( p[i] <= a[i] ? 1. : 0. ); break;
+            case NATIVE_GT    : NATIVE_BINARY( p[i] >  a[i] ? 1. : 0. ); break;
+            case NATIVE_GE    : NATIVE_BINARY( p[i] >= a[i] ? 1. : 0. ); break;
+            case NATIVE_EQ    : NATIVE_BINARY( p[i] == a[i] ? 1. : 0. ); break;
+            case NATIVE_NE    : NATIVE_BINARY( p[i] != a[i] ? 1. : 0. ); break;
+            case NATIVE_AND   : NATIVE_BINARY( p[i] != 0. && a[i] != 0. ? 1. : 0. ); break;
+            case NATIVE_OR    : NATIVE_BINARY( p[i] != 0. || a[i] != 0. ? 1. : 0. ); break;
+            case NATIVE_NOT   : NATIVE_UNARY( a[i] == 0. ? 1. : 0. ); break;
+            case NATIVE_WHERE : {
+                double *c = s[n-3], *p = s[n-2], *a = s[n-1];
+                #pragma omp simd
+                for( unsigned int i=0; i<np; i++ ) {
+                    c[i] = c[i] != 0. ? p[i] : a[i];
+                }
+                n -= 2;
+                break;
+            }
+            case NATIVE_MIN   : NATIVE_BINARY( fmin( p[i], a[i] ) ); break;
+            case NATIVE_MAX   : NATIVE_BINARY( fmax( p[i], a[i] ) ); break;
+            case NATIVE_ATAN2 : NATIVE_BINARY( atan2( p[i], a[i] ) ); break;
+            case NATIVE_EXP   : NATIVE_UNARY( exp( a[i] ) ); break;
+            case NATIVE_LOG   : NATIVE_UNARY( log( a[i] ) ); break;
+            case NATIVE_LOG10 : NATIVE_UNARY( log10( a[i] ) ); break;
+            case NATIVE_SQRT  : NATIVE_UNARY( sqrt( a[i] ) ); break;
+            case NATIVE_SIN   : NATIVE_UNARY( sin( a[i] ) ); break;
+            case NATIVE_COS   : NATIVE_UNARY( cos( a[i] ) ); break;
+            case NATIVE_TAN   : NATIVE_UNARY( tan( a[i] ) ); break;
+            case NATIVE_ASIN  : NATIVE_UNARY( asin( a[i] ) ); break;
+            case NATIVE_ACOS  : NATIVE_UNARY( acos( a[i] ) ); break;
+            case NATIVE_ATAN  : NATIVE_UNARY( atan( a[i] ) ); break;
+            case NATIVE_SINH  : NATIVE_UNARY( sinh( a[i] ) ); break;
+            case NATIVE_COSH  : NATIVE_UNARY( cosh( a[i] ) ); break;
+            case NATIVE_TANH  : NATIVE_UNARY( tanh( a[i] ) ); break;
+            case NATIVE_ABS   : NATIVE_UNARY( fabs( a[i] ) ); break;
+            case NATIVE_FLOOR : NATIVE_UNARY( floor( a[i] ) ); break;
+            case NATIVE_CEIL  : NATIVE_UNARY( ceil( a[i] ) ); break;
+        }
+    }
+    #pragma omp simd
+    for( unsigned int i=0; i<np; i++ ) {
+        ret[i] = s[0][i];
+    }
+}
+
+void Function_Native::valuesAt( vector<Field *> &coordinates, double time, bool with_time, Field &ret, bool add )
+{
+    unsigned int size = coordinates[0]->globalDims_;
+    unsigned int nvar = with_time && nvariables_ == 1 ? 0 : coordinates.size();
+    double t[NATIVE_BLOCK], r[NATIVE_BLOCK];
+    for( unsigned int i=0; i<NATIVE_BLOCK; i++ ) {
+        t[i] = time;
+    }
+    vector<const double *> variables( nvariables_ );
+    for( unsigned int i0=0; i0<size; i0+=NATIVE_BLOCK ) {
+        unsigned int np = min( size-i0, ( unsigned int ) NATIVE_BLOCK );
+        for( unsigned int ivar=0; ivar<nvariables_; ivar++ ) {
+            variables[ivar] = ivar < nvar ? &( coordinates[ivar]->data()[i0] ) : t;
+        }
+        valuesAt( variables.data(), np, r );
+        double *v = &( ret.data()[i0] );
+        if( add ) {
+            for( unsigned int i=0; i<np; i++ ) {
+                v[i] += r[i];
+            }
+        } else {
+            for( unsigned int i=0; i<np; i++ ) {
+                v[i] = r[i];
+            }
+        }
+    }
+}
+
+#undef NATIVE_BLOCK
+#undef NATIVE_UNARY
+#undef NATIVE_BINARY
+
 // Profiles from file
 double Function_File::valueAt( vector<double> x_cell )
 {
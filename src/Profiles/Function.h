@@ -161,6 +161,50 @@ private:
     PyObject *py_profile;
 };
 
+//! Operations of a profile translated from python (must match _native_opcodes in pyprofiles.py)
+enum NativeOpcode {
+    NATIVE_CONST=0, NATIVE_VAR,
+    NATIVE_ADD, NATIVE_SUB, NATIVE_MUL, NATIVE_DIV, NATIVE_POW, NATIVE_MOD, NATIVE_NEG,
+    NATIVE_LT, NATIVE_LE, NATIVE_GT, NATIVE_GE, NATIVE_EQ, NATIVE_NE,
+    NATIVE_AND, NATIVE_OR, NATIVE_NOT, NATIVE_WHERE,
+    NATIVE_MIN, NATIVE_MAX, NATIVE_ATAN2,
+    NATIVE_EXP, NATIVE_LOG, NATIVE_LOG10, NATIVE_SQRT, NATIVE_SIN, NATIVE_COS, NATIVE_TAN,
+    NATIVE_ASIN, NATIVE_ACOS, NATIVE_ATAN, NATIVE_SINH, NATIVE_COSH, NATIVE_TANH,
+    NATIVE_ABS, NATIVE_FLOOR, NATIVE_CEIL
+};
+
+//! Python profile translated into a postfix program, evaluated without the python interpreter
+class Function_Native : public Function
+{
+public:
+    //! program contains the pairs (opcode, operand) returned by _native_profile() in pyprofiles.py
+    Function_Native( std::vector<double> &program, unsigned int nvariables );
+    Function_Native( Function_Native *f ) : opcodes_( f->opcodes_ ), operands_( f->operands_ ), nvariables_( f->nvariables_ ) {};
+    double valueAt( double ); // time
+    double valueAt( std::vector<double>, double ); // space + time
+    double valueAt( std::vector<double> ); // space
+    std::complex<double> complexValueAt( std::vector<double>, double ); // space + time
+    std::complex<double> complexValueAt( std::vector<double> ); // space
+    //! Sets or adds (add=true) the values at all points of the coordinates fields. The time is the last variable if with_time=true.
+    void valuesAt( std::vector<Field *> &coordinates, double time, bool with_time, Field &ret, bool add );
+    //! Sets the values at np <= block_size points. variables[i] points to the np values of the i-th variable.
+    void valuesAt( const double *const *variables, unsigned int np, double *ret );
+    std::string getInfo()
+    {
+        return " (translated to native code)";
+    };
+    //! Maximum depth of the stack used for the evaluation
+    static const unsigned int max_stack = 64;
+    //! Number of points evaluated together
+    static const unsigned int block_size = 32;
+private:
+    //! Evaluates the program at one point
+    double evaluate( const double *x );
+    std::vector<int> opcodes_;
+    std::vector<double> operands_;
+    unsigned int nvariables_;
+};
+
 class Function_File : public Function
 {
 public:
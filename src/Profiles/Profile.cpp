@@ -12,6 +12,7 @@ Profile::Profile( PyObject *py_profile, unsigned int nvariables, string name, Pa
     profileName_( "" ),
     nvariables_( nvariables ),
     uses_numpy_( false ),
+    uses_native_( false ),
     uses_file_( false ),
     filename_( "" )
 {
@@ -195,9 +196,19 @@ Profile::Profile( PyObject *py_profile, unsigned int nvariables, string name, Pa
         }
         
         
+        // Try to translate the profile to native code (see _native_profile in pyprofiles.py)
+        PyObject *program = PyObject_CallMethod( PyImport_AddModule( "__main__" ), const_cast<char *>( "_native_profile" ), const_cast<char *>( "Oi" ), py_profile, ( int ) nvariables_ );
+        PyTools::checkPyError();
+        std::vector<double> native_program;
+        if( program && program != Py_None && PyTools::py2vector( program, native_program ) && native_program.size() > 0 ) {
+            uses_native_ = true;
+            DEBUG( "Profile `"<<name<<"`: translated to native code (" << native_program.size()/2 << " operations)" );
+        }
+        Py_XDECREF( program );
+        
         // Verify that the profile transforms a float in a float
 #ifdef SMILEI_USE_NUMPY
-        if( try_numpy ) {
+        if( try_numpy && !uses_native_ ) {
             // If numpy available, verify that the profile accepts numpy arguments
             // We test 2 options : the arrays dimension equal to nvariables or nvariables-1
             unsigned int ndim;
@@ -249,7 +260,7 @@ Profile::Profile( PyObject *py_profile, unsigned int nvariables, string name, Pa
             }
         }
 #endif
-        if( !uses_numpy_ ) {
+        if( !uses_numpy_ && !uses_native_ ) {
             // Otherwise, try a float
             PyObject *z = PyFloat_FromDouble( 0. );
             PyObject *ret( nullptr );
@@ -273,7 +284,9 @@ Profile::Profile( PyObject *py_profile, unsigned int nvariables, string name, Pa
         }
         
         // Assign the evaluating function, which depends on the number of arguments
-        if( nvariables_ == 1 ) {
+        if( uses_native_ ) {
+            function_ = new Function_Native( native_program, nvariables_ );
+        } else if( nvariables_ == 1 ) {
             function_ = new Function_Python1D( py_profile );
         } else if( nvariables_ == 2 ) {
             function_ = new Function_Python2D( py_profile );
@@ -318,6 +331,7 @@ Profile::Profile( Profile *p )
     profileName_ = p->profileName_;
     nvariables_ = p->nvariables_;
     uses_numpy_  = p->uses_numpy_ ;
+    uses_native_ = p->uses_native_;
     uses_file_ = p->uses_file_;
     filename_ = p->filename_;
     
@@ -385,6 +399,8 @@ Profile::Profile( Profile *p )
         } else if( profileName_ == "tsin2plateau" ) {
             function_ = new Function_TimeSin2Plateau( static_cast<Function_TimeSin2Plateau *>( p->function_ ) );
         }
+    } else if( uses_native_ ) {
+        function_ = new Function_Native( static_cast<Function_Native *>( p->function_ ) );
     } else if( uses_file_ ) {
         function_ = new Function_File( static_cast<Function_File *>( p->function_ ) );
     } else {
@@ -91,8 +91,12 @@ public:
             Py_DECREF( values );
         } else
 #endif
+        // Profile translated to native code
+        if( uses_native_ ) {
+            static_cast<Function_Native *>( function_ )->valuesAt( coordinates, time, mode & 0b10, ret, mode & 0b01 );
+        
         // Profile read from a file
-        if( uses_file_ ) {
+        } else if( uses_file_ ) {
             std::vector<double> start( nvar );
             std::vector<double> stop ( nvar );
             std::vector<unsigned int> n = static_cast<Field3D*>(coordinates[0])->dims();
@@ -325,6 +329,9 @@ private:
     //! Whether the profile is using numpy
     bool uses_numpy_;
     
+    //! Whether the python profile has been translated to native code
+    bool uses_native_;
+    
     //! Whether the profile is taken from a file
     bool uses_file_;
     std::string filename_;
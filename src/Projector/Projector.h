@@ -49,8 +49,19 @@ public:
         ERROR( "Envelope not implemented with this geometry and this order" );
     };
     
+    //! Set the number of timesteps between two current projections (Species.subcycle)
+    void setSubcycle( unsigned int n )
+    {
+        subcycle = ( double ) n;
+    };
+    
 protected:
     double inv_cell_volume;
+    
+    //! Factor of the currents computed from the particle velocity, which must account for
+    //! all the timesteps since the previous projection. The currents computed from the
+    //! displacement (Esirkepov) already do.
+    double subcycle;
 };
 
 #endif
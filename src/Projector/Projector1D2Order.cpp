@@ -45,8 +45,8 @@ void Projector1D2Order::currents( double *Jx, double *Jy, double *Jz, Particles
     double charge_weight = inv_cell_volume * ( double )( particles.charge( ipart ) )*particles.weight( ipart );
     double xjn, xj_m_xipo, xj_m_xipo2, xj_m_xip, xj_m_xip2;
     double crx_p = charge_weight*dx_ov_dt;                // current density for particle moving in the x-direction
-    double cry_p = charge_weight*particles.momentum( 1, ipart )*invgf;  // current density in the y-direction of the macroparticle
-    double crz_p = charge_weight*particles.momentum( 2, ipart )*invgf;  // current density allow the y-direction of the macroparticle
+    double cry_p = charge_weight*particles.momentum( 1, ipart )*invgf*subcycle;  // current density in the y-direction of the macroparticle
+    double crz_p = charge_weight*particles.momentum( 2, ipart )*invgf*subcycle;  // current density allow the y-direction of the macroparticle
     double S0[5], S1[5], Wl[5], Wt[5], Jx_p[5];            // arrays used for the Esirkepov projection method
     
     // Initialize variables
@@ -116,8 +116,8 @@ void Projector1D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
     double charge_weight = inv_cell_volume * ( double )( particles.charge( ipart ) )*particles.weight( ipart );
     double xjn, xj_m_xipo, xj_m_xipo2, xj_m_xip, xj_m_xip2;
     double crx_p = charge_weight*dx_ov_dt;                // current density for particle moving in the x-direction
-    double cry_p = charge_weight*particles.momentum( 1, ipart )*invgf;  // current density in the y-direction of the macroparticle
-    double crz_p = charge_weight*particles.momentum( 2, ipart )*invgf;  // current density allow the y-direction of the macroparticle
+    double cry_p = charge_weight*particles.momentum( 1, ipart )*invgf*subcycle;  // current density in the y-direction of the macroparticle
+    double crz_p = charge_weight*particles.momentum( 2, ipart )*invgf*subcycle;  // current density allow the y-direction of the macroparticle
     double S0[5], S1[5], Wl[5], Wt[5], Jx_p[5];            // arrays used for the Esirkepov projection method
     
     // Initialize variables
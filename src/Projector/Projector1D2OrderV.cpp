@@ -0,0 +1,374 @@
+#include "Projector1D2OrderV.h"
+
+#include <cmath>
+#include <iostream>
+
+#include "ElectroMagn.h"
+#include "Field1D.h"
+#include "Particles.h"
+#include "Tools.h"
+#include "Patch.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor for Projector1D2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+Projector1D2OrderV::Projector1D2OrderV( Params &params, Patch *patch ) : Projector1D( params, patch )
+{
+    dx_inv_  = 1.0/params.cell_length[0];
+    dx_ov_dt = params.cell_length[0] / params.timestep;
+
+    index_domain_begin = patch->getCellStartingGlobalIndex( 0 );
+
+    oversize = params.oversize[0];
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor for Projector1D2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+Projector1D2OrderV::~Projector1D2OrderV()
+{
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//!  Project current densities & charge : diagFields timstep
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector1D2OrderV::currentsAndDensity( double *Jx, double *Jy, double *Jz, double *rho, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref )
+{
+    int ipo = iold[0];
+    int ipom2 = ipo-2;
+
+    int vecSize = 8;
+
+    double bRho[40] __attribute__( ( aligned( 64 ) ) );
+    double charge_weight[8] __attribute__( ( aligned( 64 ) ) );
+
+    // Jx, Jy, Jz
+    currents( Jx, Jy, Jz, particles, istart, iend, invgf, iold, deltaold, ipart_ref );
+
+    // rho^(p)
+    int cell_nparts( ( int )iend-( int )istart );
+    #pragma omp simd
+    for( unsigned int j=0; j<40; j++ ) {
+        bRho[j] = 0.;
+    }
+
+    for( int ivect=0 ; ivect < cell_nparts; ivect += vecSize ) {
+
+        int np_computed( min( cell_nparts-ivect, vecSize ) );
+
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+
+            // locate the particle on the primal grid at current time-step & calculate coeff. S1
+            double pos = particles.position( 0, ivect+ipart+istart ) * dx_inv_;
+            int cell = round( pos );
+            int cell_shift = cell-ipo-index_domain_begin;
+            double delta  = pos - ( double )cell;
+            double delta2 = delta*delta;
+            double deltam =  0.5 * ( delta2-delta+0.25 );
+            double deltap =  0.5 * ( delta2+delta+0.25 );
+            delta2 = 0.75 - delta2;
+            double m1 = ( cell_shift == -1 );
+            double c0 = ( cell_shift ==  0 );
+            double p1 = ( cell_shift ==  1 );
+
+            charge_weight[ipart] = inv_cell_volume * ( double )( particles.charge( ivect+istart+ipart ) )*particles.weight( ivect+istart+ipart );
+
+            bRho[          ipart] += charge_weight[ipart] * ( m1 * deltam );
+            bRho[  vecSize+ipart] += charge_weight[ipart] * ( c0 * deltam + m1*delta2 );
+            bRho[2*vecSize+ipart] += charge_weight[ipart] * ( p1 * deltam + c0*delta2 + m1*deltap );
+            bRho[3*vecSize+ipart] += charge_weight[ipart] * ( p1*delta2 + c0*deltap );
+            bRho[4*vecSize+ipart] += charge_weight[ipart] * ( p1*deltap );
+        }
+    }
+
+    for( unsigned int i=0 ; i<5 ; i++ ) {
+        double tmpRho = 0.;
+#pragma unroll(8)
+        for( int ipart=0 ; ipart<8; ipart++ ) {
+            tmpRho += bRho[i*vecSize+ipart];
+        }
+        rho[ipom2+i] += tmpRho;
+    }
+
+} // END Project local current densities at dag timestep.
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project charge : frozen & diagFields timstep
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector1D2OrderV::basic( double *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
+{
+
+    //Warning : this function is used for frozen species or initialization only and doesn't use the standard scheme.
+    //rho type = 0
+    //Jx type = 1
+    //Jy type = 2
+    //Jz type = 3
+
+    int ip;
+    double xjn, xj_m_xip, xj_m_xip2;
+    double S1[5];
+
+    double charge_weight = inv_cell_volume * ( double )( particles.charge( ipart ) )*particles.weight( ipart );
+    if( type > 0 ) {
+        charge_weight *= 1./sqrt( 1.0 + particles.momentum( 0, ipart )*particles.momentum( 0, ipart )
+                                  + particles.momentum( 1, ipart )*particles.momentum( 1, ipart )
+                                  + particles.momentum( 2, ipart )*particles.momentum( 2, ipart ) );
+
+        if( type == 1 ) {
+            charge_weight *= particles.momentum( 0, ipart );
+        } else if( type == 2 ) {
+            charge_weight *= particles.momentum( 1, ipart );
+        } else {
+            charge_weight *= particles.momentum( 2, ipart );
+        }
+    }
+
+    for( unsigned int i=0; i<5; i++ ) {
+        S1[i]=0.;
+    }//i
+
+    // Locate particle new position on the primal grid
+    xjn       = particles.position( 0, ipart ) * dx_inv_;
+    ip        = round( xjn + 0.5 * ( type==1 ) );
+    xj_m_xip  = xjn - ( double )ip;
+    xj_m_xip2 = xj_m_xip*xj_m_xip;
+
+    S1[1] = 0.5 * ( xj_m_xip2-xj_m_xip+0.25 );
+    S1[2] = ( 0.75-xj_m_xip2 );
+    S1[3] = 0.5 * ( xj_m_xip2+xj_m_xip+0.25 );
+
+    ip -= index_domain_begin + 2;
+
+    // 2nd order projection for charge density
+    // At the 2nd order, oversize = 2.
+    for( unsigned int i=0; i<5; i++ ) {
+        rhoj[i + ip ] += charge_weight * S1[i];
+    }//i
+
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project global current densities : ionization
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector1D2OrderV::ionizationCurrents( Field *Jx, Field *Jy, Field *Jz, Particles &particles, int ipart, LocalFields Jion )
+{
+    Field1D *Jx1D  = static_cast<Field1D *>( Jx );
+    Field1D *Jy1D  = static_cast<Field1D *>( Jy );
+    Field1D *Jz1D  = static_cast<Field1D *>( Jz );
+
+    int i, im1, ip1;
+    double xjn, xjmxi, xjmxi2;
+    double cim1, ci, cip1;
+
+    // weighted currents
+    double weight = inv_cell_volume * particles.weight( ipart );
+    double Jx_ion = Jion.x * weight;
+    double Jy_ion = Jion.y * weight;
+    double Jz_ion = Jion.z * weight;
+
+    xjn    = particles.position( 0, ipart ) * dx_inv_;
+
+    // Compute Jx_ion on the dual grid
+    i      = round( xjn+0.5 );
+    xjmxi  = xjn - ( double )i + 0.5;
+    xjmxi2 = xjmxi*xjmxi;
+
+    i  -= index_domain_begin;
+    im1 = i-1;
+    ip1 = i+1;
+
+    cim1 = 0.5 * ( xjmxi2-xjmxi+0.25 );
+    ci   = ( 0.75-xjmxi2 );
+    cip1 = 0.5 * ( xjmxi2+xjmxi+0.25 );
+
+    ( *Jx1D )( im1 )  += cim1 * Jx_ion;
+    ( *Jx1D )( i )    += ci   * Jx_ion;
+    ( *Jx1D )( ip1 )  += cip1 * Jx_ion;
+
+    // Compute Jy_ion & Jz_ion on the primal grid
+    i      = round( xjn );
+    xjmxi  = xjn - ( double )i;
+    xjmxi2 = xjmxi*xjmxi;
+
+    i  -= index_domain_begin;
+    im1 = i-1;
+    ip1 = i+1;
+
+    cim1 = 0.5 * ( xjmxi2-xjmxi+0.25 );
+    ci   = ( 0.75-xjmxi2 );
+    cip1 = 0.5 * ( xjmxi2+xjmxi+0.25 );
+
+    ( *Jy1D )( im1 )  += cim1 * Jy_ion;
+    ( *Jy1D )( i )    += ci   * Jy_ion;
+    ( *Jy1D )( ip1 )  += cip1 * Jy_ion;
+
+    ( *Jz1D )( im1 )  += cim1 * Jz_ion;
+    ( *Jz1D )( i )    += ci   * Jz_ion;
+    ( *Jz1D )( ip1 )  += cip1 * Jz_ion;
+
+} // END Project global current densities (ionize)
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project current densities : vectorized over the particles of a cell, by blocks of 8
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector1D2OrderV::currents( double *Jx, double *Jy, double *Jz, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref )
+{
+    // -------------------------------------
+    // Variable declaration & initialization
+    // -------------------------------------
+
+    int ipo = iold[0];
+    int ipom2 = ipo-2;
+
+    int vecSize = 8;
+
+    double bJx[40] __attribute__( ( aligned( 64 ) ) );
+    double bJy[40] __attribute__( ( aligned( 64 ) ) );
+    double bJz[40] __attribute__( ( aligned( 64 ) ) );
+
+    double Sx0_buff_vect[40] __attribute__( ( aligned( 64 ) ) );
+    double DSx[40] __attribute__( ( aligned( 64 ) ) );
+    double charge_weight[8] __attribute__( ( aligned( 64 ) ) );
+    double cry_p[8] __attribute__( ( aligned( 64 ) ) );
+    double crz_p[8] __attribute__( ( aligned( 64 ) ) );
+
+    #pragma omp simd
+    for( unsigned int j=0; j<40; j++ ) {
+        bJx[j] = 0.;
+        bJy[j] = 0.;
+        bJz[j] = 0.;
+    }
+
+    int cell_nparts( ( int )iend-( int )istart );
+
+    for( int ivect=0 ; ivect < cell_nparts; ivect += vecSize ) {
+
+        int np_computed = min( cell_nparts-ivect, vecSize );
+
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+
+            // locate the particle on the primal grid at current time-step & calculate coeff. S1
+            double pos = particles.position( 0, ivect+ipart+istart ) * dx_inv_;
+            int cell = round( pos );
+            int cell_shift = cell-ipo-index_domain_begin;
+            double delta  = pos - ( double )cell;
+            double delta2 = delta*delta;
+            double deltam =  0.5 * ( delta2-delta+0.25 );
+            double deltap =  0.5 * ( delta2+delta+0.25 );
+            delta2 = 0.75 - delta2;
+            double m1 = ( cell_shift == -1 );
+            double c0 = ( cell_shift ==  0 );
+            double p1 = ( cell_shift ==  1 );
+            double Sx1[5];
+            Sx1[0] = m1 * deltam;
+            Sx1[1] = c0 * deltam + m1*delta2;
+            Sx1[2] = p1 * deltam + c0*delta2 + m1*deltap;
+            Sx1[3] =               p1*delta2 + c0*deltap;
+            Sx1[4] =                           p1*deltap;
+            // locate the particle on the primal grid at former time-step & calculate coeff. S0
+            delta = deltaold[ivect+ipart-ipart_ref+istart];
+            delta2 = delta*delta;
+            Sx0_buff_vect[          ipart] = 0;
+            Sx0_buff_vect[  vecSize+ipart] = 0.5 * ( delta2-delta+0.25 );
+            Sx0_buff_vect[2*vecSize+ipart] = 0.75-delta2;
+            Sx0_buff_vect[3*vecSize+ipart] = 0.5 * ( delta2+delta+0.25 );
+            Sx0_buff_vect[4*vecSize+ipart] = 0;
+
+            for( unsigned int i = 0; i < 5 ; i++ ) {
+                DSx[i*vecSize+ipart] = Sx1[i] - Sx0_buff_vect[ i*vecSize+ipart];
+            }
+
+            charge_weight[ipart] = inv_cell_volume * ( double )( particles.charge( ivect+istart+ipart ) )*particles.weight( ivect+istart+ipart );
+            cry_p[ipart] = charge_weight[ipart]*particles.momentum( 1, ivect+istart+ipart )*( *invgf )[ivect+istart+ipart-ipart_ref]*subcycle;
+            crz_p[ipart] = charge_weight[ipart]*particles.momentum( 2, ivect+istart+ipart )*( *invgf )[ivect+istart+ipart-ipart_ref]*subcycle;
+        }
+
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+            double crx_p = charge_weight[ipart]*dx_ov_dt;
+
+            // Jx from the charge conservation equation
+            double sum = 0.;
+            for( unsigned int i=1 ; i<5 ; i++ ) {
+                sum -= DSx[( i-1 )*vecSize+ipart];
+                bJx[i*vecSize+ipart] += sum * crx_p;
+            }
+
+            // Jy, Jz with the time-averaged shape factor
+            for( unsigned int i=0 ; i<5 ; i++ ) {
+                double Wt = Sx0_buff_vect[i*vecSize+ipart] + 0.5*DSx[i*vecSize+ipart];
+                bJy[i*vecSize+ipart] += cry_p[ipart] * Wt;
+                bJz[i*vecSize+ipart] += crz_p[ipart] * Wt;
+            }
+        }
+
+    }
+
+    for( unsigned int i=0 ; i<5 ; i++ ) {
+        double tmpJx( 0. ), tmpJy( 0. ), tmpJz( 0. );
+#pragma unroll
+        for( int ipart=0 ; ipart<8; ipart++ ) {
+            tmpJx += bJx[i*vecSize+ipart];
+            tmpJy += bJy[i*vecSize+ipart];
+            tmpJz += bJz[i*vecSize+ipart];
+        }
+        Jx[ipom2+i] += tmpJx;
+        Jy[ipom2+i] += tmpJy;
+        Jz[ipom2+i] += tmpJz;
+    }
+
+} // END Project vectorized
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Wrapper for projection
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector1D2OrderV::currentsAndDensityWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int icell, int ipart_ref )
+{
+    if( istart == iend ) {
+        return;    //Don't treat empty cells.
+    }
+
+    std::vector<double> *delta = &( smpi->dynamics_deltaold[ithread] );
+    std::vector<double> *invgf = &( smpi->dynamics_invgf[ithread] );
+
+    // In 1D the sorting cell is the primal cell of the particles
+    int iold[1];
+    iold[0] = icell + oversize;
+
+    // If no field diagnostics this timestep, then the projection is done directly on the total arrays
+    if( !diag_flag ) {
+        double *b_Jx =  &( *EMfields->Jx_ )( 0 );
+        double *b_Jy =  &( *EMfields->Jy_ )( 0 );
+        double *b_Jz =  &( *EMfields->Jz_ )( 0 );
+        if( !is_spectral ) {
+            currents( b_Jx, b_Jy, b_Jz, particles, istart, iend, invgf, iold, &( *delta )[0], ipart_ref );
+        } else {
+            double *b_rho = &( *EMfields->rho_ )( 0 );
+            currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles, istart, iend, invgf, iold, &( *delta )[0], ipart_ref );
+        }
+
+        // Otherwise, the projection may apply to the species-specific arrays
+    } else {
+        double *b_Jx  = EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )( 0 ) : &( *EMfields->Jx_ )( 0 ) ;
+        double *b_Jy  = EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )( 0 ) : &( *EMfields->Jy_ )( 0 ) ;
+        double *b_Jz  = EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )( 0 ) : &( *EMfields->Jz_ )( 0 ) ;
+        double *b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
+        currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles, istart, iend, invgf, iold, &( *delta )[0], ipart_ref );
+    }
+}
+
+// Project susceptibility
+void Projector1D2OrderV::susceptibility( ElectroMagn *EMfields, Particles &particles, double species_mass, SmileiMPI *smpi, int istart, int iend,  int ithread, int icell, int ipart_ref )
+{
+    ERROR( "Vectorized projection of the susceptibility for the envelope model is not implemented for 1D geometry" );
+}
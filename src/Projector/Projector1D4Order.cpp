@@ -44,8 +44,8 @@ void Projector1D4Order::currents( double *Jx, double *Jy, double *Jz, Particles
     double charge_weight = inv_cell_volume * ( double )( particles.charge( ipart ) )*particles.weight( ipart );
     double xjn, xj_m_xipo, xj_m_xipo2, xj_m_xipo3, xj_m_xipo4, xj_m_xip, xj_m_xip2, xj_m_xip3, xj_m_xip4;
     double crx_p = charge_weight*dx_ov_dt;                // current density for particle moving in the x-direction
-    double cry_p = charge_weight*particles.momentum( 1, ipart )*invgf;  // current density in the y-direction of the macroparticle
-    double crz_p = charge_weight*particles.momentum( 2, ipart )*invgf;  // current density allow the y-direction of the macroparticle
+    double cry_p = charge_weight*particles.momentum( 1, ipart )*invgf*subcycle;  // current density in the y-direction of the macroparticle
+    double crz_p = charge_weight*particles.momentum( 2, ipart )*invgf*subcycle;  // current density allow the y-direction of the macroparticle
     double S0[7], S1[7], Wl[7], Wt[7], Jx_p[7];            // arrays used for the Esirkepov projection method
     // Initialize variables
     for( unsigned int i=0; i<7; i++ ) {
@@ -126,8 +126,8 @@ void Projector1D4Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
     double charge_weight = inv_cell_volume * ( double )( particles.charge( ipart ) )*particles.weight( ipart );
     double xjn, xj_m_xipo, xj_m_xipo2, xj_m_xipo3, xj_m_xipo4, xj_m_xip, xj_m_xip2, xj_m_xip3, xj_m_xip4;
     double crx_p = charge_weight*dx_ov_dt;                // current density for particle moving in the x-direction
-    double cry_p = charge_weight*particles.momentum( 1, ipart )*invgf;  // current density in the y-direction of the macroparticle
-    double crz_p = charge_weight*particles.momentum( 2, ipart )*invgf;  // current density allow the y-direction of the macroparticle
+    double cry_p = charge_weight*particles.momentum( 1, ipart )*invgf*subcycle;  // current density in the y-direction of the macroparticle
+    double crz_p = charge_weight*particles.momentum( 2, ipart )*invgf*subcycle;  // current density allow the y-direction of the macroparticle
     double S0[7], S1[7], Wl[7], Wt[7], Jx_p[7];            // arrays used for the Esirkepov projection method
     // Initialize variables
     for( unsigned int i=0; i<7; i++ ) {
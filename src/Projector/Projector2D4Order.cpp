@@ -56,7 +56,7 @@ void Projector2D4Order::currents( double *Jx, double *Jy, double *Jz, Particles
     double charge_weight = inv_cell_volume * ( double )( particles.charge( ipart ) )*particles.weight( ipart );
     double crx_p = charge_weight*dx_ov_dt;
     double cry_p = charge_weight*dy_ov_dt;
-    double crz_p = charge_weight*one_third*particles.momentum( 2, ipart )*invgf;
+    double crz_p = charge_weight*one_third*particles.momentum( 2, ipart )*invgf*subcycle;
     
     // variable declaration
     double xpn, ypn;
@@ -203,7 +203,7 @@ void Projector2D4Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
     double charge_weight = inv_cell_volume * ( double )( particles.charge( ipart ) )*particles.weight( ipart );
     double crx_p = charge_weight*dx_ov_dt;
     double cry_p = charge_weight*dy_ov_dt;
-    double crz_p = charge_weight*one_third*particles.momentum( 2, ipart )*invgf;
+    double crz_p = charge_weight*one_third*particles.momentum( 2, ipart )*invgf*subcycle;
     
     // variable declaration
     double xpn, ypn;
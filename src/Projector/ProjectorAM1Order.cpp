@@ -161,9 +161,9 @@ void ProjectorAM1Order::currents( ElectroMagnAM *emAM, Particles &particles, uns
     e_theta[0] = std::polar( 1.0, theta_old );
     e_theta[1] = std::polar( 1.0, theta );
 
-    double crl_p =  ( particles.momentum( 0, ipart )) *invgf;
-    double crt_p =  ( particles.momentum( 2, ipart )*real(e_theta[0]) - particles.momentum( 1, ipart )*imag(e_theta[0]) ) * invgf;
-    double crr_p =  ( particles.momentum( 1, ipart )*real(e_theta[0]) + particles.momentum( 2, ipart )*imag(e_theta[0]) ) * invgf;
+    double crl_p =  ( particles.momentum( 0, ipart )) *invgf*subcycle;
+    double crt_p =  ( particles.momentum( 2, ipart )*real(e_theta[0]) - particles.momentum( 1, ipart )*imag(e_theta[0]) ) * invgf*subcycle;
+    double crr_p =  ( particles.momentum( 1, ipart )*real(e_theta[0]) + particles.momentum( 2, ipart )*imag(e_theta[0]) ) * invgf*subcycle;
 
     
     // locate the particle on the primal grid at current time-step & calculate coeff. S1
@@ -0,0 +1,616 @@
+#include "ProjectorAM2OrderV.h"
+
+#include <cmath>
+#include <iostream>
+#include <complex>
+#include "dcomplex.h"
+#include "ElectroMagnAM.h"
+#include "cField2D.h"
+#include "Particles.h"
+#include "Tools.h"
+#include "Patch.h"
+#include "PatchAM.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor for ProjectorAM2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+ProjectorAM2OrderV::ProjectorAM2OrderV( Params &params, Patch *patch ) : ProjectorAM( params, patch )
+{
+    dt = params.timestep;
+    dr = params.cell_length[1];
+    dl_inv_   = 1.0/params.cell_length[0];
+    dl_ov_dt  = params.cell_length[0] / params.timestep;
+    dr_ov_dt  = params.cell_length[1] / params.timestep;
+    dr_inv_   = 1.0 / dr;
+    one_ov_dt  = 1.0 / params.timestep;
+    Nmode=params.nmodes;
+    i_domain_begin = patch->getCellStartingGlobalIndex( 0 );
+    j_domain_begin = patch->getCellStartingGlobalIndex( 1 );
+
+    nscellr = params.n_space[1] + 1;
+    oversize[0] = params.oversize[0];
+    oversize[1] = params.oversize[1];
+    nprimr = nscellr + 2*oversize[1];
+    npriml = params.n_space[0] + 2*params.oversize[0] + 1;
+
+    invR = &((static_cast<PatchAM *>( patch )->invR)[0]);
+    invRd = &((static_cast<PatchAM *>( patch )->invRd)[0]);
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor for ProjectorAM2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+ProjectorAM2OrderV::~ProjectorAM2OrderV()
+{
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project local currents of the particles of a cell for all modes (vectorized)
+//! Particles are treated by blocks of 8: the shape factors, exp(i theta) and exp(i dtheta) are computed once per
+//! particle, then each mode is deposited in the block buffers and reduced on the grid.
+// ---------------------------------------------------------------------------------------------------------------------
+void ProjectorAM2OrderV::currents( ElectroMagnAM *emAM, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, double *array_theta_old, bool diag_flag, int ispec, int ipart_ref )
+{
+    // -------------------------------------
+    // Variable declaration & initialization
+    // -------------------------------------
+
+    int npart_total = invgf->size();
+    int ipo = iold[0];
+    int jpo = iold[1];
+    int ipom2 = ipo-2;
+    int jpom2 = jpo-2;
+
+    int vecSize = 8;
+    int bsize = 5*5*vecSize;
+
+    // Real and imaginary parts of the block buffers
+    double bJl_r[bsize] __attribute__( ( aligned( 64 ) ) );
+    double bJl_i[bsize] __attribute__( ( aligned( 64 ) ) );
+    double bJr_r[bsize] __attribute__( ( aligned( 64 ) ) );
+    double bJr_i[bsize] __attribute__( ( aligned( 64 ) ) );
+    double bJt_r[bsize] __attribute__( ( aligned( 64 ) ) );
+    double bJt_i[bsize] __attribute__( ( aligned( 64 ) ) );
+    double brho_r[bsize] __attribute__( ( aligned( 64 ) ) );
+    double brho_i[bsize] __attribute__( ( aligned( 64 ) ) );
+
+    double Sl0_buff_vect[40] __attribute__( ( aligned( 64 ) ) );
+    double Sr0_buff_vect[40] __attribute__( ( aligned( 64 ) ) );
+    double Sl1_buff_vect[40] __attribute__( ( aligned( 64 ) ) );
+    double Sr1_buff_vect[40] __attribute__( ( aligned( 64 ) ) );
+    double DSl[40] __attribute__( ( aligned( 64 ) ) );
+    double Jl_p[40] __attribute__( ( aligned( 64 ) ) );
+    double tmpJl[40] __attribute__( ( aligned( 64 ) ) );
+    double Jr_p[40] __attribute__( ( aligned( 64 ) ) );
+    double charge_weight[8] __attribute__( ( aligned( 64 ) ) );
+    double crt_p0[8] __attribute__( ( aligned( 64 ) ) );
+    double r_bar[8] __attribute__( ( aligned( 64 ) ) );
+    // exp(i theta_bar), exp(i dtheta) and their power m for the current mode
+    double e_bar_m1_r[8] __attribute__( ( aligned( 64 ) ) );
+    double e_bar_m1_i[8] __attribute__( ( aligned( 64 ) ) );
+    double e_delta_m1_r[8] __attribute__( ( aligned( 64 ) ) );
+    double e_delta_m1_i[8] __attribute__( ( aligned( 64 ) ) );
+    double e_bar_r[8] __attribute__( ( aligned( 64 ) ) );
+    double e_bar_i[8] __attribute__( ( aligned( 64 ) ) );
+    double e_delta_r[8] __attribute__( ( aligned( 64 ) ) );
+    double e_delta_i[8] __attribute__( ( aligned( 64 ) ) );
+
+    // Radial quantities are the same for all the particles of the cell
+    double *invR_local = &( invR[jpom2] );
+    double Vd[4], invRd_local[4];
+    for( int j=0 ; j<4 ; j++ ) {
+        int jloc = j+jpom2+1;
+        Vd[j] = abs( jloc + j_domain_begin + 0.5 )* invRd[jloc]*dr ;
+        invRd_local[j] = invRd[jloc]*dr;
+    }
+
+    int cell_nparts( ( int )iend-( int )istart );
+
+    for( int ivect=0 ; ivect < cell_nparts; ivect += vecSize ) {
+
+        int np_computed = min( cell_nparts-ivect, vecSize );
+
+        // Lanes of an incomplete block must not contribute
+        if( np_computed < vecSize ) {
+            #pragma omp simd
+            for( int j=0; j<bsize; j++ ) {
+                bJl_r[j] = 0.;
+                bJl_i[j] = 0.;
+                bJr_r[j] = 0.;
+                bJr_i[j] = 0.;
+                bJt_r[j] = 0.;
+                bJt_i[j] = 0.;
+                brho_r[j] = 0.;
+                brho_i[j] = 0.;
+            }
+        }
+
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+
+            int ip = ivect+ipart+istart;
+
+            // locate the particle on the primal grid at current time-step & calculate coeff. S1
+            //                            L                                 //
+            double pos = particles.position( 0, ip ) * dl_inv_;
+            int cell = round( pos );
+            int cell_shift = cell-ipo-i_domain_begin;
+            double delta  = pos - ( double )cell;
+            double delta2 = delta*delta;
+            double deltam =  0.5 * ( delta2-delta+0.25 );
+            double deltap =  0.5 * ( delta2+delta+0.25 );
+            delta2 = 0.75 - delta2;
+            double m1 = ( cell_shift == -1 );
+            double c0 = ( cell_shift ==  0 );
+            double p1 = ( cell_shift ==  1 );
+            Sl1_buff_vect[          ipart] = m1 * deltam                                                                                  ;
+            Sl1_buff_vect[  vecSize+ipart] = c0 * deltam + m1*delta2                                               ;
+            Sl1_buff_vect[2*vecSize+ipart] = p1 * deltam + c0*delta2 + m1*deltap;
+            Sl1_buff_vect[3*vecSize+ipart] =               p1*delta2 + c0*deltap;
+            Sl1_buff_vect[4*vecSize+ipart] =                           p1*deltap;
+            // locate the particle on the primal grid at former time-step & calculate coeff. S0
+            //                            L                                 //
+            delta = deltaold[ip-ipart_ref];
+            delta2 = delta*delta;
+            Sl0_buff_vect[          ipart] = 0;
+            Sl0_buff_vect[  vecSize+ipart] = 0.5 * ( delta2-delta+0.25 );
+            Sl0_buff_vect[2*vecSize+ipart] = 0.75-delta2;
+            Sl0_buff_vect[3*vecSize+ipart] = 0.5 * ( delta2+delta+0.25 );
+            Sl0_buff_vect[4*vecSize+ipart] = 0;
+            for( unsigned int i = 0; i < 5 ; i++ ) {
+                DSl[i*vecSize+ipart] = Sl1_buff_vect[ i*vecSize+ipart] - Sl0_buff_vect[ i*vecSize+ipart];
+            }
+            //                            R                                 //
+            double yp = particles.position( 1, ip );
+            double zp = particles.position( 2, ip );
+            double rp = sqrt( yp*yp + zp*zp );
+            pos = rp * dr_inv_;
+            cell = round( pos );
+            cell_shift = cell-jpo-j_domain_begin;
+            delta  = pos - ( double )cell;
+            delta2 = delta*delta;
+            deltam =  0.5 * ( delta2-delta+0.25 );
+            deltap =  0.5 * ( delta2+delta+0.25 );
+            delta2 = 0.75 - delta2;
+            m1 = ( cell_shift == -1 );
+            c0 = ( cell_shift ==  0 );
+            p1 = ( cell_shift ==  1 );
+            Sr1_buff_vect[          ipart] = m1 * deltam                                                                                  ;
+            Sr1_buff_vect[  vecSize+ipart] = c0 * deltam + m1*delta2                                               ;
+            Sr1_buff_vect[2*vecSize+ipart] = p1 * deltam + c0*delta2 + m1*deltap;
+            Sr1_buff_vect[3*vecSize+ipart] =               p1*delta2 + c0*deltap;
+            Sr1_buff_vect[4*vecSize+ipart] =                           p1*deltap;
+            //                            R                                 //
+            double deltar_old = deltaold[ip-ipart_ref+npart_total];
+            delta2 = deltar_old*deltar_old;
+            Sr0_buff_vect[          ipart] = 0;
+            Sr0_buff_vect[  vecSize+ipart] = 0.5 * ( delta2-deltar_old+0.25 );
+            Sr0_buff_vect[2*vecSize+ipart] = 0.75-delta2;
+            Sr0_buff_vect[3*vecSize+ipart] = 0.5 * ( delta2+deltar_old+0.25 );
+            Sr0_buff_vect[4*vecSize+ipart] = 0;
+
+            charge_weight[ipart] = inv_cell_volume * ( double )( particles.charge( ip ) )*particles.weight( ip );
+            double crl_p = charge_weight[ipart]*dl_ov_dt;
+            double crr_p = charge_weight[ipart]*one_ov_dt;
+
+            // Everything independent of theta
+            Jl_p[ipart] = 0.;
+            for( unsigned int i=1 ; i<5 ; i++ ) {
+                Jl_p[i*vecSize+ipart] = Jl_p[( i-1 )*vecSize+ipart] - DSl[( i-1 )*vecSize+ipart];
+            }
+            for( unsigned int j=0 ; j<5 ; j++ ) {
+                double DSr = Sr1_buff_vect[j*vecSize+ipart] - Sr0_buff_vect[j*vecSize+ipart];
+                tmpJl[j*vecSize+ipart] = crl_p * ( Sr0_buff_vect[j*vecSize+ipart] + 0.5*DSr )* invR_local[j];
+            }
+            Jr_p[4*vecSize+ipart] = 0.;
+            for( int j=3 ; j>=0 ; j-- ) {
+                double DSr = Sr1_buff_vect[( j+1 )*vecSize+ipart] - Sr0_buff_vect[( j+1 )*vecSize+ipart];
+                Jr_p[j*vecSize+ipart] = Jr_p[( j+1 )*vecSize+ipart] * Vd[j] + crr_p * DSr * invRd_local[j];
+            }
+
+            //Compute division by R in advance for Jt and rho evaluation.
+            for( unsigned int j=0 ; j<5 ; j++ ) {
+                Sr0_buff_vect[j*vecSize+ipart] *= invR_local[j];
+                Sr1_buff_vect[j*vecSize+ipart] *= invR_local[j];
+            }
+
+            // r and theta at t = t0 - dt/2
+            double theta_old = array_theta_old[ip-ipart_ref];
+            double dtheta = std::remainder( atan2( zp, yp )-theta_old, 2*M_PI )/2.; // Otherwise dtheta is overestimated when going from -pi to +pi
+            double theta_bar = theta_old+dtheta;
+            r_bar[ipart] = ( ( jpo + j_domain_begin )*dr + deltar_old + rp ) * 0.5;
+            e_delta_m1_r[ipart] = cos( dtheta );
+            e_delta_m1_i[ipart] = sin( dtheta );
+            e_bar_m1_r[ipart] = cos( theta_bar );
+            e_bar_m1_i[ipart] = sin( theta_bar );
+            e_delta_r[ipart] = 1.;
+            e_delta_i[ipart] = 0.;
+            e_bar_r[ipart] = 1.;
+            e_bar_i[ipart] = 0.;
+
+            //initial value of crt_p for imode = 0.
+            crt_p0[ipart] = charge_weight[ipart]*( particles.momentum( 2, ip )* e_bar_m1_r[ipart] - particles.momentum( 1, ip )*e_bar_m1_i[ipart] ) * ( *invgf )[ip-ipart_ref]*subcycle;
+        }
+
+        for( unsigned int imode=0; imode<Nmode; imode++ ) {
+
+            #pragma omp simd
+            for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+
+                // C_m = 1 for mode 0 and 2 exp(i m theta_bar) otherwise
+                double C_m_r, C_m_i, crt_p_r, crt_p_i;
+                // e_delta_inv = 1/e_delta - 1 and e_delta - 1, time centering of Jt
+                double e_delta_inv_r, e_delta_inv_i, e_delta_p_r, e_delta_p_i;
+                if( imode == 0 ) {
+                    C_m_r = 1.;
+                    C_m_i = 0.;
+                    crt_p_r = crt_p0[ipart];
+                    crt_p_i = 0.;
+                    e_delta_inv_r = 0.5;
+                    e_delta_inv_i = 0.;
+                    e_delta_p_r = 0.5;
+                    e_delta_p_i = 0.;
+                } else {
+                    double tmp = e_delta_r[ipart]*e_delta_m1_r[ipart] - e_delta_i[ipart]*e_delta_m1_i[ipart];
+                    e_delta_i[ipart] = e_delta_r[ipart]*e_delta_m1_i[ipart] + e_delta_i[ipart]*e_delta_m1_r[ipart];
+                    e_delta_r[ipart] = tmp;
+                    tmp = e_bar_r[ipart]*e_bar_m1_r[ipart] - e_bar_i[ipart]*e_bar_m1_i[ipart];
+                    e_bar_i[ipart] = e_bar_r[ipart]*e_bar_m1_i[ipart] + e_bar_i[ipart]*e_bar_m1_r[ipart];
+                    e_bar_r[ipart] = tmp;
+
+                    C_m_r = 2.*e_bar_r[ipart];
+                    C_m_i = 2.*e_bar_i[ipart];
+                    // |e_delta| = 1 so that 1/e_delta is its conjugate
+                    e_delta_inv_r =  e_delta_r[ipart] - 1.;
+                    e_delta_inv_i = -e_delta_i[ipart];
+                    e_delta_p_r = e_delta_r[ipart] - 1.;
+                    e_delta_p_i = e_delta_i[ipart];
+                    // charge_weight * i * e_bar / ( dt*m ) * 2 * r_bar
+                    tmp = charge_weight[ipart] * 2. * r_bar[ipart] / ( dt*( double )imode );
+                    crt_p_r = -tmp*e_bar_i[ipart];
+                    crt_p_i =  tmp*e_bar_r[ipart];
+                }
+
+                // Jl^(d,p)
+                for( unsigned int i=1 ; i<5 ; i++ ) {
+                    for( unsigned int j=0 ; j<5 ; j++ ) {
+                        double val = Jl_p[i*vecSize+ipart]*tmpJl[j*vecSize+ipart];
+                        bJl_r[( i*5+j )*vecSize+ipart] = C_m_r * val;
+                        bJl_i[( i*5+j )*vecSize+ipart] = C_m_i * val;
+                    }
+                }
+
+                // Jr^(p,d)
+                for( unsigned int i=0 ; i<5 ; i++ ) {
+                    double tmp = Sl0_buff_vect[i*vecSize+ipart] + 0.5*DSl[i*vecSize+ipart];
+                    for( unsigned int j=0 ; j<4 ; j++ ) {
+                        double val = tmp*Jr_p[j*vecSize+ipart];
+                        bJr_r[( i*5+j )*vecSize+ipart] = C_m_r * val;
+                        bJr_i[( i*5+j )*vecSize+ipart] = C_m_i * val;
+                    }
+                }
+
+                // Jt^(p,p)
+                for( unsigned int i=0 ; i<5 ; i++ ) {
+                    for( unsigned int j=0 ; j<5 ; j++ ) {
+                        double S1 = Sr1_buff_vect[j*vecSize+ipart]*Sl1_buff_vect[i*vecSize+ipart];
+                        double S0 = Sr0_buff_vect[j*vecSize+ipart]*Sl0_buff_vect[i*vecSize+ipart];
+                        double w_r = S1*e_delta_inv_r - S0*e_delta_p_r;
+                        double w_i = S1*e_delta_inv_i - S0*e_delta_p_i;
+                        bJt_r[( i*5+j )*vecSize+ipart] = crt_p_r*w_r - crt_p_i*w_i;
+                        bJt_i[( i*5+j )*vecSize+ipart] = crt_p_r*w_i + crt_p_i*w_r;
+                    }
+                }
+
+                // rho^(p,p)
+                if( diag_flag ) {
+                    for( unsigned int i=0 ; i<5 ; i++ ) {
+                        for( unsigned int j=0 ; j<5 ; j++ ) {
+                            double val = charge_weight[ipart]*Sl1_buff_vect[i*vecSize+ipart]*Sr1_buff_vect[j*vecSize+ipart];
+                            brho_r[( i*5+j )*vecSize+ipart] = C_m_r * val;
+                            brho_i[( i*5+j )*vecSize+ipart] = C_m_i * val;
+                        }
+                    }
+                }
+            }
+
+            // Reduction of the block on the grid of the current mode
+            complex<double> *Jl, *Jr, *Jt, *rho;
+            if( !diag_flag ) {
+                Jl =  &( *emAM->Jl_[imode] )( 0 );
+                Jr =  &( *emAM->Jr_[imode] )( 0 );
+                Jt =  &( *emAM->Jt_[imode] )( 0 );
+                rho = NULL;
+            } else {
+                unsigned int n_species = emAM->Jl_s.size() / Nmode;
+                unsigned int ifield = imode*n_species+ispec;
+                Jl  = emAM->Jl_s    [ifield] ? &( * ( emAM->Jl_s    [ifield] ) )( 0 ) : &( *emAM->Jl_    [imode] )( 0 ) ;
+                Jr  = emAM->Jr_s    [ifield] ? &( * ( emAM->Jr_s    [ifield] ) )( 0 ) : &( *emAM->Jr_    [imode] )( 0 ) ;
+                Jt  = emAM->Jt_s    [ifield] ? &( * ( emAM->Jt_s    [ifield] ) )( 0 ) : &( *emAM->Jt_    [imode] )( 0 ) ;
+                rho = emAM->rho_AM_s[ifield] ? &( * ( emAM->rho_AM_s[ifield] ) )( 0 ) : &( *emAM->rho_AM_[imode] )( 0 ) ;
+            }
+
+            int iloc0 = ipom2*nprimr+jpom2;
+            int iloc = iloc0;
+            for( unsigned int i=1 ; i<5 ; i++ ) {
+                iloc += nprimr;
+                for( unsigned int j=0 ; j<5 ; j++ ) {
+                    double tmp_r( 0. ), tmp_i( 0. );
+                    int ilocal = ( i*5+j )*vecSize;
+                    #pragma omp simd reduction(+:tmp_r,tmp_i)
+                    for( int ipart=0 ; ipart<8; ipart++ ) {
+                        tmp_r += bJl_r[ilocal+ipart];
+                        tmp_i += bJl_i[ilocal+ipart];
+                    }
+                    Jl[iloc+j] += complex<double>( tmp_r, tmp_i );
+                }
+            }
+
+            iloc = ipom2*( nprimr+1 )+jpom2+1;
+            for( unsigned int i=0 ; i<5 ; i++ ) {
+                for( unsigned int j=0 ; j<4 ; j++ ) {
+                    double tmp_r( 0. ), tmp_i( 0. );
+                    int ilocal = ( i*5+j )*vecSize;
+                    #pragma omp simd reduction(+:tmp_r,tmp_i)
+                    for( int ipart=0 ; ipart<8; ipart++ ) {
+                        tmp_r += bJr_r[ilocal+ipart];
+                        tmp_i += bJr_i[ilocal+ipart];
+                    }
+                    Jr[iloc+j] += complex<double>( tmp_r, tmp_i );
+                }
+                iloc += ( nprimr+1 );
+            }
+
+            iloc = iloc0;
+            for( unsigned int i=0 ; i<5 ; i++ ) {
+                for( unsigned int j=0 ; j<5 ; j++ ) {
+                    double tmp_r( 0. ), tmp_i( 0. );
+                    int ilocal = ( i*5+j )*vecSize;
+                    #pragma omp simd reduction(+:tmp_r,tmp_i)
+                    for( int ipart=0 ; ipart<8; ipart++ ) {
+                        tmp_r += bJt_r[ilocal+ipart];
+                        tmp_i += bJt_i[ilocal+ipart];
+                    }
+                    Jt[iloc+j] += complex<double>( tmp_r, tmp_i );
+                }
+                iloc += nprimr;
+            }
+
+            if( rho ) {
+                iloc = iloc0;
+                for( unsigned int i=0 ; i<5 ; i++ ) {
+                    for( unsigned int j=0 ; j<5 ; j++ ) {
+                        double tmp_r( 0. ), tmp_i( 0. );
+                        int ilocal = ( i*5+j )*vecSize;
+                        #pragma omp simd reduction(+:tmp_r,tmp_i)
+                        for( int ipart=0 ; ipart<8; ipart++ ) {
+                            tmp_r += brho_r[ilocal+ipart];
+                            tmp_i += brho_i[ilocal+ipart];
+                        }
+                        rho[iloc+j] += complex<double>( tmp_r, tmp_i );
+                    }
+                    iloc += nprimr;
+                }
+            }
+        } // end loop on modes
+    } // end loop on blocks
+
+} // END Project local current densities (Jl, Jr, Jt, sort)
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project for diags and frozen species -
+// ---------------------------------------------------------------------------------------------------------------------
+void ProjectorAM2OrderV::basicForComplex( complex<double> *rhoj, Particles &particles, unsigned int ipart, unsigned int type, int imode )
+{
+    //Warning : this function is not charge conserving.
+    // This function also assumes that particles position is evaluated at the same time as currents which is usually not true (half time-step difference).
+    // It will therefore fail to evaluate the current accurately at t=0 if a plasma is already in the box.
+   
+
+ 
+    // -------------------------------------
+    // Variable declaration & initialization
+    // -------------------------------------
+    
+    int iloc, nr( nprimr );
+    double charge_weight = inv_cell_volume * ( double )( particles.charge( ipart ) )*particles.weight( ipart );
+    double r = sqrt( particles.position( 1, ipart )*particles.position( 1, ipart )+particles.position( 2, ipart )*particles.position( 2, ipart ) );
+    
+    if( type > 0 ) { //if current density
+        charge_weight *= 1./sqrt( 1.0 + particles.momentum( 0, ipart )*particles.momentum( 0, ipart )
+                                  + particles.momentum( 1, ipart )*particles.momentum( 1, ipart )
+                                  + particles.momentum( 2, ipart )*particles.momentum( 2, ipart ) );
+        if( type == 1 ) { //if Jl
+            charge_weight *= particles.momentum( 0, ipart );
+        } else if( type == 2 ) { //if Jr
+            charge_weight *= ( particles.momentum( 1, ipart )*particles.position( 1, ipart ) + particles.momentum( 2, ipart )*particles.position( 2, ipart ) )/ r ;
+            nr++;
+        } else { //if Jt
+            charge_weight *= ( -particles.momentum( 1, ipart )*particles.position( 2, ipart ) + particles.momentum( 2, ipart )*particles.position( 1, ipart ) ) / r ;
+        }
+    }
+    
+    complex<double> e_theta = ( particles.position( 1, ipart ) + Icpx*particles.position( 2, ipart ) )/r;
+    complex<double> C_m = 1.;
+    if( imode > 0 ) {
+        C_m = 2.;
+    }
+    for( unsigned int i=0; i<( unsigned int )imode; i++ ) {
+        C_m *= e_theta;
+    }
+    
+    double xpn, ypn;
+    double delta, delta2;
+    double Sl1[5], Sr1[5];
+    
+    // --------------------------------------------------------
+    // Locate particles & Calculate Esirkepov coef. S, DS and W
+    // --------------------------------------------------------
+    
+    // locate the particle on the primal grid at current time-step & calculate coeff. S1
+    xpn = particles.position( 0, ipart ) * dl_inv_;
+    int ip = round( xpn + 0.5 * ( type==1 ) );
+    delta  = xpn - ( double )ip;
+    delta2 = delta*delta;
+    Sl1[1] = 0.5 * ( delta2-delta+0.25 );
+    Sl1[2] = 0.75-delta2;
+    Sl1[3] = 0.5 * ( delta2+delta+0.25 );
+    ypn = r * dr_inv_ ;
+    int jp = round( ypn + 0.5*( type==2 ) );
+    delta  = ypn - ( double )jp;
+    delta2 = delta*delta;
+    Sr1[1] = 0.5 * ( delta2-delta+0.25 );
+    Sr1[2] = 0.75-delta2;
+    Sr1[3] = 0.5 * ( delta2+delta+0.25 );
+    
+    // ---------------------------
+    // Calculate the total charge
+    // ---------------------------
+    ip -= i_domain_begin + 2;
+    jp -= j_domain_begin + 2;
+    
+    if( type != 2 ) {
+        for( unsigned int i=1 ; i<4 ; i++ ) {
+            iloc = ( i+ip )*nr+jp;
+            for( unsigned int j=1 ; j<4 ; j++ ) {
+                rhoj [iloc+j] += C_m*charge_weight* Sl1[i]*Sr1[j] * invR[j+jp];
+            }
+        }//i
+    } else {
+        for( unsigned int i=1 ; i<4 ; i++ ) {
+            iloc = ( i+ip )*nr+jp;
+            for( unsigned int j=1 ; j<4 ; j++ ) {
+                rhoj [iloc+j] += C_m*charge_weight* Sl1[i]*Sr1[j] * invRd[j+jp];
+            }
+        }//i
+    }
+} // END Project for diags local current densities
+
+// Apply boundary conditions on axis for currents and densities
+void ProjectorAM2OrderV::axisBC(ElectroMagnAM *emAM, bool diag_flag )
+{
+
+   for (unsigned int imode=0; imode < Nmode; imode++){ 
+       
+       std::complex<double> *rhoj = &( *emAM->rho_AM_[imode] )( 0 );
+       std::complex<double> *Jl = &( *emAM->Jl_[imode] )( 0 );
+       std::complex<double> *Jr = &( *emAM->Jr_[imode] )( 0 );
+       std::complex<double> *Jt = &( *emAM->Jt_[imode] )( 0 );
+
+       apply_axisBC(rhoj, Jl, Jr, Jt, imode, diag_flag);
+   }
+       
+   if (diag_flag){
+       unsigned int n_species = emAM->Jl_s.size() / Nmode;
+       for( unsigned int imode = 0 ; imode < emAM->Jl_.size() ; imode++ ) {
+           for( unsigned int ispec = 0 ; ispec < n_species ; ispec++ ) {
+               unsigned int ifield = imode*n_species+ispec;
+               complex<double> *Jl  = emAM->Jl_s    [ifield] ? &( * ( emAM->Jl_s    [ifield] ) )( 0 ) : NULL ;
+               complex<double> *Jr  = emAM->Jr_s    [ifield] ? &( * ( emAM->Jr_s    [ifield] ) )( 0 ) : NULL ;
+               complex<double> *Jt  = emAM->Jt_s    [ifield] ? &( * ( emAM->Jt_s    [ifield] ) )( 0 ) : NULL ;
+               complex<double> *rho = emAM->rho_AM_s[ifield] ? &( * ( emAM->rho_AM_s[ifield] ) )( 0 ) : NULL ;
+               apply_axisBC( rho , Jl, Jr, Jt, imode, diag_flag );
+           }
+       }
+   }
+}
+
+void ProjectorAM2OrderV::apply_axisBC(std::complex<double> *rhoj,std::complex<double> *Jl, std::complex<double> *Jr, std::complex<double> *Jt, unsigned int imode, bool diag_flag )
+{
+
+   double sign = -1.;
+   for (unsigned int i=0; i< imode; i++) sign *= -1;
+   
+   if (diag_flag && rhoj) {
+       for( unsigned int i=2 ; i<npriml*nprimr+2; i+=nprimr ) {
+           //Fold rho 
+           for( unsigned int j=1 ; j<3; j++ ) {
+               rhoj[i+j] += sign * rhoj[i-j];
+               rhoj[i-j]  = sign * rhoj[i+j];
+           }
+           //Apply BC
+           if (imode > 0){
+               rhoj[i] = 0.;
+           } else {
+               rhoj[i] = (4.*rhoj[i+1] - rhoj[i+2])/3.;
+           }
+       }
+   }
+               
+   if (Jl) {
+       for( unsigned int i=2 ; i<(npriml+1)*nprimr+2; i+=nprimr ) {
+           //Fold Jl
+           for( unsigned int j=1 ; j<3; j++ ) {
+               Jl [i+j] +=  sign * Jl[i-j];
+               Jl[i-j]   =  sign * Jl[i+j];
+            }
+            if (imode > 0){
+                Jl [i] = 0. ;
+           } else {
+                //Force dJl/dr = 0 at r=0.
+                Jl [i] =  (4.*Jl [i+1] - Jl [i+2])/3. ;
+           }
+       }
+   }
+
+   if (Jt && Jr) {
+       for( unsigned int i=0 ; i<npriml; i++ ) {
+           int iloc = i*nprimr+2;
+           int ilocr = i*(nprimr+1)+3;
+           //Fold Jt
+           for( unsigned int j=1 ; j<3; j++ ) {
+               Jt [iloc+j] += -sign * Jt[iloc-j];
+               Jt[iloc-j]   = -sign * Jt[iloc+j];
+           }
+           for( unsigned int j=0 ; j<3; j++ ) {
+               Jr [ilocr+2-j] += -sign * Jr [ilocr-3+j];
+               Jr[ilocr-3+j]     = -sign * Jr[ilocr+2-j];
+           }
+
+           if (imode == 1){
+               Jt [iloc]= -Icpx/8.*( 9.*Jr[ilocr]- Jr[ilocr+1]);
+               //Force dJr/dr = 0 at r=0.
+               //Jr [ilocr] =  (25.*Jr[ilocr+1] - 9*Jr[ilocr+2])/16. ;
+               Jr [ilocr-1] = 2.*Icpx*Jt[iloc] - Jr [ilocr];
+           } else{
+               Jt [iloc] = 0. ;
+               //Force dJr/dr = 0 and Jr=0 at r=0.
+               //Jr [ilocr] =  Jr [ilocr+1]/9.;
+               Jr [ilocr-1] = -Jr [ilocr];
+           }
+       }
+   }
+   return;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project global current densities : ionization NOT DONE YET
+// ---------------------------------------------------------------------------------------------------------------------
+void ProjectorAM2OrderV::ionizationCurrents( Field *Jl, Field *Jr, Field *Jt, Particles &particles, int ipart, LocalFields Jion )
+{
+    return;
+} // END Project global current densities (ionize)
+
+//------------------------------------//
+//Wrapper for projection
+void ProjectorAM2OrderV::currentsAndDensityWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int icell, int ipart_ref )
+{
+    if( istart == iend ) {
+        return;    //Don't treat empty cells.
+    }
+
+    std::vector<double> *delta = &( smpi->dynamics_deltaold[ithread] );
+    std::vector<double> *invgf = &( smpi->dynamics_invgf[ithread] );
+    std::vector<double> *array_theta_old = &( smpi->dynamics_thetaold[ithread] );
+    ElectroMagnAM *emAM = static_cast<ElectroMagnAM *>( EMfields );
+
+    int iold[2];
+    iold[0] = icell/nscellr+oversize[0];
+    iold[1] = ( icell%nscellr )+oversize[1];
+
+    currents( emAM, particles, istart, iend, invgf, iold, &( *delta )[0], &( *array_theta_old )[0], diag_flag, ispec, ipart_ref );
+}
@@ -0,0 +1,39 @@
+#ifndef PROJECTORAM2ORDERV_H
+#define PROJECTORAM2ORDERV_H
+
+#include <complex>
+
+#include "ProjectorAM.h"
+#include "ElectroMagnAM.h"
+
+
+class ProjectorAM2OrderV : public ProjectorAM
+{
+public:
+    ProjectorAM2OrderV( Params &, Patch *patch );
+    ~ProjectorAM2OrderV();
+
+    //! Project local current densities of all the particles of a cell, for all modes (and charge if diag_flag)
+    void currents( ElectroMagnAM *emAM, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, double *array_theta_old, bool diag_flag, int ispec, int ipart_ref = 0 );
+
+    //! Project global current charge (EMfields->rho_), frozen & diagFields timestep
+    void basicForComplex( std::complex<double> *rhoj, Particles &particles, unsigned int ipart, unsigned int type, int imode ) override final;
+
+    //! Apply boundary conditions on Rho and J
+    void axisBC( ElectroMagnAM *emAM, bool diag_flag ) override final;
+    void apply_axisBC( std::complex<double> *rhoj, std::complex<double> *Jl, std::complex<double> *Jr, std::complex<double> *Jt, unsigned int imode, bool diag_flag );
+
+    //! Project global current densities if Ionization in Species::dynamics,
+    void ionizationCurrents( Field *Jl, Field *Jr, Field *Jt, Particles &particles, int ipart, LocalFields Jion ) override final;
+
+    //!Wrapper
+    void currentsAndDensityWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int icell = 0, int ipart_ref = 0 ) override final;
+
+private:
+    //! Number of cells of the particle sorting in r
+    int nscellr;
+    int oversize[2];
+};
+
+#endif
+
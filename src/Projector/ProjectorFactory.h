@@ -13,9 +13,12 @@
 #include "ProjectorAM1Order.h"
 
 #ifdef _VECTO
+#include "Projector1D2OrderV.h"
 #include "Projector2D2OrderV.h"
+#include "Projector2D4OrderV.h"
 #include "Projector3D2OrderV.h"
 #include "Projector3D4OrderV.h"
+#include "ProjectorAM2OrderV.h"
 #endif
 
 #include "Params.h"
@@ -33,7 +36,14 @@ public:
         // 1Dcartesian simulation
         // ---------------
         if( ( params.geometry == "1Dcartesian" ) && ( params.interpolation_order == ( unsigned int )2 ) ) {
-            Proj = new Projector1D2Order( params, patch );
+            if( !vectorization || params.Laser_Envelope_model ) {
+                Proj = new Projector1D2Order( params, patch );
+            }
+#ifdef _VECTO
+            else {
+                Proj = new Projector1D2OrderV( params, patch );
+            }
+#endif
         } else if( ( params.geometry == "1Dcartesian" ) && ( params.interpolation_order == ( unsigned int )4 ) ) {
             Proj = new Projector1D4Order( params, patch );
         }
@@ -50,7 +60,14 @@ public:
             }
 #endif
         } else if( ( params.geometry == "2Dcartesian" ) && ( params.interpolation_order == ( unsigned int )4 ) ) {
-            Proj = new Projector2D4Order( params, patch );
+            if( !vectorization ) {
+                Proj = new Projector2D4Order( params, patch );
+            }
+#ifdef _VECTO
+            else {
+                Proj = new Projector2D4OrderV( params, patch );
+            }
+#endif
         }
         // ---------------
         // 3Dcartesian simulation
@@ -79,9 +96,16 @@ public:
         // AM simulation
         // ---------------
         else if( params.geometry == "AMcylindrical" ) {
-            if (params.is_spectral){
+            if( params.is_spectral ) {
                 Proj = new ProjectorAM1Order( params, patch );
-            } else {
+            }
+#ifdef _VECTO
+            // The envelope model keeps the scalar operators
+            else if( vectorization && !params.Laser_Envelope_model ) {
+                Proj = new ProjectorAM2OrderV( params, patch );
+            }
+#endif
+            else {
                 Proj = new ProjectorAM2Order( params, patch );
             }
         } else {
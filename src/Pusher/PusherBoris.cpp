@@ -30,6 +30,20 @@ void PusherBoris::operator()( Particles &particles, SmileiMPI *smpi, int istart,
     
     std::vector<double> *Epart = &( smpi->dynamics_Epart[ithread] );
     std::vector<double> *Bpart = &( smpi->dynamics_Bpart[ithread] );
+    
+    int nparts;
+    if (vecto) {
+        nparts = Epart->size()/3;
+    } else {
+        nparts = particles.size();
+    }
+    pushWithFields( particles, smpi, istart, iend, ithread, ipart_buffer_offset, &( *Epart )[0], &( *Bpart )[0], nparts, ipart_buffer_offset );
+}
+
+// E and B of the particle ipart read from Ebuffer[k*nbuffer+ipart-ibuffer_ref] and Bbuffer
+void PusherBoris::pushWithFields( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset,
+                                  double *Ebuffer, double *Bbuffer, int nbuffer, int ibuffer_ref )
+{
     double *invgf = &( smpi->dynamics_invgf[ithread][0] );
 
     double pxsm, pysm, pzsm;
@@ -56,18 +70,12 @@ void PusherBoris::operator()( Particles &particles, SmileiMPI *smpi, int istart,
     
     short *charge = particles.getPtrCharge();
     
-    int nparts;
-    if (vecto) {
-        nparts = Epart->size()/3;
-    } else {
-        nparts = particles.size();
-    }
-    double *Ex = &( ( *Epart )[0*nparts] );
-    double *Ey = &( ( *Epart )[1*nparts] );
-    double *Ez = &( ( *Epart )[2*nparts] );
-    double *Bx = &( ( *Bpart )[0*nparts] );
-    double *By = &( ( *Bpart )[1*nparts] );
-    double *Bz = &( ( *Bpart )[2*nparts] );
+    double *Ex = &( Ebuffer[0*nbuffer] );
+    double *Ey = &( Ebuffer[1*nbuffer] );
+    double *Ez = &( Ebuffer[2*nbuffer] );
+    double *Bx = &( Bbuffer[0*nbuffer] );
+    double *By = &( Bbuffer[1*nbuffer] );
+    double *Bz = &( Bbuffer[2*nbuffer] );
 
     #pragma omp simd
     for( int ipart=istart ; ipart<iend; ipart++ ) {
@@ -75,9 +83,9 @@ void PusherBoris::operator()( Particles &particles, SmileiMPI *smpi, int istart,
         charge_over_mass_dts2 = ( double )( charge[ipart] )*one_over_mass_*dts2;
         
         // init Half-acceleration in the electric field
-        pxsm = charge_over_mass_dts2*( *( Ex+ipart-ipart_buffer_offset ) );
-        pysm = charge_over_mass_dts2*( *( Ey+ipart-ipart_buffer_offset ) );
-        pzsm = charge_over_mass_dts2*( *( Ez+ipart-ipart_buffer_offset ) );
+        pxsm = charge_over_mass_dts2*( *( Ex+ipart-ibuffer_ref ) );
+        pysm = charge_over_mass_dts2*( *( Ey+ipart-ibuffer_ref ) );
+        pzsm = charge_over_mass_dts2*( *( Ez+ipart-ibuffer_ref ) );
         
         //(*this)(particles, ipart, (*Epart)[ipart], (*Bpart)[ipart] , (*invgf)[ipart]);
         umx = momentum_x[ipart] + pxsm;
@@ -86,9 +94,9 @@ void PusherBoris::operator()( Particles &particles, SmileiMPI *smpi, int istart,
     
         // Rotation in the magnetic field
         local_invgf = charge_over_mass_dts2 / sqrt( 1.0 + umx*umx + umy*umy + umz*umz );
-        Tx    = local_invgf * ( *( Bx+ipart-ipart_buffer_offset ) );
-        Ty    = local_invgf * ( *( By+ipart-ipart_buffer_offset ) );
-        Tz    = local_invgf * ( *( Bz+ipart-ipart_buffer_offset ) );
+        Tx    = local_invgf * ( *( Bx+ipart-ibuffer_ref ) );
+        Ty    = local_invgf * ( *( By+ipart-ibuffer_ref ) );
+        Tz    = local_invgf * ( *( Bz+ipart-ibuffer_ref ) );
         inv_det_T = 1.0/( 1.0+Tx*Tx+Ty*Ty+Tz*Tz );
         
         pxsm += ( ( 1.0+Tx*Tx-Ty*Ty-Tz*Tz )* umx  +      2.0*( Tx*Ty+Tz )* umy  +      2.0*( Tz*Tx-Ty )* umz )*inv_det_T;
@@ -21,6 +21,9 @@ public:
     ~PusherBoris();
     //! Overloading of () operator
     virtual void operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset = 0 );
+    //! Same as operator(), with E and B of the particle ipart read from Ebuffer[k*nbuffer+ipart-ibuffer_ref] and Bbuffer
+    void pushWithFields( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset,
+                         double *Ebuffer, double *Bbuffer, int nbuffer, int ibuffer_ref );
     
 };
 
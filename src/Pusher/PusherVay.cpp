@@ -35,6 +35,20 @@ void PusherVay::operator()( Particles &particles, SmileiMPI *smpi, int istart, i
 {
     std::vector<double> *Epart = &( smpi->dynamics_Epart[ithread] );
     std::vector<double> *Bpart = &( smpi->dynamics_Bpart[ithread] );
+    
+    int nparts;
+    if (vecto) {
+        nparts = Epart->size()/3;
+    } else {
+        nparts = particles.size();
+    }
+    pushWithFields( particles, smpi, istart, iend, ithread, ipart_buffer_offset, &( *Epart )[0], &( *Bpart )[0], nparts, ipart_buffer_offset );
+}
+
+// E and B of the particle ipart read from Ebuffer[k*nbuffer+ipart-ibuffer_ref] and Bbuffer
+void PusherVay::pushWithFields( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset,
+                                double *Ebuffer, double *Bbuffer, int nbuffer, int ibuffer_ref )
+{
     double *invgf = &( smpi->dynamics_invgf[ithread][0] );
     
     double charge_over_mass_dts2;
@@ -58,18 +72,12 @@ void PusherVay::operator()( Particles &particles, SmileiMPI *smpi, int istart, i
 
     short *charge = particles.getPtrCharge();
     
-    int nparts;
-    if (vecto) {
-        nparts = Epart->size()/3;
-    } else {
-        nparts = particles.size();
-    }
-    double *Ex = &( ( *Epart )[0*nparts] );
-    double *Ey = &( ( *Epart )[1*nparts] );
-    double *Ez = &( ( *Epart )[2*nparts] );
-    double *Bx = &( ( *Bpart )[0*nparts] );
-    double *By = &( ( *Bpart )[1*nparts] );
-    double *Bz = &( ( *Bpart )[2*nparts] );
+    double *Ex = &( Ebuffer[0*nbuffer] );
+    double *Ey = &( Ebuffer[1*nbuffer] );
+    double *Ez = &( Ebuffer[2*nbuffer] );
+    double *Bx = &( Bbuffer[0*nbuffer] );
+    double *By = &( Bbuffer[1*nbuffer] );
+    double *Bz = &( Bbuffer[2*nbuffer] );
     
     #pragma omp simd private(s,us2,alpha,upx,upy,upz,Tx,Ty,Tz,pxsm,pysm,pzsm)
     for( int ipart=istart ; ipart<iend; ipart++ ) {
@@ -84,14 +92,14 @@ void PusherVay::operator()( Particles &particles, SmileiMPI *smpi, int istart, i
                                      + momentum_z[ipart]*momentum_z[ipart] );
                                      
         // Add Electric field
-        upx = momentum_x[ipart] + 2.*charge_over_mass_dts2*( *( Ex+ipart-ipart_buffer_offset ) );
-        upy = momentum_y[ipart] + 2.*charge_over_mass_dts2*( *( Ey+ipart-ipart_buffer_offset ) );
-        upz = momentum_z[ipart] + 2.*charge_over_mass_dts2*( *( Ez+ipart-ipart_buffer_offset ) );
+        upx = momentum_x[ipart] + 2.*charge_over_mass_dts2*( *( Ex+ipart-ibuffer_ref ) );
+        upy = momentum_y[ipart] + 2.*charge_over_mass_dts2*( *( Ey+ipart-ibuffer_ref ) );
+        upz = momentum_z[ipart] + 2.*charge_over_mass_dts2*( *( Ez+ipart-ibuffer_ref ) );
         
         // Add magnetic field
-        Tx  = charge_over_mass_dts2* ( *( Bx+ipart-ipart_buffer_offset ) );
-        Ty  = charge_over_mass_dts2* ( *( By+ipart-ipart_buffer_offset ) );
-        Tz  = charge_over_mass_dts2* ( *( Bz+ipart-ipart_buffer_offset ) );
+        Tx  = charge_over_mass_dts2* ( *( Bx+ipart-ibuffer_ref ) );
+        Ty  = charge_over_mass_dts2* ( *( By+ipart-ibuffer_ref ) );
+        Tz  = charge_over_mass_dts2* ( *( Bz+ipart-ibuffer_ref ) );
         
         upx += invgf [ipart-ipart_buffer_offset]*( momentum_y[ipart]*Tz - momentum_z[ipart]*Ty );
         upy += invgf [ipart-ipart_buffer_offset]*( momentum_z[ipart]*Tx - momentum_x[ipart]*Tz );
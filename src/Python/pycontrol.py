@@ -56,7 +56,11 @@ def _smilei_check():
                 pattern += "*"+ os.sep
             pattern += "dump-*-*.h5"
             # pick those file that match the mpi rank
-            files = filter(lambda a: smilei_mpi_rank==int(search(r'dump-[0-9]*-([0-9]*).h5$',a).groups()[-1]), glob(pattern))
+            all_files = glob(pattern)
+            files = list(filter(lambda a: smilei_mpi_rank==int(search(r'dump-[0-9]*-([0-9]*).h5$',a).groups()[-1]), all_files))
+            # if the dump was made with less ranks, use those of rank 0 (patches are redistributed)
+            if len(files) == 0:
+                files = filter(lambda a: 0==int(search(r'dump-[0-9]*-([0-9]*).h5$',a).groups()[-1]), all_files)
             
             if Checkpoints.restart_number is not None:
                 # pick those file that match the restart_number
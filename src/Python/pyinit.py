@@ -2,7 +2,7 @@
     GENERAL DEFINITIONS FOR SMILEI
 """
 
-import math, os, gc, operator
+import math, os, gc, operator, numbers
 
 def _add_metaclass(metaclass):
     """Class decorator for creating a class with a metaclass."""
@@ -174,6 +174,12 @@ class Main(SmileiSingleton):
     number_of_AM_relativistic_field_initialization = 1
     timestep_over_CFL = None
     cell_sorting = False
+    task_scheduling = False
+    halo_exchange = "patch"
+    persistent_communications = False
+    collisions_threading = "patches"
+    reproducible_collisions = False
+    native_profiles = True
 
     # PXR tuning
     spectral_solver_order = []
@@ -188,9 +194,12 @@ class Main(SmileiSingleton):
     solve_relativistic_poisson = False
     relativistic_poisson_max_iteration = 50000
     relativistic_poisson_max_error = 1.e-22
+    poisson_solver = "cg"
+    poisson_preconditioner = "none"
 
     # Default fields
     maxwell_solver = 'Yee'
+    fused_maxwell_solver = False
     EM_boundary_conditions = [["periodic"]]
     EM_boundary_conditions_k = []
     save_magnectic_fields_for_SM = True
@@ -279,6 +288,8 @@ class LoadBalancing(SmileiSingleton):
     initial_balance      = True
     cell_load            = 1.0
     frozen_particle_load = 0.1
+    load_model           = "particles"
+    load_smoothing       = 0.
 
 class MultipleDecomposition(SmileiSingleton):
     """Multiple Decomposition parameters"""
@@ -314,6 +325,7 @@ class Checkpoints(SmileiSingleton):
     dump_deflate = 0
     exit_after_dump = True
     file_grouping = 0
+    asynchronous = False
     restart_files = []
 
 class CurrentFilter(SmileiSingleton):
@@ -368,6 +380,7 @@ class Species(SmileiComponent):
     merge_min_momentum = 1e-5
 
     time_frozen = 0.0
+    subcycle = 1
     radiating = False
     relativistic_field_initialization = False
     boundary_conditions = [["periodic"]]
@@ -429,6 +442,7 @@ class Collisions(SmileiComponent):
     coulomb_log = 0.
     coulomb_log_factor = 1.
     debug_every = 0
+    batch_size = 0
     ionizing = False
     nuclear_reaction = None
     nuclear_reaction_multiplier = 0.
@@ -495,6 +509,7 @@ class DiagFields(SmileiComponent):
     time_average = 1
     subgrid = None
     flush_every = 1
+    aggregators = 0
 
 class DiagTrackParticles(SmileiComponent):
     """Track diagnostic"""
@@ -503,6 +518,7 @@ class DiagTrackParticles(SmileiComponent):
     every = 0
     flush_every = 1
     filter = None
+    native_filter = True
     attributes = ["x", "y", "z", "px", "py", "pz", "w"]
 
 class DiagPerformances(SmileiSingleton):
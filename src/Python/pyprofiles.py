@@ -769,3 +769,366 @@ except:
         )
         print("WARNING: LaserOffset unavailable because numpy was not found")
 
+
+
+"""
+    NATIVE TRANSLATION OF PYTHON PROFILES
+    
+    A python profile is called once with symbolic arguments (_NativeExpr), which record
+    the operations applied to them as a postfix program of [opcode, operand] pairs.
+    The program is evaluated in C++ (see Function_Native). Profiles which cannot be
+    recorded (e.g. with if/else on the arguments, loops, or unknown functions) are not translated.
+"""
+
+# Must match the enum NativeOpcode in Function.h
+_native_opcodes = {
+    "const":0, "var":1,
+    "add":2, "sub":3, "mul":4, "div":5, "pow":6, "mod":7, "neg":8,
+    "lt":9, "le":10, "gt":11, "ge":12, "eq":13, "ne":14,
+    "and":15, "or":16, "not":17, "where":18,
+    "min":19, "max":20, "atan2":21,
+    "exp":22, "log":23, "log10":24, "sqrt":25, "sin":26, "cos":27, "tan":28,
+    "asin":29, "acos":30, "atan":31, "sinh":32, "cosh":33, "tanh":34,
+    "abs":35, "floor":36, "ceil":37,
+}
+_native_max_stack = 64
+
+class _NativeUnsupported(Exception):
+    pass
+
+class _NativeExpr(object):
+    """Symbolic value recording the operations applied to the arguments of a profile"""
+    __array_priority__ = 1000
+    
+    def __init__(self, program, boolean=False):
+        self.program = program
+        self.boolean = boolean # True for the results of comparisons and logical operators
+    
+    @staticmethod
+    def _make(x):
+        if isinstance(x, _NativeExpr):
+            return x
+        if isinstance(x, numbers.Real):
+            return _NativeExpr([[_native_opcodes["const"], float(x)]])
+        raise _NativeUnsupported()
+    
+    @staticmethod
+    def _op(name, *args):
+        program = []
+        for a in args:
+            program += _NativeExpr._make(a).program
+        return _NativeExpr(program + [[_native_opcodes[name], 0.]], name in _NativeExpr._boolean_ops)
+    _boolean_ops = ["lt", "le", "gt", "ge", "eq", "ne", "and", "or", "not"]
+    
+    # The operators &, | and ~ are bitwise on integers: only translated between booleans
+    @staticmethod
+    def _bitwise(name, *args):
+        for a in args:
+            if not (isinstance(a, bool) or (isinstance(a, _NativeExpr) and a.boolean)):
+                raise _NativeUnsupported()
+        return _NativeExpr._op(name, *args)
+    
+    def __add__(self, o): return _NativeExpr._op("add", self, o)
+    def __radd__(self, o): return _NativeExpr._op("add", o, self)
+    def __sub__(self, o): return _NativeExpr._op("sub", self, o)
+    def __rsub__(self, o): return _NativeExpr._op("sub", o, self)
+    def __mul__(self, o): return _NativeExpr._op("mul", self, o)
+    def __rmul__(self, o): return _NativeExpr._op("mul", o, self)
+    def __truediv__(self, o): return _NativeExpr._op("div", self, o)
+    def __rtruediv__(self, o): return _NativeExpr._op("div", o, self)
+    __div__ = __truediv__
+    __rdiv__ = __rtruediv__
+    def __pow__(self, o): return _NativeExpr._op("pow", self, o)
+    def __rpow__(self, o): return _NativeExpr._op("pow", o, self)
+    def __mod__(self, o): return _NativeExpr._op("mod", self, o)
+    def __rmod__(self, o): return _NativeExpr._op("mod", o, self)
+    def __neg__(self): return _NativeExpr._op("neg", self)
+    def __pos__(self): return self
+    def __abs__(self): return _NativeExpr._op("abs", self)
+    def __lt__(self, o): return _NativeExpr._op("lt", self, o)
+    def __le__(self, o): return _NativeExpr._op("le", self, o)
+    def __gt__(self, o): return _NativeExpr._op("gt", self, o)
+    def __ge__(self, o): return _NativeExpr._op("ge", self, o)
+    def __eq__(self, o): return _NativeExpr._op("eq", self, o)
+    def __ne__(self, o): return _NativeExpr._op("ne", self, o)
+    def __and__(self, o): return _NativeExpr._bitwise("and", self, o)
+    def __rand__(self, o): return _NativeExpr._bitwise("and", o, self)
+    def __or__(self, o): return _NativeExpr._bitwise("or", self, o)
+    def __ror__(self, o): return _NativeExpr._bitwise("or", o, self)
+    def __invert__(self): return _NativeExpr._bitwise("not", self)
+    __hash__ = None
+    
+    # Branching on the value of an argument cannot be recorded
+    def __bool__(self): raise _NativeUnsupported()
+    __nonzero__ = __bool__
+    def __float__(self): raise _NativeUnsupported()
+    def __int__(self): raise _NativeUnsupported()
+    def __index__(self): raise _NativeUnsupported()
+    def __complex__(self): raise _NativeUnsupported()
+    
+    # numpy functions
+    _ufuncs = {
+        "add":"add", "subtract":"sub", "multiply":"mul", "true_divide":"div", "divide":"div",
+        "power":"pow", "remainder":"mod", "mod":"mod", "negative":"neg",
+        "less":"lt", "less_equal":"le", "greater":"gt", "greater_equal":"ge", "equal":"eq", "not_equal":"ne",
+        "logical_and":"and", "logical_or":"or", "logical_not":"not",
+        "minimum":"min", "maximum":"max", "fmin":"min", "fmax":"max", "arctan2":"atan2",
+        "exp":"exp", "log":"log", "log10":"log10", "sqrt":"sqrt", "sin":"sin", "cos":"cos", "tan":"tan",
+        "arcsin":"asin", "arccos":"acos", "arctan":"atan", "sinh":"sinh", "cosh":"cosh", "tanh":"tanh",
+        "absolute":"abs", "fabs":"abs", "floor":"floor", "ceil":"ceil",
+    }
+    def __array_ufunc__(self, ufunc, method, *inputs, **kwargs):
+        if method != "__call__" or kwargs or ufunc.__name__ not in _NativeExpr._ufuncs:
+            raise _NativeUnsupported()
+        return _NativeExpr._op(_NativeExpr._ufuncs[ufunc.__name__], *inputs)
+    def __array_function__(self, func, types, args, kwargs):
+        if func.__name__ == "where" and len(args) == 3 and not kwargs:
+            return _NativeExpr._op("where", *args)
+        raise _NativeUnsupported()
+
+class _native_math(object):
+    """Replaces the module math while recording a profile"""
+    pi = math.pi
+    e = math.e
+    inf = float("inf")
+    exp   = staticmethod(lambda x: _NativeExpr._op("exp", x))
+    log   = staticmethod(lambda x: _NativeExpr._op("log", x))
+    log10 = staticmethod(lambda x: _NativeExpr._op("log10", x))
+    sqrt  = staticmethod(lambda x: _NativeExpr._op("sqrt", x))
+    sin   = staticmethod(lambda x: _NativeExpr._op("sin", x))
+    cos   = staticmethod(lambda x: _NativeExpr._op("cos", x))
+    tan   = staticmethod(lambda x: _NativeExpr._op("tan", x))
+    asin  = staticmethod(lambda x: _NativeExpr._op("asin", x))
+    acos  = staticmethod(lambda x: _NativeExpr._op("acos", x))
+    atan  = staticmethod(lambda x: _NativeExpr._op("atan", x))
+    sinh  = staticmethod(lambda x: _NativeExpr._op("sinh", x))
+    cosh  = staticmethod(lambda x: _NativeExpr._op("cosh", x))
+    tanh  = staticmethod(lambda x: _NativeExpr._op("tanh", x))
+    fabs  = staticmethod(lambda x: _NativeExpr._op("abs", x))
+    floor = staticmethod(lambda x: _NativeExpr._op("floor", x))
+    ceil  = staticmethod(lambda x: _NativeExpr._op("ceil", x))
+    pow   = staticmethod(lambda x, y: _NativeExpr._op("pow", x, y))
+    fmod  = None # C fmod differs from python modulo
+    atan2 = staticmethod(lambda y, x: _NativeExpr._op("atan2", y, x))
+
+def _native_substitute(value, memo):
+    """Copy of a function in which the module math is replaced by _native_math"""
+    import types
+    if value is math:
+        return _native_math
+    if isinstance(value, types.BuiltinFunctionType):
+        if getattr(value, "__module__", None) == "math" and getattr(_native_math, value.__name__, None) is not None:
+            return getattr(_native_math, value.__name__)
+        return value
+    if not isinstance(value, types.FunctionType) or hasattr(value, "profileName"):
+        return value
+    if id(value) in memo:
+        return memo[id(value)]
+    g = memo.get(id(value.__globals__))
+    if g is None:
+        g = {}
+        memo[id(value.__globals__)] = g
+        memo[id(value)] = value # placeholder while the globals are copied
+        for k, v in value.__globals__.items():
+            g[k] = _native_substitute(v, memo)
+    closure = None
+    if value.__closure__:
+        closure = tuple( (lambda v: (lambda: v).__closure__[0])(_native_substitute(c.cell_contents, memo)) for c in value.__closure__ )
+    f = types.FunctionType(value.__code__, g, value.__name__, value.__defaults__, closure)
+    memo[id(value)] = f
+    return f
+
+def _native_evaluate(program, args):
+    """Evaluates the program in python, the same way as Function_Native"""
+    op = dict((v,k) for k,v in _native_opcodes.items())
+    s = []
+    unary = {"neg":lambda a:-a, "not":lambda a:float(a==0.), "exp":math.exp, "log":math.log, "log10":math.log10,
+        "sqrt":math.sqrt, "sin":math.sin, "cos":math.cos, "tan":math.tan, "asin":math.asin, "acos":math.acos,
+        "atan":math.atan, "sinh":math.sinh, "cosh":math.cosh, "tanh":math.tanh, "abs":abs,
+        "floor":lambda a:float(math.floor(a)), "ceil":lambda a:float(math.ceil(a))}
+    binary = {"add":operator.add, "sub":operator.sub, "mul":operator.mul, "div":operator.truediv, "pow":math.pow,
+        "mod":operator.mod, "lt":lambda a,b:float(a<b), "le":lambda a,b:float(a<=b), "gt":lambda a,b:float(a>b),
+        "ge":lambda a,b:float(a>=b), "eq":lambda a,b:float(a==b), "ne":lambda a,b:float(a!=b),
+        "and":lambda a,b:float(a!=0. and b!=0.), "or":lambda a,b:float(a!=0. or b!=0.),
+        "min":min, "max":max, "atan2":math.atan2}
+    for code, value in program:
+        name = op[code]
+        if name == "const":
+            s.append(value)
+        elif name == "var":
+            s.append(args[int(value)])
+        elif name == "where":
+            b = s.pop(); a = s.pop(); c = s.pop()
+            s.append(a if c!=0. else b)
+        elif name in unary:
+            s.append(unary[name](s.pop()))
+        else:
+            b = s.pop(); a = s.pop()
+            s.append(binary[name](a, b))
+    return s[0]
+
+def _native_stack_depth(program):
+    """Maximum depth of the stack used by Function_Native to evaluate the program"""
+    binary = [_native_opcodes[k] for k in ("add","sub","mul","div","pow","mod","lt","le","gt","ge","eq","ne","and","or","min","max","atan2")]
+    depth = 0; max_depth = 0
+    for code, value in program:
+        if code in (_native_opcodes["const"], _native_opcodes["var"]):
+            depth += 1
+        elif code in binary:
+            depth -= 1
+        elif code == _native_opcodes["where"]:
+            depth -= 2
+        max_depth = max(max_depth, depth)
+    return max_depth
+
+def _native_profile(f, nvariables):
+    """Translates the profile f into a flat list [opcode0, operand0, opcode1, operand1, ...], or None"""
+    if not Main.native_profiles:
+        return None
+    try:
+        g = _native_substitute(f, {})
+        result = _NativeExpr._make(g(*[_NativeExpr([[_native_opcodes["var"], float(i)]]) for i in range(nvariables)]))
+    except Exception:
+        return None
+    program = result.program
+    if _native_stack_depth(program) > _native_max_stack:
+        return None
+    # Verify that the program gives the same values as the function at some points
+    points = [0., 0.37, 1.9, 7.3, 31.1, 213.7, 1013.3]
+    verified = 0
+    for i in range(len(points)):
+        x = [points[(i+3*j)%len(points)] for j in range(nvariables)]
+        try:
+            expected = f(*x)
+        except Exception:
+            continue
+        if isinstance(expected, complex) or getattr(expected, "imag", 0.) != 0.:
+            return None
+        expected = float(expected)
+        try:
+            value = _native_evaluate(program, x)
+        except (ZeroDivisionError, ValueError, OverflowError):
+            continue
+        if not (value == expected or abs(value-expected) <= 1e-12*max(abs(value),abs(expected))) \
+            and not (value != value and expected != expected):
+            return None
+        verified += 1
+    if verified == 0:
+        return None
+    return [v for p in program for v in p]
+
+
+"""
+    NATIVE TRANSLATION OF DiagTrackParticles FILTERS
+    
+    The filter is called once with a symbolic particle object, whose attributes are the
+    variables below (must match the enum NativeFilterVariable in DiagnosticTrack.h).
+    Main.iteration is also replaced by a variable during the recording.
+"""
+
+_native_filter_variables = ["x", "y", "z", "px", "py", "pz", "weight", "charge", "id_hash", "chi", "iteration"]
+
+class _NativeId(object):
+    """Symbolic particle ids: only usable through id_hash, as they do not fit in a double"""
+    __array_ufunc__ = None
+    def __eq__(self, o): raise _NativeUnsupported()
+    def __ne__(self, o): raise _NativeUnsupported()
+    def __bool__(self): raise _NativeUnsupported()
+    __nonzero__ = __bool__
+    __hash__ = None
+
+def id_hash(id):
+    """Number in [0,1) computed from the particle ids (splitmix64), for a deterministic subsampling"""
+    if isinstance(id, _NativeId):
+        return _NativeExpr([[_native_opcodes["var"], float(_native_filter_variables.index("id_hash"))]])
+    if isinstance(id, _NativeExpr):
+        raise _NativeUnsupported()
+    import numpy as np
+    with np.errstate(over="ignore"):
+        z = np.asarray(id, dtype=np.uint64) + np.uint64(0x9E3779B97F4A7C15)
+        z = (z ^ (z >> np.uint64(30))) * np.uint64(0xBF58476D1CE4E5B9)
+        z = (z ^ (z >> np.uint64(27))) * np.uint64(0x94D049BB133111EB)
+        z = z ^ (z >> np.uint64(31))
+    return (z >> np.uint64(11)).astype(np.float64) * 2.**-53
+
+def _filter_uses_id_hash(f, visited=None):
+    """True if the filter f, or a function that it calls, refers to id_hash: the particles then need ids before filtering"""
+    code = getattr(f, "__code__", None)
+    if code is None:
+        return False
+    if visited is None:
+        visited = set()
+    if code in visited:
+        return False
+    visited.add(code)
+    codes = [code]
+    while codes:
+        c = codes.pop()
+        if "id_hash" in c.co_names:
+            return True
+        codes += [k for k in c.co_consts if isinstance(k, type(code))]
+    # Functions called through global names or closures
+    called = [getattr(f, "__globals__", {}).get(name) for name in code.co_names]
+    called += [cell.cell_contents for cell in (getattr(f, "__closure__", None) or [])]
+    return any(_filter_uses_id_hash(g, visited) for g in called if callable(g))
+
+def _native_filter(f, nDim_particle, has_chi):
+    """Translates the DiagTrackParticles filter f into a flat list [opcode0, operand0, ...], or None"""
+    import numpy as np
+    # Attributes available in the filter
+    names = ["x", "y", "z"][:nDim_particle] + ["px", "py", "pz", "weight", "charge"] + (["chi"] if has_chi else [])
+    var = lambda name: _NativeExpr([[_native_opcodes["var"], float(_native_filter_variables.index(name))]])
+    # Record the filter
+    particles = ParticleData()
+    for name in names:
+        setattr(particles, name, var(name))
+    particles.id = _NativeId()
+    iteration = getattr(Main, "iteration", 0)
+    try:
+        Main.iteration = var("iteration")
+        g = _native_substitute(f, {})
+        result = _NativeExpr._make(g(particles))
+    except Exception:
+        return None
+    finally:
+        Main.iteration = iteration
+    program = result.program
+    if _native_stack_depth(program) > _native_max_stack:
+        return None
+    # Verify that the program selects the same particles as the filter, on test particles
+    values = [0., 0.37, -1.9, 7.3, -31.1, 213.7, 1013.3, -0.6, 2.5, -4.2, 0.05, 57.]
+    n = len(values)
+    test = {}
+    for i, name in enumerate(names):
+        test[name] = np.array([values[(k+3*i)%n] for k in range(n)])
+    test["charge"] = np.array([-1, 1, 2, -1, 0, 3, -2, 1, 1, -1, 2, 0], dtype=np.short)
+    test["id"] = np.array([0, 1, 2, 3, 6, 10, 16, 32, 256, 4096, 4294967301, 12884901888], dtype=np.uint64)
+    if has_chi:
+        test["chi"] = np.abs(test["chi"])
+    particles = ParticleData()
+    for name in names + ["id"]:
+        setattr(particles, name, test[name])
+    try:
+        expected = np.asarray(f(particles))
+    except Exception:
+        return None
+    if expected.shape != (n,):
+        return None
+    hashes = id_hash(test["id"])
+    verified = 0
+    for k in range(n):
+        args = [0.] * len(_native_filter_variables)
+        for name in names:
+            args[_native_filter_variables.index(name)] = float(test[name][k])
+        args[_native_filter_variables.index("id_hash")] = float(hashes[k])
+        args[_native_filter_variables.index("iteration")] = float(iteration)
+        try:
+            value = _native_evaluate(program, args)
+        except (ZeroDivisionError, ValueError, OverflowError):
+            continue
+        if (value != 0.) != bool(expected[k]):
+            return None
+        verified += 1
+    if verified == 0:
+        return None
+    return [v for p in program for v in p]
@@ -34,6 +34,7 @@ Radiation::Radiation( Params &params, Species *species, Random * rand )
 
     // Pointer to the local patch random generator
     rand_ = rand;
+    rand_stream_ = Random::stream( species->species_number_, Random::radiation );
 
     // Dimension for particles
     nDim_          = params.nDim_particle;
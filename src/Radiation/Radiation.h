@@ -113,6 +113,9 @@ protected:
 
     Random * rand_;
 
+    //! Stream of the counter-based random numbers (species, process)
+    uint32_t rand_stream_;
+
     // _________________________________________
     // Factors
 
@@ -102,6 +102,9 @@ void RadiationMonteCarlo::operator()(
     // Number of Monte-Carlo iteration
     int mc_it_nb;
 
+    // Number of counter-based random numbers drawn by the particle
+    uint32_t draw;
+
     // Momentum shortcut
     double* momentum_x = particles.getPtrMomentum(0);
     double* momentum_y = particles.getPtrMomentum(1);
@@ -140,6 +143,7 @@ void RadiationMonteCarlo::operator()(
         emission_time = 0;
         local_it_time = 0;
         mc_it_nb = 0;
+        draw = 0;
 
         // Monte-Carlo Manager inside the time step
         while( ( local_it_time < dt_ )
@@ -172,8 +176,7 @@ void RadiationMonteCarlo::operator()(
                     && ( tau[ipart] <= epsilon_tau_ ) ) {
                 // New final optical depth to reach for emision
                 while( tau[ipart] <= epsilon_tau_ ) {
-                    //tau[ipart] = -log( 1.-Rand::uniform() );
-                    tau[ipart] = -log( 1.-rand_->uniform() );
+                    tau[ipart] = -log( rand_->uniform( rand_stream_, draw++, ipart ) );
                 }
 
             }
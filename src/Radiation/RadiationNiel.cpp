@@ -160,21 +160,11 @@ void RadiationNiel::operator()(
     }*/
 
     // Vectorized computation of the random number in a uniform distribution
-    // #pragma omp simd
+    // (counter-based generator, so that all particles draw at once)
+    rand_->uniforms( &random_numbers[0], nbparticles, rand_stream_, 0, istart );
+    #pragma omp simd
     for( ipart=0 ; ipart < nbparticles; ipart++ ) {
-
-        // Below particle_chi = minimum_chi_continuous_, radiation losses are negligible
-        if( particle_chi[ipart+istart] > minimum_chi_continuous_ ) {
-
-            // Pick a random number in the normal distribution of standard
-            // deviation sqrt(dt_) (variance dt_)
-            //random_numbers[ipart] = 2.*Rand::uniform() -1.;
-            //random_numbers[ipart] = 2.*drand48() -1.;
-            random_numbers[ipart] = 2.*rand_->uniform() -1.;
-        }
-        // else {
-        //     random_numbers[ipart] = 0;
-        // }
+        random_numbers[ipart] = 2.*random_numbers[ipart] -1.;
     }
 
     // Vectorized computation of the random number in a normal distribution
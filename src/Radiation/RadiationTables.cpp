@@ -186,6 +186,15 @@ void RadiationTables::initialization( Params &params , SmileiMPI *smpi )
         } else {
             MESSAGE(1,"Default tables (stored in the code) are used:");
         }
+
+        // A single copy of the tables per node, in shared memory
+        if( params.hasNielRadiation ) {
+            niel_.table_.share( smpi );
+        }
+        if( params.hasMCRadiation ) {
+            integfochi_.table_.share( smpi );
+            xi_.table_.share( smpi );
+        }
     }
 
     if( params.hasMCRadiation ) {
@@ -603,8 +612,9 @@ void RadiationTables::readHTable( SmileiMPI *smpi )
             h.attr( "max_particle_chi", niel_.max_particle_chi_ );
 
             // Resize and read array
-            niel_.table_.resize( niel_.size_particle_chi_ );
-            f.vect( "h", niel_.table_ );
+            std::vector<double> table( niel_.size_particle_chi_ );
+            f.vect( "h", table );
+            niel_.table_ = table;
         }
     } else {
         ERROR("The table H could not be read from the provided path: `"
@@ -618,7 +628,7 @@ void RadiationTables::readHTable( SmileiMPI *smpi )
                << "the radiation threshold on chi." )
     }
 
-    // Bcast the table to all MPI ranks
+    // Bcast the table parameters to all MPI ranks
     RadiationTables::bcastHTable( smpi );
 }
 
@@ -641,11 +651,12 @@ void RadiationTables::readIntegfochiTable( SmileiMPI *smpi )
             c.attr( "max_particle_chi", integfochi_.max_particle_chi_ );
 
             // Resize and read array
-            integfochi_.table_.resize( integfochi_.size_particle_chi_ );
-            f.vect( "integfochi", integfochi_.table_ );
+            std::vector<double> table( integfochi_.size_particle_chi_ );
+            f.vect( "integfochi", table );
+            integfochi_.table_ = table;
         }
 
-        // Bcast the table to all MPI ranks
+        // Bcast the table parameters to all MPI ranks
         RadiationTables::bcastIntegfochiTable( smpi );
     }
     // Else, the table can not be found, we throw an error
@@ -677,12 +688,13 @@ void RadiationTables::readXiTable( SmileiMPI *smpi )
 
             // Allocate and read arrays
             xi_.min_photon_chi_table_.resize( xi_.size_particle_chi_ );
-            xi_.table_.resize( xi_.size_particle_chi_*xi_.size_photon_chi_ );
+            std::vector<double> table( xi_.size_particle_chi_*xi_.size_photon_chi_ );
             f.vect( "min_photon_chi_for_xi", xi_.min_photon_chi_table_ );
-            f.vect( "xi", xi_.table_ );
+            f.vect( "xi", table );
+            xi_.table_ = table;
         }
 
-        // Bcast the table to all MPI ranks
+        // Bcast the table parameters to all MPI ranks
         RadiationTables::bcastTableXi( smpi );
 
     }
@@ -739,9 +751,6 @@ void RadiationTables::bcastHTable( SmileiMPI *smpi )
         buf_size = position;
         MPI_Pack_size( 2, MPI_DOUBLE, smpi->world(), &position );
         buf_size += position;
-        MPI_Pack_size( niel_.size_particle_chi_, MPI_DOUBLE, smpi->world(),
-                       &position );
-        buf_size += position;
     }
 
     //MESSAGE( 2,"Buffer size: " << buf_size );
@@ -762,9 +771,6 @@ void RadiationTables::bcastHTable( SmileiMPI *smpi )
         MPI_Pack( &niel_.max_particle_chi_,
                   1, MPI_DOUBLE, buffer, buf_size, &position, smpi->world() );
 
-        MPI_Pack( &niel_.table_[0], niel_.size_particle_chi_,
-                  MPI_DOUBLE, buffer, buf_size, &position, smpi->world() );
-
     }
 
     // Bcast all parameters
@@ -780,12 +786,6 @@ void RadiationTables::bcastHTable( SmileiMPI *smpi )
         MPI_Unpack( buffer, buf_size, &position,
                     &niel_.max_particle_chi_, 1, MPI_DOUBLE, smpi->world() );
 
-        // Resize table before unpacking values
-        niel_.table_.resize( niel_.size_particle_chi_ );
-
-        MPI_Unpack( buffer, buf_size, &position, &niel_.table_[0],
-                    niel_.size_particle_chi_, MPI_DOUBLE, smpi->world() );
-
     }
 
     delete[] buffer;
@@ -823,9 +823,6 @@ void RadiationTables::bcastIntegfochiTable( SmileiMPI *smpi )
         buf_size = position;
         MPI_Pack_size( 2, MPI_DOUBLE, smpi->world(), &position );
         buf_size += position;
-        MPI_Pack_size( integfochi_.size_particle_chi_, MPI_DOUBLE, smpi->world(),
-                       &position );
-        buf_size += position;
     }
 
     //MESSAGE( 2,"Buffer size: " << buf_size );
@@ -846,9 +843,6 @@ void RadiationTables::bcastIntegfochiTable( SmileiMPI *smpi )
         MPI_Pack( &integfochi_.max_particle_chi_,
                   1, MPI_DOUBLE, buffer, buf_size, &position, smpi->world() );
 
-        MPI_Pack( &integfochi_.table_[0], integfochi_.size_particle_chi_,
-                  MPI_DOUBLE, buffer, buf_size, &position, smpi->world() );
-
     }
 
     // Bcast all parameters
@@ -864,12 +858,6 @@ void RadiationTables::bcastIntegfochiTable( SmileiMPI *smpi )
         MPI_Unpack( buffer, buf_size, &position,
                     &integfochi_.max_particle_chi_, 1, MPI_DOUBLE, smpi->world() );
 
-        // Resize table before unpacking values
-        integfochi_.table_.resize( integfochi_.size_particle_chi_ );
-
-        MPI_Unpack( buffer, buf_size, &position, &integfochi_.table_[0],
-                    integfochi_.size_particle_chi_, MPI_DOUBLE, smpi->world() );
-
     }
 
     delete[] buffer;
@@ -936,9 +924,6 @@ void RadiationTables::bcastTableXi( SmileiMPI *smpi )
         MPI_Pack_size( xi_.size_particle_chi_, MPI_DOUBLE, smpi->world(),
                        &position );
         buf_size += position;
-        MPI_Pack_size( xi_.size_particle_chi_*xi_.size_photon_chi_, MPI_DOUBLE,
-                       smpi->world(), &position );
-        buf_size += position;
     }
 
     //MESSAGE( 2,"Buffer size for MPI exchange: " << buf_size );
@@ -963,9 +948,6 @@ void RadiationTables::bcastTableXi( SmileiMPI *smpi )
 
         MPI_Pack( &xi_.min_photon_chi_table_[0], xi_.size_particle_chi_,
                   MPI_DOUBLE, buffer, buf_size, &position, smpi->world() );
-
-        MPI_Pack( &xi_.table_[0], xi_.size_particle_chi_*xi_.size_photon_chi_,
-                  MPI_DOUBLE, buffer, buf_size, &position, smpi->world() );
     }
 
     // Bcast all parameters
@@ -983,16 +965,12 @@ void RadiationTables::bcastTableXi( SmileiMPI *smpi )
         MPI_Unpack( buffer, buf_size, &position,
                     &xi_.max_particle_chi_, 1, MPI_DOUBLE, smpi->world() );
 
-        // Resize tables before unpacking values
+        // Resize table before unpacking values
         xi_.min_photon_chi_table_.resize( xi_.size_particle_chi_ );
-        xi_.table_.resize( xi_.size_particle_chi_*xi_.size_photon_chi_ );
 
         MPI_Unpack( buffer, buf_size, &position, &xi_.min_photon_chi_table_[0],
                     xi_.size_particle_chi_, MPI_DOUBLE, smpi->world() );
 
-        MPI_Unpack( buffer, buf_size, &position, &xi_.table_[0],
-                    xi_.size_particle_chi_*xi_.size_photon_chi_, MPI_DOUBLE, smpi->world() );
-
     }
 
     delete[] buffer;
@@ -24,6 +24,7 @@
 #include "RadiationTools.h"
 #include "H5.h"
 #include "Random.h"
+#include "NodeSharedArray.h"
 
 //------------------------------------------------------------------------------
 //! RadiationTables class: holds parameters, tables and functions to compute
@@ -187,7 +188,7 @@ public:
 
         //! Array containing tabulated values of the function h for the
         //! stochastic diffusive operator of Niel et al.
-        std::vector<double > table_;
+        NodeSharedArray table_;
 
         //! Minimum boundary of the table h
         double min_particle_chi_;
@@ -228,7 +229,7 @@ public:
         //! (which is also the optical depth for the Monte-Carlo process).
         //! This table is the integration of the Synchrotron emissivity
         //! refers to as F over the quantum parameter Chi.
-        std::vector<double > table_;
+        NodeSharedArray table_;
 
         //! Minimum boundary of the table integfochi_table
         double min_particle_chi_;
@@ -260,7 +261,7 @@ public:
 
         //! Table containing the cumulative distribution function \f$P(0 \rightarrow \chi_{\gamma})\f$
         //! that gives gives the probability for a photon emission in the range \f$[0, \chi_{\gamma}]\f$
-        std::vector<double> table_ ;
+        NodeSharedArray table_;
 
         //! Table containing the photon_chi min values
         //! Under this value, photon energy is
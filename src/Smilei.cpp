@@ -136,7 +136,7 @@ int main( int argc, char *argv[] )
     // reading from dumped file the restart values
     if( params.restart ) {
         // smpi.patch_count recomputed in readPatchDistribution
-        checkpoint.readPatchDistribution( &smpi, simWindow );
+        checkpoint.readPatchDistribution( &smpi, simWindow, params );
         // allocate patches according to smpi.patch_count
         PatchesFactory::createVector( vecPatches, params, &smpi, openPMD, &radiation_tables_, checkpoint.this_run_start_step+1, simWindow->getNmoved() );
         
@@ -625,6 +625,9 @@ int main( int argc, char *argv[] )
         
     }//END of the time loop
     
+    // Wait for the last checkpoint to be written (asynchronous mode)
+    checkpoint.waitDump();
+    
     smpi.barrier();
 
     // ------------------------------------------------------------------
@@ -681,7 +684,7 @@ int executeTestMode( VectorPatch &vecPatches,
     int moving_window_movement = 0;
 
     if( params.restart ) {
-        checkpoint.readPatchDistribution( smpi, simWindow );
+        checkpoint.readPatchDistribution( smpi, simWindow, params );
         itime = checkpoint.this_run_start_step+1;
         moving_window_movement = simWindow->getNmoved();
     }
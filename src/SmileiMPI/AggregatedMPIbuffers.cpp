@@ -0,0 +1,190 @@
+#include "AggregatedMPIbuffers.h"
+#include "Field.h"
+#include "Patch.h"
+#include "VectorPatch.h"
+
+#include <algorithm>
+#include <cstring>
+using namespace std;
+
+AggregatedMPIbuffers::AggregatedMPIbuffers() :
+    comm_( MPI_COMM_NULL ),
+    tag_( 0 ),
+    persistent_( false )
+{
+}
+
+
+AggregatedMPIbuffers::~AggregatedMPIbuffers()
+{
+    clear();
+}
+
+
+void AggregatedMPIbuffers::clear()
+{
+    for( unsigned int irank=0 ; irank<spersistent_size_.size() ; irank++ ) {
+        if( spersistent_size_[irank] ) {
+            MPI_Request_free( &srequests_[irank] );
+        }
+        if( rpersistent_size_[irank] ) {
+            MPI_Request_free( &rrequests_[irank] );
+        }
+    }
+    spersistent_size_.clear();
+    rpersistent_size_.clear();
+    ranks_.clear();
+    send_segments_.clear();
+    recv_segments_.clear();
+    send_buffers_.clear();
+    recv_buffers_.clear();
+    srequests_.clear();
+    rrequests_.clear();
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Build the plan
+//   Both sides of a rank pair must pack the sub-fields in the same order : they are sorted
+//   by the hindex of the sending patch, the side toward which it sends, then the component.
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::build( vector<Field *> &fields, vector<int> &idx, unsigned int ncomp, VectorPatch &vecPatches, int iDim, MPI_Comm comm, int tag, bool persistent )
+{
+    clear();
+    comm_ = comm;
+    tag_  = tag;
+    persistent_ = persistent;
+
+    struct Entry {
+        int rank;
+        unsigned int hindex;
+        int side;
+        unsigned int icomp;
+        Segment segment;
+        bool operator<( const Entry &e ) const
+        {
+            if( rank   != e.rank ) return rank   < e.rank;
+            if( hindex != e.hindex ) return hindex < e.hindex;
+            if( side   != e.side ) return side   < e.side;
+            return icomp < e.icomp;
+        }
+    };
+    vector<Entry> sends, recvs;
+
+    unsigned int nfields = idx.size();
+    for( unsigned int ifield=0 ; ifield<nfields ; ifield++ ) {
+        Patch *patch = vecPatches( idx[ifield] );
+        for( int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++ ) {
+            if( !patch->is_a_MPI_neighbor( iDim, iNeighbor ) ) {
+                continue;
+            }
+            for( unsigned int icomp=0 ; icomp<ncomp ; icomp++ ) {
+                Field *field = fields[ifield+icomp*nfields];
+                // Sent toward iNeighbor from sendFields_[iDim*2+iNeighbor]
+                Entry s = { patch->MPI_neighbor_[iDim][iNeighbor], patch->hindex, iNeighbor, icomp, { field, ( unsigned int )( iDim*2+iNeighbor ) } };
+                sends.push_back( s );
+                // Received from iNeighbor in recvFields_[iDim*2+iNeighbor], sent by the neighbor toward the opposite side
+                Entry r = { patch->MPI_neighbor_[iDim][iNeighbor], ( unsigned int ) patch->neighbor_[iDim][iNeighbor], ( iNeighbor+1 )%2, icomp, { field, ( unsigned int )( iDim*2+iNeighbor ) } };
+                recvs.push_back( r );
+            }
+        }
+    }
+    sort( sends.begin(), sends.end() );
+    sort( recvs.begin(), recvs.end() );
+
+    // Both lists contain the same ranks (patch neighborhood is symmetric)
+    for( unsigned int i=0 ; i<sends.size() ; i++ ) {
+        if( ranks_.empty() || ranks_.back() != sends[i].rank ) {
+            ranks_.push_back( sends[i].rank );
+            send_segments_.resize( ranks_.size() );
+        }
+        send_segments_.back().push_back( sends[i].segment );
+    }
+    recv_segments_.resize( ranks_.size() );
+    unsigned int irank = 0;
+    for( unsigned int i=0 ; i<recvs.size() ; i++ ) {
+        while( ranks_[irank] != recvs[i].rank ) {
+            irank++;
+        }
+        recv_segments_[irank].push_back( recvs[i].segment );
+    }
+
+    send_buffers_.resize( ranks_.size() );
+    recv_buffers_.resize( ranks_.size() );
+    srequests_.resize( ranks_.size() );
+    rrequests_.resize( ranks_.size() );
+    spersistent_size_.resize( ranks_.size(), 0 );
+    rpersistent_size_.resize( ranks_.size(), 0 );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Pack and send
+//   Sub-fields sizes are read at each exchange : the ghost sizes are set by the caller (create_sub_fields)
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::init( unsigned int irank )
+{
+    vector<Segment> &ssegments = send_segments_[irank];
+    unsigned int size = 0;
+    for( unsigned int i=0 ; i<ssegments.size() ; i++ ) {
+        size += ssegments[i].field->sendFields_[ssegments[i].isub]->globalDims_;
+    }
+    send_buffers_[irank].resize( size );
+    double *buffer = send_buffers_[irank].data();
+    for( unsigned int i=0 ; i<ssegments.size() ; i++ ) {
+        Field *sub = ssegments[i].field->sendFields_[ssegments[i].isub];
+        memcpy( buffer, sub->data_, sub->globalDims_*sizeof( double ) );
+        buffer += sub->globalDims_;
+    }
+
+    vector<Segment> &rsegments = recv_segments_[irank];
+    size = 0;
+    for( unsigned int i=0 ; i<rsegments.size() ; i++ ) {
+        size += rsegments[i].field->recvFields_[rsegments[i].isub]->globalDims_;
+    }
+    recv_buffers_[irank].resize( size );
+
+    if( !persistent_ ) {
+        MPI_Irecv( recv_buffers_[irank].data(), recv_buffers_[irank].size(), MPI_DOUBLE, ranks_[irank], tag_, comm_, &rrequests_[irank] );
+        MPI_Isend( send_buffers_[irank].data(), send_buffers_[irank].size(), MPI_DOUBLE, ranks_[irank], tag_, comm_, &srequests_[irank] );
+        return;
+    }
+
+    // Persistent requests are bound to the buffers : created once, unless the sub-fields are resized
+    if( rpersistent_size_[irank] != recv_buffers_[irank].size() ) {
+        if( rpersistent_size_[irank] ) {
+            MPI_Request_free( &rrequests_[irank] );
+        }
+        MPI_Recv_init( recv_buffers_[irank].data(), recv_buffers_[irank].size(), MPI_DOUBLE, ranks_[irank], tag_, comm_, &rrequests_[irank] );
+        rpersistent_size_[irank] = recv_buffers_[irank].size();
+    }
+    if( spersistent_size_[irank] != send_buffers_[irank].size() ) {
+        if( spersistent_size_[irank] ) {
+            MPI_Request_free( &srequests_[irank] );
+        }
+        MPI_Send_init( send_buffers_[irank].data(), send_buffers_[irank].size(), MPI_DOUBLE, ranks_[irank], tag_, comm_, &srequests_[irank] );
+        spersistent_size_[irank] = send_buffers_[irank].size();
+    }
+    MPI_Start( &rrequests_[irank] );
+    MPI_Start( &srequests_[irank] );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Wait and unpack
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::finalize( unsigned int irank )
+{
+    MPI_Status status;
+    MPI_Wait( &rrequests_[irank], &status );
+
+    vector<Segment> &rsegments = recv_segments_[irank];
+    double *buffer = recv_buffers_[irank].data();
+    for( unsigned int i=0 ; i<rsegments.size() ; i++ ) {
+        Field *sub = rsegments[i].field->recvFields_[rsegments[i].isub];
+        memcpy( sub->data_, buffer, sub->globalDims_*sizeof( double ) );
+        buffer += sub->globalDims_;
+    }
+
+    MPI_Wait( &srequests_[irank], &status );
+}
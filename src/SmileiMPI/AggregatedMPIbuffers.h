@@ -0,0 +1,63 @@
+#ifndef AGGREGATEDMPIBUFFERS_H
+#define AGGREGATEDMPIBUFFERS_H
+
+#include <mpi.h>
+#include <vector>
+
+class Field;
+class VectorPatch;
+
+//! Halo exchange of a list of fields along one direction, aggregated per neighbouring MPI rank
+//!   - the ghost regions (sendFields_/recvFields_ of the fields) of all patches exchanged with
+//!     a given rank are packed in a single contiguous buffer, sent in a single message
+//!   - the plan (which sub-field goes where in which buffer) is built in VectorPatch::updateFieldList,
+//!     i.e. once per decomposition (after load balancing or a moving window shift)
+//!   - optionally, the messages go through persistent requests, freed with the plan
+class AggregatedMPIbuffers
+{
+public:
+    AggregatedMPIbuffers();
+    ~AggregatedMPIbuffers();
+
+    //! Build the plan for fields[ifield+icomp*idx.size()] (icomp<ncomp), owned by patch idx[ifield], along iDim
+    void build( std::vector<Field *> &fields, std::vector<int> &idx, unsigned int ncomp, VectorPatch &vecPatches, int iDim, MPI_Comm comm, int tag, bool persistent );
+
+    //! Forget the plan (and free the persistent requests)
+    void clear();
+
+    //! Number of neighbouring ranks
+    inline unsigned int size()
+    {
+        return ranks_.size();
+    }
+
+    //! Pack the sub-fields sent to the irank-th neighbouring rank, then Isend/Irecv
+    void init( unsigned int irank );
+
+    //! Wait the messages exchanged with the irank-th neighbouring rank, then unpack in the recvFields_
+    void finalize( unsigned int irank );
+
+private:
+    //! A sub-field of a field: sendFields_ or recvFields_[isub]
+    struct Segment {
+        Field *field;
+        unsigned int isub;
+    };
+
+    //! Communicator and tag of the messages
+    MPI_Comm comm_;
+    int tag_;
+    bool persistent_;
+
+    //! Neighbouring ranks
+    std::vector<int> ranks_;
+    //! Ordered sub-fields packed in the buffers, per neighbouring rank
+    std::vector< std::vector<Segment> > send_segments_, recv_segments_;
+    //! Contiguous buffers, per neighbouring rank
+    std::vector< std::vector<double> > send_buffers_, recv_buffers_;
+    std::vector<MPI_Request> srequests_, rrequests_;
+    //! Size of the buffers bound to the persistent requests (0 if none)
+    std::vector<unsigned int> spersistent_size_, rpersistent_size_;
+};
+
+#endif
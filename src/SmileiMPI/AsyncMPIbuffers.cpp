@@ -13,6 +13,7 @@ AsyncMPIbuffers::AsyncMPIbuffers()
 
 AsyncMPIbuffers::~AsyncMPIbuffers()
 {
+    freePersistent();
 }
 
 
@@ -31,10 +32,17 @@ void AsyncMPIbuffers::allocate( unsigned int ndims )
         send_tags_[iDim].resize( 2, MPI_PROC_NULL );
         recv_tags_[iDim].resize( 2, MPI_PROC_NULL );
     }
+    
+    PersistentBuffer none = { NULL, 0, MPI_PROC_NULL, 0 };
+    spersistent_.resize( ndims, vector<PersistentBuffer>( 2, none ) );
+    rpersistent_.resize( ndims, vector<PersistentBuffer>( 2, none ) );
 }
 
 void AsyncMPIbuffers::defineTags( Patch *patch, SmileiMPI *smpi, int tag )
 {
+    // Tags and neighbours are redefined : persistent requests are obsolete
+    freePersistent();
+    
     for( unsigned int iDim=0 ; iDim< send_tags_.size() ; iDim++ )
         for( int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++ ) {
         
@@ -59,6 +67,58 @@ void AsyncMPIbuffers::defineTags( Patch *patch, SmileiMPI *smpi, int tag )
 }
 
 
+void AsyncMPIbuffers::startPersistentSend( int iDim, int iNeighbor, double *data, int size, int dest, int tag )
+{
+    PersistentBuffer &bound = spersistent_[iDim][iNeighbor];
+    if( bound.data != data || bound.size != size || bound.rank != dest || bound.tag != tag ) {
+        if( bound.data ) {
+            MPI_Request_free( &( srequest[iDim][iNeighbor] ) );
+        }
+        MPI_Send_init( data, size, MPI_DOUBLE, dest, tag, MPI_COMM_WORLD, &( srequest[iDim][iNeighbor] ) );
+        bound.data = data;
+        bound.size = size;
+        bound.rank = dest;
+        bound.tag  = tag;
+    }
+    MPI_Start( &( srequest[iDim][iNeighbor] ) );
+}
+
+
+void AsyncMPIbuffers::startPersistentRecv( int iDim, int iNeighbor, double *data, int size, int source, int tag )
+{
+    PersistentBuffer &bound = rpersistent_[iDim][iNeighbor];
+    if( bound.data != data || bound.size != size || bound.rank != source || bound.tag != tag ) {
+        if( bound.data ) {
+            MPI_Request_free( &( rrequest[iDim][iNeighbor] ) );
+        }
+        MPI_Recv_init( data, size, MPI_DOUBLE, source, tag, MPI_COMM_WORLD, &( rrequest[iDim][iNeighbor] ) );
+        bound.data = data;
+        bound.size = size;
+        bound.rank = source;
+        bound.tag  = tag;
+    }
+    MPI_Start( &( rrequest[iDim][iNeighbor] ) );
+}
+
+
+// Requests are inactive here (completed by finalizeExchange/finalizeSumField)
+void AsyncMPIbuffers::freePersistent()
+{
+    for( unsigned int iDim=0 ; iDim<spersistent_.size() ; iDim++ ) {
+        for( int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++ ) {
+            if( spersistent_[iDim][iNeighbor].data ) {
+                MPI_Request_free( &( srequest[iDim][iNeighbor] ) );
+                spersistent_[iDim][iNeighbor].data = NULL;
+            }
+            if( rpersistent_[iDim][iNeighbor].data ) {
+                MPI_Request_free( &( rrequest[iDim][iNeighbor] ) );
+                rpersistent_[iDim][iNeighbor].data = NULL;
+            }
+        }
+    }
+}
+
+
 SpeciesMPIbuffers::SpeciesMPIbuffers()
 {
 }
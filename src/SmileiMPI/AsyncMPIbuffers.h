@@ -21,6 +21,13 @@ public:
     
     void defineTags( Patch *patch, SmileiMPI *smpi, int tag ) ;
     
+    //! Start srequest[iDim][iNeighbor] as a persistent send of data, created at first use or if data, dest or tag changed
+    void startPersistentSend( int iDim, int iNeighbor, double *data, int size, int dest, int tag );
+    //! Start rrequest[iDim][iNeighbor] as a persistent receive in data, created at first use or if data, source or tag changed
+    void startPersistentRecv( int iDim, int iNeighbor, double *data, int size, int source, int tag );
+    //! Free the persistent requests (neighbours and tags are redefined)
+    void freePersistent();
+    
     //! ndim vectors of 2 sent requests (1 per direction)
     std::vector< std::vector<MPI_Request> > srequest;
     //! ndim vectors of 2 received requests (1 per direction)
@@ -30,6 +37,17 @@ public:
     
     std::vector< std::vector<int> > send_tags_, recv_tags_;
     
+private:
+    //! Buffer bound to a persistent request (data==NULL if the request is not persistent)
+    struct PersistentBuffer {
+        double *data;
+        int size;
+        //! Destination (send) or source (receive) rank, and tag, of the request
+        int rank;
+        int tag;
+    };
+    std::vector< std::vector<PersistentBuffer> > spersistent_, rpersistent_;
+    
 };
 
 class SpeciesMPIbuffers : public AsyncMPIbuffers
@@ -0,0 +1,75 @@
+
+#include "NodeSharedArray.h"
+#include "SmileiMPI.h"
+
+#include <cstring>
+
+NodeSharedArray::NodeSharedArray() :
+    data_( NULL ),
+    size_( 0 ),
+    window_( MPI_WIN_NULL )
+{
+}
+
+
+NodeSharedArray::~NodeSharedArray()
+{
+    int finalized;
+    MPI_Finalized( &finalized );
+    if( window_ != MPI_WIN_NULL && ! finalized ) {
+        MPI_Win_free( &window_ );
+    }
+}
+
+
+void NodeSharedArray::resize( std::size_t n )
+{
+    local_.resize( n );
+    data_ = local_.data();
+    size_ = n;
+}
+
+
+NodeSharedArray &NodeSharedArray::operator=( const std::vector<double> &values )
+{
+    local_ = values;
+    data_ = local_.data();
+    size_ = local_.size();
+    return *this;
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Copy the values of the world master in a shared window allocated by the master of each node
+//   The world master fills its own window, then the node masters broadcast the values between them.
+//   The fences order these writes before any read by the other processes of the node.
+// ---------------------------------------------------------------------------------------------------------------------
+void NodeSharedArray::share( SmileiMPI *smpi )
+{
+    if( window_ != MPI_WIN_NULL ) {
+        MPI_Win_free( &window_ );
+    }
+
+    unsigned long n = size_;
+    MPI_Bcast( &n, 1, MPI_UNSIGNED_LONG, 0, smpi->world() );
+
+    MPI_Aint bytes = smpi->isNodeMaster() ? n * sizeof( double ) : 0;
+    double *base;
+    MPI_Win_allocate_shared( bytes, sizeof( double ), MPI_INFO_NULL, smpi->nodeComm(), &base, &window_ );
+    MPI_Aint window_bytes;
+    int disp_unit;
+    MPI_Win_shared_query( window_, 0, &window_bytes, &disp_unit, &base );
+
+    MPI_Win_fence( 0, window_ );
+    if( smpi->isMaster() && n > 0 ) {
+        memcpy( base, local_.data(), n * sizeof( double ) );
+    }
+    if( smpi->isNodeMaster() && n > 0 ) {
+        MPI_Bcast( base, n, MPI_DOUBLE, 0, smpi->nodeMastersComm() );
+    }
+    MPI_Win_fence( 0, window_ );
+
+    std::vector<double>().swap( local_ );
+    data_ = base;
+    size_ = n;
+}
@@ -0,0 +1,63 @@
+#ifndef NODESHAREDARRAY_H
+#define NODESHAREDARRAY_H
+
+#include <mpi.h>
+#include <vector>
+#include <cstddef>
+
+class SmileiMPI;
+
+//! Read-only array of doubles shared by all the MPI processes of a node
+//!   The values are first set in a local buffer (read from a file or set by default).
+//!   share() then copies the values of the world master in an MPI-3 shared memory window
+//!   allocated once per node, and releases the local buffer: each node holds a single copy.
+class NodeSharedArray
+{
+public:
+    NodeSharedArray();
+    ~NodeSharedArray();
+
+    //! Resize the local buffer (before sharing)
+    void resize( std::size_t n );
+
+    //! Set the local buffer (before sharing)
+    NodeSharedArray &operator=( const std::vector<double> &values );
+
+    //! Broadcast the values of the world master to the shared window of each node (collective in world)
+    void share( SmileiMPI *smpi );
+
+    inline double &operator[]( std::size_t i )
+    {
+        return data_[i];
+    }
+    inline const double &operator[]( std::size_t i ) const
+    {
+        return data_[i];
+    }
+    inline std::size_t size() const
+    {
+        return size_;
+    }
+    inline double *data()
+    {
+        return data_;
+    }
+
+private:
+    NodeSharedArray( const NodeSharedArray & );
+    NodeSharedArray &operator=( const NodeSharedArray & );
+
+    //! Values before sharing
+    std::vector<double> local_;
+
+    //! Current values : local_ before sharing, the shared window after
+    double *data_;
+
+    //! Number of values
+    std::size_t size_;
+
+    //! Shared memory window (MPI_WIN_NULL before sharing)
+    MPI_Win window_;
+};
+
+#endif
@@ -65,13 +65,30 @@ SmileiMPI::SmileiMPI( int *argc, char ***argv )
 #endif
 
     world_ = MPI_COMM_WORLD;
+    halo_comm_ = MPI_COMM_NULL;
+    persistent_communications_ = false;
     MPI_Comm_size( world_, &smilei_sz );
     MPI_Comm_rank( world_, &smilei_rk );
 
+    splitNodeCommunicators();
+
     MPI_Allreduce( &number_of_cores, &global_number_of_cores, 1, MPI_INT, MPI_SUM, world_ );
 } // END SmileiMPI::SmileiMPI
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Group the MPI processes by node (shared memory), and the first process of each node in node_masters_comm_
+// ---------------------------------------------------------------------------------------------------------------------
+void SmileiMPI::splitNodeCommunicators()
+{
+    int rank;
+    MPI_Comm_rank( world_, &rank );
+    MPI_Comm_split_type( world_, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node_comm_ );
+    MPI_Comm_rank( node_comm_, &node_rk_ );
+    MPI_Comm_split( world_, node_rk_==0 ? 0 : MPI_UNDEFINED, rank, &node_masters_comm_ );
+}
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // SmileiMPI destructor :
 //     - Call MPI_Finalize
@@ -80,6 +97,14 @@ SmileiMPI::~SmileiMPI()
 {
     delete[]periods_;
 
+    if( halo_comm_ != MPI_COMM_NULL ) {
+        MPI_Comm_free( &halo_comm_ );
+    }
+    if( node_masters_comm_ != MPI_COMM_NULL ) {
+        MPI_Comm_free( &node_masters_comm_ );
+    }
+    MPI_Comm_free( &node_comm_ );
+
     MPI_Finalize();
 
 } // END SmileiMPI::~SmileiMPI
@@ -128,6 +153,8 @@ void SmileiMPI::init( Params &params, DomainDecomposition *domain_decomposition
     patch_count.resize( smilei_sz, 0 );
     capabilities.resize( smilei_sz, 1 );
     Tcapabilities = smilei_sz;
+    predicted_imbalance_ = 0.;
+    achieved_imbalance_ = 0.;
 
     if( smilei_rk == 0 ) {
         remove( "patch_load.txt" ) ;
@@ -193,6 +220,12 @@ void SmileiMPI::init( Params &params, DomainDecomposition *domain_decomposition
     }
 #endif
 
+    // Aggregated halo exchanges use their own communicator, their tags do not follow buildtag
+    if( params.aggregated_exchange ) {
+        MPI_Comm_dup( world_, &halo_comm_ );
+    }
+    persistent_communications_ = params.persistent_communications;
+
     // Set periodicity of the simulated problem
     periods_  = new int[params.nDim_field];
     for( unsigned int i=0 ; i<params.nDim_field ; i++ ) {
@@ -298,11 +331,15 @@ void SmileiMPI::init_patch_count( Params &params, DomainDecomposition *domain_de
             //Accumulate particles load of the current patch
             for( unsigned int ispecies = 0; ispecies < tot_species_number; ispecies++ ) {
                 local_load = peek[ispecies]->numberOfParticlesInPatch( x_cell );
-                // Consider whether this species is frozen
+                // Consider whether this species is frozen or subcycled
                 double time_frozen( 0. );
                 PyTools::extract( "time_frozen", time_frozen, "Species", ispecies );
+                int subcycle( 1 );
+                PyTools::extract( "subcycle", subcycle, "Species", ispecies );
                 if( time_frozen > 0. ) {
                     local_load *= params.frozen_particle_load;
+                } else if( subcycle > 1 ) {
+                    local_load *= params.frozen_particle_load + ( 1. - params.frozen_particle_load ) / subcycle;
                 }
                 // Add the load of the species to the current patch load
                 PatchLoad[ipatch] += local_load;
@@ -415,6 +452,57 @@ void SmileiMPI::init_patch_count( Params &params, DomainDecomposition *domain_de
 } // END init_patch_count
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+//  Distribute patches knowing the load of each of them (e.g. restart with a different number of MPI processes)
+//  Each rank receives consecutive patches until its share of the total load is reached.
+// ---------------------------------------------------------------------------------------------------------------------
+void SmileiMPI::patch_count_from_loads( std::vector<double> &PatchLoad )
+{
+    int Npatches = PatchLoad.size();
+    if( Npatches < smilei_sz ) {
+        ERROR( "Cannot distribute " << Npatches << " patches over " << smilei_sz << " MPI processes" );
+    }
+
+    double Tload = 0.;
+    for( int hindex=0; hindex<Npatches; hindex++ ) {
+        Tload += PatchLoad[hindex];
+    }
+    Tload /= Tcapabilities; //Target load for each mpi process.
+
+    patch_count.assign( smilei_sz, 0 );
+    int r = 0;
+    double Lcur = 0., Tcur = Tload * capabilities[0];
+    for( int hindex=0; hindex<Npatches; hindex++ ) {
+        if( r < smilei_sz-1 && patch_count[r] > 0 ) {
+            // Move on to the next rank if closer to target without the current patch, or if there are as many patches as procs left
+            if( Lcur + 0.5*PatchLoad[hindex] > Tcur || Npatches-hindex <= smilei_sz-1-r ) {
+                r++;
+                Tcur += Tload * capabilities[r];
+            }
+        }
+        patch_count[r]++;
+        Lcur += PatchLoad[hindex];
+    }
+
+    patch_refHindexes.resize( patch_count.size(), 0 );
+    patch_refHindexes[0] = 0;
+    for( int rk=1 ; rk<smilei_sz ; rk++ ) {
+        patch_refHindexes[rk] = patch_refHindexes[rk-1] + patch_count[rk-1];
+    }
+
+    if( smilei_rk==0 ) {
+        ofstream fout;
+        fout.open( "patch_load.txt" );
+        fout << "Target load = " << Tload << endl;
+        for( int rk=0; rk<smilei_sz; rk++ ) {
+            fout << "patch count = " << patch_count[rk]<<endl;
+        }
+        fout.close();
+    }
+
+} // END patch_count_from_loads
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 //  Recompute patch distribution
 // ---------------------------------------------------------------------------------------------------------------------
@@ -445,6 +533,13 @@ void SmileiMPI::recompute_patch_count( Params &params, VectorPatch &vecpatches,
     unsigned int tot_species_number = vecpatches( 0 )->vecSpecies.size();
     cells_load = ncells_perpatch*params.cell_load ;
 
+    // With measured loads, an overloaded patch is handled by adding a uniform load to all patches
+    std::vector<double> Lmeasured;
+    double extra_load = 0.;
+    if( params.measured_load_balancing ) {
+        compute_measured_loads( params, vecpatches, time_dual, cells_load, Lmeasured );
+    }
+
     Lp.resize( patch_count[smilei_rk] );
     if( smilei_rk > 0 ) {
         Lp_left.resize( patch_count[smilei_rk-1] );
@@ -463,12 +558,19 @@ void SmileiMPI::recompute_patch_count( Params &params, VectorPatch &vecpatches,
             Lp[ipatch] =  cells_load ;
         }
 
-        //Compute particle contribution to Local Loads of each Patch (Lp)
-        for( unsigned int ipatch=0; ipatch < ( unsigned int )patch_count[smilei_rk]; ipatch++ ) {
-            for( unsigned int ispecies = 0; ispecies < tot_species_number; ispecies++ ) {
-                Lp[ipatch] += vecpatches( ipatch )->vecSpecies[ispecies]->getNbrOfParticles()*( 1+( params.frozen_particle_load-1 )*( time_dual < vecpatches( ipatch )->vecSpecies[ispecies]->time_frozen_ ) ) ;
+        if( params.measured_load_balancing ) {
+            for( unsigned int ipatch=0; ipatch < ( unsigned int )patch_count[smilei_rk]; ipatch++ ) {
+                Lp[ipatch] = Lmeasured[ipatch] + extra_load;
+                Tload_loc += Lp[ipatch];
+            }
+        } else {
+            //Compute particle contribution to Local Loads of each Patch (Lp)
+            for( unsigned int ipatch=0; ipatch < ( unsigned int )patch_count[smilei_rk]; ipatch++ ) {
+                for( unsigned int ispecies = 0; ispecies < tot_species_number; ispecies++ ) {
+                    Lp[ipatch] += vecpatches( ipatch )->vecSpecies[ispecies]->getNbrOfParticles()*vecpatches( ipatch )->vecSpecies[ispecies]->particleLoadFactor( time_dual, params.frozen_particle_load );
+                }
+                Tload_loc += Lp[ipatch];
             }
-            Tload_loc += Lp[ipatch];
         }
 
         largest_patch_loc = *max_element( Lp.begin(), Lp.end() );
@@ -484,7 +586,10 @@ void SmileiMPI::recompute_patch_count( Params &params, VectorPatch &vecpatches,
 
         //This algorithm does not support single patches having a load larger than the target load per MPI rank.
         //If this happens, the code multiplies the cell load coefficient in order to be able to continue.
-        if( largest_patch >= Tload ) {
+        if( largest_patch >= Tload && params.measured_load_balancing ) {
+            extra_load = ( extra_load == 0. ) ? Tload * Tcapabilities / params.tot_number_of_patches : 2.*extra_load;
+            WARNING( "Dynamic Load balancing had to add a uniform load to all patches because of an overloaded patch with respect to the target load per MPI rank. Try using smaller patches or less MPI ranks." );
+        } else if( largest_patch >= Tload ) {
             params.cell_load *= 2.;
             cells_load = ncells_perpatch*params.cell_load ;
             WARNING( "Dynamic Load balancing had to increase cell load coefficient because of an overloaded patch with respect to the target load per MPI rank. Try using smaller patches or less MPI ranks." );
@@ -566,6 +671,7 @@ void SmileiMPI::recompute_patch_count( Params &params, VectorPatch &vecpatches,
     Ncur += patch_count[smilei_rk] ;
 
     //Ncur now has to be gathered to all as target_patch_count[smilei_rk]
+    std::vector<int> old_refHindexes = patch_refHindexes;
     MPI_Allgather( &Ncur, 1, MPI_INT, &patch_count[0], 1, MPI_INT, MPI_COMM_WORLD );
 
     patch_refHindexes[0] = 0;
@@ -573,9 +679,34 @@ void SmileiMPI::recompute_patch_count( Params &params, VectorPatch &vecpatches,
         patch_refHindexes[rk] = patch_refHindexes[rk-1] + patch_count[rk-1];
     }
 
+    //Predicted load of the new set of patches of current rank.
+    //Patches only move between neighbouring ranks, whose loads are known.
+    double Tnew_loc = 0.;
+    for( int h=patch_refHindexes[smilei_rk] ; h<patch_refHindexes[smilei_rk]+patch_count[smilei_rk] ; h++ ) {
+        int ipatch = h - old_refHindexes[smilei_rk];
+        if( ipatch < 0 ) {
+            ipatch += Lp_left.size();
+            if( ipatch >= 0 ) {
+                Tnew_loc += Lp_left[ipatch];
+            }
+        } else if( ipatch < ( int )Lp.size() ) {
+            Tnew_loc += Lp[ipatch];
+        } else if( ipatch - Lp.size() < Lp_right.size() ) {
+            Tnew_loc += Lp_right[ipatch - Lp.size()];
+        }
+    }
+    Tnew_loc /= capabilities[smilei_rk];
+    double Tnew_max;
+    MPI_Allreduce( &Tnew_loc, &Tnew_max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+    predicted_imbalance_ = Tnew_max / Tload;
+
     //Write patch_load.txt
     if( smilei_rk==0 ) {
         fout << "\tt = " << time_dual << endl;
+        if( params.measured_load_balancing && achieved_imbalance_ > 0. ) {
+            fout << " achieved imbalance since last balancing = " << achieved_imbalance_ << endl;
+        }
+        fout << " predicted imbalance = " << predicted_imbalance_ << endl;
         for( int irk=0; irk<smilei_sz; irk++ ) {
             fout << " patch_count[" << irk << "] = " << patch_count[irk] << endl;
         }
@@ -586,6 +717,66 @@ void SmileiMPI::recompute_patch_count( Params &params, VectorPatch &vecpatches,
 
 } // END recompute_patch_count
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute the load Lp of each patch of the current rank from the wall time measured on the patch since the last
+// load balancing (see Patch::load_timers). The load per iteration is smoothed by an exponential moving average.
+// Patches which were never measured are estimated from their numbers of particles and cells, converted to seconds
+// with the average ratio measured/estimated over all measured patches.
+// The imbalance achieved since the last load balancing is stored in achieved_imbalance_.
+// ---------------------------------------------------------------------------------------------------------------------
+void SmileiMPI::compute_measured_loads( Params &params, VectorPatch &vecpatches, double time_dual, double cells_load, std::vector<double> &Lp )
+{
+    unsigned int npatches = patch_count[smilei_rk];
+    unsigned int tot_species_number = vecpatches( 0 )->vecSpecies.size();
+    std::vector<double> Lestimated( npatches, cells_load );
+    double time_loc = 0., sums_loc[2] = {0., 0.}, sums[2];
+
+    for( unsigned int ipatch=0; ipatch < npatches; ipatch++ ) {
+        Patch *patch = vecpatches( ipatch );
+        for( unsigned int ispecies = 0; ispecies < tot_species_number; ispecies++ ) {
+            Lestimated[ipatch] += patch->vecSpecies[ispecies]->getNbrOfParticles()*patch->vecSpecies[ispecies]->particleLoadFactor( time_dual, params.frozen_particle_load );
+        }
+        if( patch->load_iterations > 0 ) {
+            double time_patch = 0.;
+            for( unsigned int itimer=0; itimer < patch->load_timers.size(); itimer++ ) {
+                time_patch += patch->load_timers[itimer];
+                patch->load_timers[itimer] = 0.;
+            }
+            time_loc += time_patch;
+            time_patch /= patch->load_iterations;
+            patch->load_iterations = 0;
+            if( patch->measured_load < 0. ) {
+                patch->measured_load = time_patch;
+            } else {
+                patch->measured_load = params.load_smoothing * patch->measured_load + ( 1.-params.load_smoothing ) * time_patch;
+            }
+        }
+        if( patch->measured_load >= 0. ) {
+            sums_loc[0] += patch->measured_load;
+            sums_loc[1] += Lestimated[ipatch];
+        }
+    }
+
+    // Ratio measured/estimated load
+    MPI_Allreduce( sums_loc, sums, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+    double ratio = ( sums[0] > 0. && sums[1] > 0. ) ? sums[0] / sums[1] : 1.;
+
+    Lp.resize( npatches );
+    for( unsigned int ipatch=0; ipatch < npatches; ipatch++ ) {
+        Patch *patch = vecpatches( ipatch );
+        Lp[ipatch] = ( patch->measured_load >= 0. ) ? patch->measured_load : Lestimated[ipatch] * ratio;
+    }
+
+    // Imbalance (max/average) of the time spent by each rank since the last load balancing
+    double time_max, time_sum;
+    time_loc /= capabilities[smilei_rk];
+    MPI_Allreduce( &time_loc, &time_max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+    MPI_Allreduce( &time_loc, &time_sum, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+    achieved_imbalance_ = ( time_sum > 0. ) ? time_max * smilei_sz / time_sum : 0.;
+
+} // END compute_measured_loads
+
+
 
 // ----------------------------------------------------------------------
 // Returns the rank of the MPI process currently owning patch h.
@@ -741,6 +932,12 @@ void SmileiMPI::isend_species( Patch *patch, int to, int &maxtag, int tag, Param
             i++;
         }
     }
+    // Measured load
+    if( params.measured_load_balancing ) {
+        patch->buffer_scalars.insert( patch->buffer_scalars.end(), patch->load_timers.begin(), patch->load_timers.end() );
+        patch->buffer_scalars.push_back( patch->load_iterations );
+        patch->buffer_scalars.push_back( patch->measured_load );
+    }
     MPI_Isend( &patch->buffer_scalars[0], patch->buffer_scalars.size(), MPI_DOUBLE, to, tag + maxtag, world_, &patch->requests_[maxtag] );
     maxtag ++;
 }
@@ -854,6 +1051,9 @@ void SmileiMPI::recv_species( Patch *patch, int from, int &tag, Params &params )
     } else {
         patch->buffer_scalars.resize( 2*nspec );
     }
+    if( params.measured_load_balancing ) {
+        patch->buffer_scalars.resize( patch->buffer_scalars.size() + patch->load_timers.size() + 2 );
+    }
     MPI_Status status;
     MPI_Recv( &patch->buffer_scalars[0], patch->buffer_scalars.size(), MPI_DOUBLE, from, tag, world_, &status );
     tag++;
@@ -875,6 +1075,15 @@ void SmileiMPI::recv_species( Patch *patch, int from, int &tag, Params &params )
             i++;
         }
     }
+    // Measured load
+    if( params.measured_load_balancing ) {
+        for( unsigned int itimer=0; itimer<patch->load_timers.size(); itimer++ ) {
+            patch->load_timers[itimer] = patch->buffer_scalars[i];
+            i++;
+        }
+        patch->load_iterations = patch->buffer_scalars[i];
+        patch->measured_load = patch->buffer_scalars[i+1];
+    }
 
 }
 
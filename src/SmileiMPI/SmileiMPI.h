@@ -35,6 +35,7 @@ class SmileiMPI
     friend class VectorPatch;
     friend class SimWindow;
     friend class AsyncMPIbuffers;
+    friend class DiagnosticFields3D;
 
 public:
     SmileiMPI() {};
@@ -54,9 +55,14 @@ public:
 
     // Initialize the patch_count vector. Patches are distributed in order to balance the load between MPI processes.
     virtual void init_patch_count( Params &params, DomainDecomposition *domain_decomposition );
+    // Set the patch_count vector from the known load of all patches (same result on all MPI processes).
+    void patch_count_from_loads( std::vector<double> &PatchLoad );
 
     // Recompute the patch_count vector. Browse patches and redistribute them in order to balance the load between MPI processes.
     void recompute_patch_count( Params &params, VectorPatch &vecpatches, double time_dual );
+    // Load of each patch measured by its timers since the last load balancing, smoothed in time.
+    // Patches never measured are estimated from their particles, scaled to the measured patches.
+    void compute_measured_loads( Params &params, VectorPatch &vecpatches, double time_dual, double cells_load, std::vector<double> &Lp );
     // Returns the rank of the MPI process currently owning patch h.
     int hrank( int h );
 
@@ -151,6 +157,36 @@ public:
         return world_;
     }
 
+    //! Return the communicator of the MPI processes sharing the memory of this node
+    inline MPI_Comm& nodeComm()
+    {
+        return node_comm_;
+    }
+
+    //! Return the communicator of the node masters (MPI_COMM_NULL on other processes)
+    inline MPI_Comm& nodeMastersComm()
+    {
+        return node_masters_comm_;
+    }
+
+    //! True for the first MPI process of each node
+    inline bool isNodeMaster()
+    {
+        return ( node_rk_==0 );
+    }
+
+    //! Return the communicator dedicated to the aggregated halo exchanges
+    inline MPI_Comm& haloComm()
+    {
+        return halo_comm_;
+    }
+
+    //! True if the halo exchanges use persistent requests
+    inline bool persistentCommunications()
+    {
+        return persistent_communications_;
+    }
+
     //! Return omp_max_threads
     inline int getOMPMaxThreads()
     {
@@ -255,8 +291,21 @@ public:
     bool test_mode;
 
 protected:
+    //! Create node_comm_ and node_masters_comm_
+    void splitNodeCommunicators();
+
     //! Global MPI Communicator
     MPI_Comm world_;
+    //! Duplicate of world_ for the aggregated halo exchanges (MPI_COMM_NULL if not used)
+    MPI_Comm halo_comm_;
+    //! Processes sharing the memory of a node (MPI_COMM_TYPE_SHARED)
+    MPI_Comm node_comm_;
+    //! First process of each node, ordered as in world_
+    MPI_Comm node_masters_comm_;
+    //! Process Id in node_comm_
+    int node_rk_;
+    //! Halo exchanges through persistent requests (Main.persistent_communications)
+    bool persistent_communications_;
 
     //! Number of MPI process in the current communicator
     int smilei_sz;
@@ -277,6 +326,9 @@ protected:
     //Number of patches owned by each mpi process.
     std::vector<int>  patch_count, capabilities, patch_refHindexes;
     int Tcapabilities; //Default = smilei_sz (1 per MPI rank)
+    
+    //! Load imbalance (max/average) predicted at the last load balancing, and achieved since (measured load model)
+    double predicted_imbalance_, achieved_imbalance_;
 };
 
 
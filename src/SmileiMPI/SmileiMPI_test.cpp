@@ -67,12 +67,15 @@ SmileiMPI_test::SmileiMPI_test( int *argc, char ***argv )
 #endif
     
     world_ = MPI_COMM_WORLD;
+    halo_comm_ = MPI_COMM_NULL;
+    persistent_communications_ = false;
     MPI_Comm_size( world_, &smilei_sz );
     MPI_Comm_rank( world_, &smilei_rk );
     
     if( smilei_sz > 1 ) {
         ERROR( "Test mode cannot be run with several MPI processes. Instead, indicate the MPIxOMP intended partition after the -T argument." );
     }
+    splitNodeCommunicators();
     
     smilei_sz = nMPI;
     smilei_rk = 0;
@@ -55,6 +55,7 @@ Species::Species( Params &params, Patch *patch ) :
     pusher_name_( "boris" ),
     radiation_model_( "none" ),
     time_frozen_( 0 ),
+    subcycle_( 1 ),
     radiating_( false ),
     relativistic_field_initialization_( false ),
     iter_relativistic_initialization_( 0 ),
@@ -105,6 +106,8 @@ Species::Species( Params &params, Patch *patch ) :
     initCluster( params );
     inv_nDim_particles = 1./( ( double )nDim_particle );
 
+    timestep_ = params.timestep;
+
     length_[0]=0;
     length_[1]=params.n_space[1]+1;
     length_[2]=params.n_space[2]+1;
@@ -242,6 +245,7 @@ void Species::initOperators( Params &params, Patch *patch )
 
     // projection operator (virtual)
     Proj = ProjectorFactory::create( params, patch, this->vectorized_operators && !params.cell_sorting );  // + patchId -> idx_domain_begin (now = ref smpi)
+    Proj->setSubcycle( subcycle_ );
 
     // Assign the Ionization model (if needed) to Ionize
     //  Needs to be placed after ParticleCreator() because requires the knowledge of max_charge_
@@ -361,7 +365,7 @@ void Species::dynamics( double time_dual, unsigned int ispec,
     // -------------------------------
     // calculate the particle dynamics
     // -------------------------------
-    if( time_dual>time_frozen_ || Ionize) { // moving particle
+    if( isPushed( time_dual ) || Ionize) { // moving particle
 
         smpi->dynamics_resize( ithread, nDim_field, particles->last_index.back(), params.geometry=="AMcylindrical" );
         //Point to local thread dedicated buffers
@@ -395,7 +399,7 @@ void Species::dynamics( double time_dual, unsigned int ispec,
 #endif
             }
 
-            if( time_dual<=time_frozen_ ) continue; // Do not push frozen particles
+            if( !isPushed( time_dual ) ) continue; // Do not push frozen particles
 
             // Radiation losses
             if( Radiate ) {
@@ -467,6 +471,7 @@ void Species::dynamics( double time_dual, unsigned int ispec,
 
             // Push the particles and the photons
             ( *Push )( *particles, smpi, particles->first_index[ibin], particles->last_index[ibin], ithread );
+            checkSubcycleDisplacement( particles->first_index[ibin], particles->last_index[ibin] );
             //particles->testMove( particles->first_index[ibin], particles->last_index[ibin], params );
 
 #ifdef  __DETAILED_TIMERS
@@ -475,7 +480,7 @@ void Species::dynamics( double time_dual, unsigned int ispec,
 
         } //ibin
 
-        if( time_dual>time_frozen_){ // do not apply particles BC nor project frozen particles
+        if( isPushed( time_dual ) ) { // do not apply particles BC nor project frozen particles
             for( unsigned int ibin = 0 ; ibin < particles->first_index.size() ; ibin++ ) {
                 double ener_iPart( 0. );
 
@@ -574,7 +579,7 @@ void Species::dynamics( double time_dual, unsigned int ispec,
 
     } //End if moving or ionized particles
 
-    if(time_dual <= time_frozen_ && diag_flag &&( !particles->is_test ) ) { //immobile particle (at the moment only project density)
+    if(!isPushed( time_dual ) && diag_flag &&( !particles->is_test ) ) { //immobile particle (at the moment only project density)
         if( params.geometry != "AMcylindrical" ) {
             double *b_rho=nullptr;
             for( unsigned int ibin = 0 ; ibin < particles->first_index.size() ; ibin ++ ) { //Loop for projection on buffer_proj
@@ -1184,11 +1189,38 @@ void Species::importParticles( Params &params, Patch *patch, Particles &source_p
 //} // End updateMvWinLimits
 
 
+// The charge-conserving projection of a subcycled species requires displacements below one cell
+void Species::checkSubcycleDisplacement( int istart, int iend )
+{
+    if( subcycle_ == 1 ) {
+        return;
+    }
+    double *momentum[3];
+    for( unsigned int i=0; i<3; i++ ) {
+        momentum[i] = particles->getPtrMomentum( i );
+    }
+    const double dt = subcycle_ * timestep_;
+    double max_cells = 0.;
+    #pragma omp simd reduction(max:max_cells)
+    for( int ipart=istart ; ipart<iend; ipart++ ) {
+        double invgf = dt / sqrt( 1. + momentum[0][ipart]*momentum[0][ipart]
+                                     + momentum[1][ipart]*momentum[1][ipart]
+                                     + momentum[2][ipart]*momentum[2][ipart] );
+        for( unsigned int idim=0; idim<nDim_particle; idim++ ) {
+            max_cells = max( max_cells, fabs( momentum[idim][ipart] ) * invgf * dx_inv_[idim] );
+        }
+    }
+    if( max_cells > 1. ) {
+        ERROR( "Species '" << name_ << "' moved by " << max_cells << " cells during " << subcycle_ << " timesteps: reduce its subcycle" );
+    }
+}
+
+
 //Do we have to project this species ?
 bool Species::isProj( double time_dual, SimWindow *simWindow )
 {
 
-    return time_dual > time_frozen_  || ( simWindow->isMoving( time_dual ) || Ionize ) ;
+    return isPushed( time_dual ) || ( simWindow->isMoving( time_dual ) || Ionize ) ;
 
     //Recompute frozen particles density if
     //moving window is activated, actually moving at this time step, and we are not in a density slope.
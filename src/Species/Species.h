@@ -95,6 +95,9 @@ public:
     //! Time for which the species is frozen
     double time_frozen_;
 
+    //! Number of timesteps between two pushes of the species (Species.subcycle)
+    unsigned int subcycle_;
+
     //! logical true if particles radiate
     bool radiating_;
 
@@ -333,7 +336,7 @@ public:
     void initOperators( Params &, Patch * );
 
     //! Method returning the Particle list for the considered Species
-    inline Particles getParticlesList() const
+    inline const Particles &getParticlesList() const
     {
         return *particles;
     }
@@ -460,6 +463,25 @@ public:
     //! Method to know if we have to project this species or not.
     bool  isProj( double time_dual, SimWindow *simWindow );
 
+    //! True if the particles are pushed at this time: not frozen, and at a multiple of subcycle_ timesteps
+    inline bool isPushed( double time_dual )
+    {
+        return time_dual > time_frozen_
+               && ( subcycle_ == 1 || ( ( unsigned int ) floor( time_dual / timestep_ ) ) % subcycle_ == 0 );
+    }
+
+    //! Stops the simulation if a subcycled species moved by more than one cell during its last push
+    void checkSubcycleDisplacement( int istart, int iend );
+
+    //! Load of one particle relative to a particle pushed at each timestep
+    inline double particleLoadFactor( double time_dual, double frozen_particle_load )
+    {
+        if( time_dual < time_frozen_ ) {
+            return frozen_particle_load;
+        }
+        return frozen_particle_load + ( 1. - frozen_particle_load ) / subcycle_;
+    }
+
     //! Set the energy lost in the boundary conditions
     void setLostNrjBC( double value )
     {
@@ -598,6 +620,9 @@ protected:
     //! Patch length
     unsigned int length_[3];
 
+    //! Simulation timestep
+    double timestep_;
+
 private:
     //! Number of steps for Maxwell-Juettner cumulative function integration
     //! \todo{Put in a code constant class}
@@ -666,6 +666,26 @@ public:
         // time when the relativistic field initialization is applied, if enabled
         this_species->iter_relativistic_initialization_ = ( int )( this_species->time_frozen_/params.timestep );
 
+        // Number of timesteps between two pushes
+        int subcycle = 1;
+        PyTools::extract( "subcycle", subcycle, "Species", ispec );
+        if( subcycle < 1 ) {
+            ERROR( "For species '" << species_name << "', subcycle must be a positive integer" );
+        }
+        this_species->subcycle_ = subcycle;
+        if( subcycle > 1 ) {
+            if( this_species->mass_ == 0 ) {
+                ERROR( "For species '" << species_name << "', subcycle is not available for photons" );
+            }
+            if( this_species->ponderomotive_dynamics ) {
+                ERROR( "For species '" << species_name << "', subcycle is not available with ponderomotive_dynamics" );
+            }
+            if( this_species->radiation_model_ != "none" || this_species->multiphoton_Breit_Wheeler_[0] != "" ) {
+                ERROR( "For species '" << species_name << "', subcycle is not available with radiation or multiphoton Breit-Wheeler processes" );
+            }
+            MESSAGE( 2, "> Pushed every " << subcycle << " timesteps" );
+        }
+
         if( !PyTools::extractVV( "boundary_conditions", this_species->boundary_conditions, "Species", ispec ) ) {
             ERROR( "For species '" << species_name << "', boundary_conditions not defined" );
         }
@@ -980,6 +1000,7 @@ public:
         new_species->c_part_max_                               = species->c_part_max_;
         new_species->mass_                                     = species->mass_;
         new_species->time_frozen_                              = species->time_frozen_;
+        new_species->subcycle_                                 = species->subcycle_;
         new_species->radiating_                                = species->radiating_;
         new_species->relativistic_field_initialization_        = species->relativistic_field_initialization_;
         new_species->iter_relativistic_initialization_         = species->iter_relativistic_initialization_;
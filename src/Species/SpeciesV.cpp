@@ -25,6 +25,19 @@
 #include "Projector.h"
 #include "ProjectorFactory.h"
 
+#include "Interpolator1D2OrderV.h"
+#include "Interpolator2D2OrderV.h"
+#include "Interpolator3D2OrderV.h"
+#include "InterpolatorAM2OrderV.h"
+#include "Projector1D2OrderV.h"
+#include "Projector2D2OrderV.h"
+#include "Projector3D2OrderV.h"
+#include "ProjectorAM2OrderV.h"
+#include "PusherBoris.h"
+#include "PusherVay.h"
+
+#include <typeinfo>
+
 #include "SimWindow.h"
 #include "Patch.h"
 
@@ -156,18 +169,29 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
     // -------------------------------
     // calculate the particle dynamics
     // -------------------------------
-    if( time_dual>time_frozen_ || Ionize ) { // moving particle
+    if( isPushed( time_dual ) || Ionize ) { // moving particle
 
         //Point to local thread dedicated buffers
         //Still needed for ionization
         vector<double> *Epart = &( smpi->dynamics_Epart[ithread] );
 
+        // Specialized kernel for the most common combinations of operators
+        FusedDynamics fused = isPushed( time_dual ) ? selectFusedDynamics( partWalls ) : NULL;
 
         for( unsigned int ipack = 0 ; ipack < npack_ ; ipack++ ) {
 
             int nparts_in_pack = particles->last_index[( ipack+1 ) * packsize_-1 ];
             smpi->dynamics_resize( ithread, nDim_field, nparts_in_pack, params.geometry=="AMcylindrical" );
 
+            if( fused ) {
+                for( unsigned int i=0; i<count.size(); i++ ) {
+                    count[i] = 0;
+                }
+                nrj_bc_lost += ( this->*fused )( EMfields, params, diag_flag, patch, smpi, ispec, ithread, ipack );
+                checkSubcycleDisplacement( particles->first_index[ipack*packsize_], particles->last_index[ipack*packsize_+packsize_-1] );
+                continue;
+            }
+
 #ifdef  __DETAILED_TIMERS
             timer = MPI_Wtime();
 #endif
@@ -195,7 +219,7 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
 #endif
             }
 
-            if ( time_dual <= time_frozen_ ) continue;
+            if ( !isPushed( time_dual ) ) continue;
 
             //Prepare for sorting
             for( unsigned int i=0; i<count.size(); i++ ) {
@@ -269,6 +293,7 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
             ( *Push )( *particles, smpi, particles->first_index[ipack*packsize_],
                        particles->last_index[ipack*packsize_+packsize_-1],
                        ithread, particles->first_index[ipack*packsize_] );
+            checkSubcycleDisplacement( particles->first_index[ipack*packsize_], particles->last_index[ipack*packsize_+packsize_-1] );
 
 #ifdef  __DETAILED_TIMERS
             patch->patch_timers[1] += MPI_Wtime() - timer;
@@ -364,7 +389,7 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
         } // End loop on packs
     } //End if moving or ionized particles
 
-    if(time_dual <= time_frozen_ && diag_flag &&( !particles->is_test ) ) { //immobile particle (at the moment only project density)
+    if(!isPushed( time_dual ) && diag_flag &&( !particles->is_test ) ) { //immobile particle (at the moment only project density)
 
         if( params.geometry != "AMcylindrical" ) {
             double *b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
@@ -394,6 +419,143 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
 }//END dynamics
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Select the fused dynamics kernel matching the current operators
+// Only the plain Lorentz dynamics are fused: no ionization, radiation, pair creation or walls
+// ---------------------------------------------------------------------------------------------------------------------
+SpeciesV::FusedDynamics SpeciesV::selectFusedDynamics( PartWalls *partWalls )
+{
+    if( Ionize || Radiate || Multiphoton_Breit_Wheeler_process || partWalls->size() > 0 || mass_ <= 0 ) {
+        return NULL;
+    }
+
+    const type_info &interp = typeid( *Interp );
+    const type_info &push   = typeid( *Push );
+    const type_info &proj   = typeid( *Proj );
+
+    if( interp == typeid( Interpolator3D2OrderV ) && proj == typeid( Projector3D2OrderV ) ) {
+        if( push == typeid( PusherBoris ) ) {
+            return &SpeciesV::fusedDynamics<Interpolator3D2OrderV, PusherBoris, Projector3D2OrderV>;
+        } else if( push == typeid( PusherVay ) ) {
+            return &SpeciesV::fusedDynamics<Interpolator3D2OrderV, PusherVay, Projector3D2OrderV>;
+        }
+    } else if( interp == typeid( Interpolator2D2OrderV ) && proj == typeid( Projector2D2OrderV ) ) {
+        if( push == typeid( PusherBoris ) ) {
+            return &SpeciesV::fusedDynamics<Interpolator2D2OrderV, PusherBoris, Projector2D2OrderV>;
+        } else if( push == typeid( PusherVay ) ) {
+            return &SpeciesV::fusedDynamics<Interpolator2D2OrderV, PusherVay, Projector2D2OrderV>;
+        }
+    } else if( interp == typeid( Interpolator1D2OrderV ) && proj == typeid( Projector1D2OrderV ) ) {
+        if( push == typeid( PusherBoris ) ) {
+            return &SpeciesV::fusedDynamics<Interpolator1D2OrderV, PusherBoris, Projector1D2OrderV>;
+        } else if( push == typeid( PusherVay ) ) {
+            return &SpeciesV::fusedDynamics<Interpolator1D2OrderV, PusherVay, Projector1D2OrderV>;
+        }
+    } else if( interp == typeid( InterpolatorAM2OrderV ) && proj == typeid( ProjectorAM2OrderV ) ) {
+        if( push == typeid( PusherBoris ) ) {
+            return &SpeciesV::fusedDynamics<InterpolatorAM2OrderV, PusherBoris, ProjectorAM2OrderV>;
+        } else if( push == typeid( PusherVay ) ) {
+            return &SpeciesV::fusedDynamics<InterpolatorAM2OrderV, PusherVay, ProjectorAM2OrderV>;
+        }
+    }
+    return NULL;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Fused dynamics of one pack: each cell goes through interpolation, push, boundary conditions
+// and projection before the next one. The operators are called without virtual dispatch.
+// The fields of the particles are interpolated in blocks on the stack and pushed right away:
+// the thread buffers Epart and Bpart are not used. The other thread buffers (deltaold, invgf, ...)
+// are indexed exactly as in the generic path.
+// ---------------------------------------------------------------------------------------------------------------------
+template<class InterpolatorT, class PusherT, class ProjectorT>
+double SpeciesV::fusedDynamics( ElectroMagn *EMfields, Params &params, bool diag_flag,
+                                Patch *patch, SmileiMPI *smpi, unsigned int ispec, int ithread, unsigned int ipack )
+{
+#ifdef  __DETAILED_TIMERS
+    double timer;
+#endif
+
+    InterpolatorT *interp = static_cast<InterpolatorT *>( Interp );
+    PusherT       *push   = static_cast<PusherT *>( Push );
+    ProjectorT    *proj   = static_cast<ProjectorT *>( Proj );
+
+    const int ipart_ref = particles->first_index[ipack*packsize_];
+    double nrj_lost = 0.;
+    
+    // Fields of a block of particles, between the interpolation and the push
+    const int nblock = 128;
+    double Eblock[3*nblock], Bblock[3*nblock];
+
+    for( unsigned int scell = 0 ; scell < packsize_ ; scell++ ) {
+
+        const unsigned int icell = ipack*packsize_+scell;
+        const int istart = particles->first_index[icell];
+        const int iend   = particles->last_index[icell];
+        if( iend == istart ) {
+            continue;
+        }
+
+        for( int iblock=istart ; iblock<iend ; iblock+=nblock ) {
+            int iblock_end = min( iblock+nblock, iend );
+#ifdef  __DETAILED_TIMERS
+            timer = MPI_Wtime();
+#endif
+            interp->InterpolatorT::fieldsInBuffers( EMfields, *particles, smpi, &iblock, &iblock_end, ithread, ipart_ref,
+                                                    Eblock, Bblock, nblock, iblock );
+#ifdef  __DETAILED_TIMERS
+            patch->patch_timers[0] += MPI_Wtime() - timer;
+            timer = MPI_Wtime();
+#endif
+
+            push->PusherT::pushWithFields( *particles, smpi, iblock, iblock_end, ithread, ipart_ref,
+                                           Eblock, Bblock, nblock, iblock );
+
+#ifdef  __DETAILED_TIMERS
+            patch->patch_timers[1] += MPI_Wtime() - timer;
+#endif
+        }
+
+#ifdef  __DETAILED_TIMERS
+        timer = MPI_Wtime();
+#endif
+
+        // Boundary Condition may be physical or due to domain decomposition
+        double ener_iPart( 0. );
+        partBoundCond->apply( *particles, smpi, istart, iend, this, ithread, ener_iPart );
+        nrj_lost += mass_ * ener_iPart;
+
+        for( int iPart=istart ; iPart<iend; iPart++ ) {
+            if( particles->cell_keys[iPart] != -1 ) {
+                //Compute cell_keys of remaining particles
+                for( unsigned int i = 0 ; i<nDim_field; i++ ) {
+                    particles->cell_keys[iPart] *= this->length_[i];
+                    particles->cell_keys[iPart] += round( ( ( this )->*( distance[i] ) )( particles, i, iPart ) * dx_inv_[i] );
+                }
+                //First reduction of the count sort algorithm. Lost particles are not included.
+                count[particles->cell_keys[iPart]] ++;
+            }
+        }
+
+#ifdef  __DETAILED_TIMERS
+        patch->patch_timers[3] += MPI_Wtime() - timer;
+        timer = MPI_Wtime();
+#endif
+
+        if( !particles->is_test ) {
+            proj->ProjectorT::currentsAndDensityWrapper( EMfields, *particles, smpi, istart, iend, ithread,
+                    diag_flag, params.is_spectral, ispec, icell, ipart_ref );
+        }
+
+#ifdef  __DETAILED_TIMERS
+        patch->patch_timers[2] += MPI_Wtime() - timer;
+#endif
+    }
+
+    return nrj_lost;
+}
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // For all particles of the species
 //   - increment the charge (projection)
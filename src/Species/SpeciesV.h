@@ -93,6 +93,19 @@ public:
 
 private:
 
+    //! Signature of the fused dynamics kernels, returning the energy lost at the boundaries
+    typedef double ( SpeciesV::*FusedDynamics )( ElectroMagn *EMfields, Params &params, bool diag_flag,
+            Patch *patch, SmileiMPI *smpi, unsigned int ispec, int ithread, unsigned int ipack );
+
+    //! Fused kernel specialized for the current operators, or NULL if the generic path must be used
+    FusedDynamics selectFusedDynamics( PartWalls *partWalls );
+
+    //! Interpolation, push, boundary conditions and projection applied cell by cell,
+    //! so that the particles and their fields stay in cache between the operators
+    template<class InterpolatorT, class PusherT, class ProjectorT>
+    double fusedDynamics( ElectroMagn *EMfields, Params &params, bool diag_flag,
+                          Patch *patch, SmileiMPI *smpi, unsigned int ispec, int ithread, unsigned int ipack );
+
     //! Number of packs of particles that divides the total number of particles
     unsigned int npack_;
     //! Size of the pack in number of particles
@@ -89,7 +89,7 @@ void SpeciesVAdaptive::scalarDynamics( double time_dual, unsigned int ispec,
     // -------------------------------
     // calculate the particle dynamics
     // -------------------------------
-    if( time_dual>time_frozen_ || Ionize ) {
+    if( isPushed( time_dual ) || Ionize ) {
         // moving particle
 
         smpi->dynamics_resize( ithread, nDim_particle, particles->last_index.back() );
@@ -130,7 +130,7 @@ void SpeciesVAdaptive::scalarDynamics( double time_dual, unsigned int ispec,
 #endif
             }
 
-            if( time_dual<=time_frozen_ ) continue; // Do not push nor project frozen particles
+            if( !isPushed( time_dual ) ) continue; // Do not push nor project frozen particles
 
             // Radiation losses
             if( Radiate ) {
@@ -185,13 +185,14 @@ void SpeciesVAdaptive::scalarDynamics( double time_dual, unsigned int ispec,
             }
         }
 
-    if( time_dual>time_frozen_ ) { // do not push, nor apply particles BC, nor project frozen particles
+    if( isPushed( time_dual ) ) { // do not push, nor apply particles BC, nor project frozen particles
 
 #ifdef  __DETAILED_TIMERS
             timer = MPI_Wtime();
 #endif
             // Push the particles and the photons
             ( *Push )( *particles, smpi, 0, particles->last_index.back(), ithread, 0. );
+            checkSubcycleDisplacement( 0, particles->last_index.back() );
 #ifdef  __DETAILED_TIMERS
             patch->patch_timers[1] += MPI_Wtime() - timer;
             timer = MPI_Wtime();
@@ -279,7 +280,7 @@ void SpeciesVAdaptive::scalarDynamics( double time_dual, unsigned int ispec,
 
     }  // end if moving particle or ionize
 
-    if(time_dual <= time_frozen_ && diag_flag &&( !particles->is_test ) ) { //immobile particle (at the moment only project density)
+    if(!isPushed( time_dual ) && diag_flag &&( !particles->is_test ) ) { //immobile particle (at the moment only project density)
 
         double *b_rho=nullptr;
         for( unsigned int ibin = 0 ; ibin < particles->first_index.size() ; ibin ++ ) { //Loop for projection on buffer_proj
@@ -462,6 +463,7 @@ void SpeciesVAdaptive::reconfigure_operators( Params &params, Patch *patch )
     //Push = PusherFactory::create(params, this);
     // Reassign the correct Projector
     Proj = ProjectorFactory::create( params, patch, this->vectorized_operators );
+    Proj->setSubcycle( subcycle_ );
 }
 
 
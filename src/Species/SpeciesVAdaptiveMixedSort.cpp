@@ -356,6 +356,7 @@ void SpeciesVAdaptiveMixedSort::reconfigure_operators( Params &params, Patch *pa
     }
     // Reassign the correct Projector
     Proj = ProjectorFactory::create( params, patch, this->vectorized_operators );
+    Proj->setSubcycle( subcycle_ );
 }
 
 // -----------------------------------------------------------------------------
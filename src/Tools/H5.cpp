@@ -1,7 +1,7 @@
 #include "H5.h"
 
 //! Open HDF5 file + location
-H5::H5( std::string file, unsigned access, MPI_Comm * comm, bool _raise )
+H5::H5( std::string file, unsigned access, MPI_Comm * comm, bool _raise, std::vector<char> * image, hsize_t alignment ) : image_( image )
 {
     
     // Analyse file string : separate file name and tree inside hdf5 file
@@ -34,6 +34,12 @@ H5::H5( std::string file, unsigned access, MPI_Comm * comm, bool _raise )
     hid_t fapl = H5Pcreate( H5P_FILE_ACCESS );
     if( comm ) {
         H5Pset_fapl_mpio( fapl, *comm, MPI_INFO_NULL );
+        if( alignment > 0 ) {
+            H5Pset_alignment( fapl, alignment, alignment );
+        }
+    } else if( image ) {
+        // In memory, without backing store, growing by 16 MB
+        H5Pset_fapl_core( fapl, 1<<24, 0 );
     }
     if( access == H5F_ACC_RDWR ) {
         fid_ = H5Fcreate( filepath.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl );
@@ -78,7 +84,7 @@ H5::H5( std::string file, unsigned access, MPI_Comm * comm, bool _raise )
 
 
 //! Location already opened
-H5::H5( hid_t id, hid_t dcr, hid_t dxpl ) : fid_( -1 ), id_( id ), dcr_( dcr ), dxpl_( dxpl )
+H5::H5( hid_t id, hid_t dcr, hid_t dxpl ) : fid_( -1 ), id_( id ), dcr_( dcr ), dxpl_( dxpl ), image_( NULL )
 {
 }
 
@@ -92,6 +98,14 @@ H5::~H5()
     if( fid_ >= 0 ) {
         H5Pclose( dxpl_ );
         H5Pclose( dcr_ );
+        if( image_ ) {
+            H5Fflush( fid_, H5F_SCOPE_GLOBAL );
+            ssize_t size = H5Fget_file_image( fid_, NULL, 0 );
+            image_->resize( size > 0 ? size : 0 );
+            if( size <= 0 || H5Fget_file_image( fid_, image_->data(), size ) != size ) {
+                ERROR( "Can't get the image of file " << filepath );
+            }
+        }
         if( H5Fclose( fid_ ) < 0 ) {
             ERROR( "Can't close file " << filepath );
         }
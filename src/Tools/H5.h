@@ -67,7 +67,9 @@ class H5
 {
 public:
     //! Open HDF5 file + location
-    H5( std::string file, unsigned access, MPI_Comm * comm, bool _raise );
+    //! If image is provided, the file is created in memory, and copied to image when closed
+    //! If alignment is provided, large objects of a parallel file are aligned on multiples of alignment bytes
+    H5( std::string file, unsigned access, MPI_Comm * comm, bool _raise, std::vector<char> * image = NULL, hsize_t alignment = 0 );
     
     ~H5();
     
@@ -101,6 +103,8 @@ protected:
     hid_t id_;
     hid_t dcr_;
     hid_t dxpl_;
+    //! Destination of the in-memory file image (NULL for a file on disk)
+    std::vector<char> * image_;
     
     hid_t newGroupId( std::string group_name ) {
         if( H5Lexists( id_, group_name.c_str(), H5P_DEFAULT ) > 0 ) {
@@ -124,8 +128,12 @@ class H5Write : public H5
 {
 public:
     //! Open HDF5 file + location
-    H5Write( std::string file, MPI_Comm * comm = NULL, bool _raise = true )
-     : H5( file, H5F_ACC_RDWR, comm, _raise ) {};
+    H5Write( std::string file, MPI_Comm * comm = NULL, bool _raise = true, hsize_t alignment = 0 )
+     : H5( file, H5F_ACC_RDWR, comm, _raise, NULL, alignment ) {};
+    
+    //! Create an HDF5 file in memory, copied to image when closed
+    H5Write( std::string file, std::vector<char> * image )
+     : H5( file, H5F_ACC_RDWR, NULL, true, image ) {};
     
     //! Create group given H5Write location
     H5Write( H5Write *loc, std::string group_name )
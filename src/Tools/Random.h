@@ -4,6 +4,7 @@
 #include <cstdlib>
 #include <inttypes.h>
 #include <cmath>
+#include <algorithm>
 
 class Random
 {
@@ -17,10 +18,30 @@ public:
         if( xorshift32_state==0 ) {
             xorshift32_state = 1073741824;
         }
+        setCounter( seed, 0, 0 );
+    };
+    
+    //! Generator on the stream number `stream` derived from `seed` (independent of std::rand)
+    Random( uint32_t seed, uint32_t stream ) {
+        reseed( seed, stream );
+        setCounter( seed, stream, 0 );
     };
     
     ~Random() {};
     
+    //! Restart the generator on the stream number `stream` derived from `seed`
+    inline void reseed( uint32_t seed, uint32_t stream ) {
+        // Mix the seed and the stream number (MurmurHash3 finalizer) so that neighbouring streams are not correlated
+        uint32_t h = seed ^ ( stream * 0x9e3779b9u );
+        h ^= h >> 16;
+        h *= 0x85ebca6bu;
+        h ^= h >> 13;
+        h *= 0xc2b2ae35u;
+        h ^= h >> 16;
+        // zero is not acceptable for xorshift
+        xorshift32_state = h==0 ? 1073741824 : h;
+    }
+    
     //! random integer
     inline uint32_t integer() {
         return xorshift32();
@@ -43,11 +64,9 @@ public:
     }
     //! Normal rand from xorshift32 generator (std deviation = 1.)
     inline double normal() {
-        static double spare;
-        static bool has_spare = false;
-        if( has_spare ) {
-            has_spare = false;
-            return spare;
+        if( has_spare_ ) {
+            has_spare_ = false;
+            return spare_;
         } else {
             double u, v, s;
             do {
@@ -56,17 +75,136 @@ public:
                 s = u*u + v*v;
             } while( s >= 1. );
             s = std::sqrt( -2. * std::log(s) / s );
-            spare = v * s;
-            has_spare = true;
+            spare_ = v * s;
+            has_spare_ = true;
             return u * s;
         }
     }
+    
+    // -----------------------------------------------------------------------------------------
+    // Counter-based generator (Philox4x32-10, Salmon et al., SC'11)
+    //   The rands are a pure function of (seed, patch, timestep, stream, draw, index):
+    //   no state is modified, so that the particles may draw in any order, on any thread,
+    //   and whole arrays of rands are generated by vectorized loops.
+    //   A stream is the pair (species, process); the draw number distinguishes
+    //   the successive draws of a particle within a timestep.
+    // -----------------------------------------------------------------------------------------
+    
+    //! Processes drawing from the counter-based generator
+    enum { radiation = 0, ionization = 1, multiphoton_Breit_Wheeler = 2, particle_creation = 3, particle_injection = 4 };
+    
+    //! Stream number of a process for a given species
+    static inline uint32_t stream( unsigned int species, unsigned int process ) {
+        return ( species << 8 ) | process;
+    }
+    
+    //! Set the key (seed, patch) and the timestep of the counter-based generator
+    inline void setCounter( uint32_t seed, uint32_t patch, uint32_t itime ) {
+        key0_  = seed;
+        key1_  = patch;
+        itime_ = itime;
+    }
+    
+    //! Counter-based uniform rand between 0 (excluded) and 1 (included), equal to the element `index` of uniforms()
+    inline double uniform( uint32_t stream, uint32_t draw, uint32_t index ) const {
+        uint32_t x[4];
+        philoxBlock( x, index >> 2, stream, draw );
+        return ( x[index & 3] + 1. ) * xorshift32_invmax;
+    }
+    
+    //! Fill u with the counter-based uniform rands of indices first to first+n-1, between 0 (excluded) and 1 (included)
+    inline void uniforms( double *u, unsigned int n, uint32_t stream, uint32_t draw, uint32_t first ) const {
+        uint32_t x[4*counter_chunk];
+        for( uint32_t block = first >> 2; 4*block < first+n; block += counter_chunk ) {
+            unsigned int nblocks = std::min( ( unsigned int )counter_chunk, ( first+n+3 )/4 - block );
+            philoxBlocks( x, block, nblocks, stream, draw );
+            uint32_t imin = std::max( first, 4*block );
+            uint32_t imax = std::min( first+n, 4*( block+nblocks ) );
+            uint32_t *xi = x - 4*block;
+            double *ui = u - first;
+            #pragma omp simd
+            for( uint32_t i = imin; i < imax; i++ ) {
+                ui[i] = ( xi[i] + 1. ) * xorshift32_invmax;
+            }
+        }
+    }
+    
+    //! Fill g with the counter-based normal rands (std deviation = 1.) of indices first to first+n-1
+    //! Box-Muller transform of the uniforms of indices (2i, 2i+1), which gives the normals of the same indices
+    inline void normals( double *g, unsigned int n, uint32_t stream, uint32_t draw, uint32_t first ) const {
+        uint32_t x[4*counter_chunk];
+        double y[4*counter_chunk];
+        for( uint32_t block = first >> 2; 4*block < first+n; block += counter_chunk ) {
+            unsigned int nblocks = std::min( ( unsigned int )counter_chunk, ( first+n+3 )/4 - block );
+            philoxBlocks( x, block, nblocks, stream, draw );
+            #pragma omp simd
+            for( unsigned int i = 0; i < 2*nblocks; i++ ) {
+                double r = std::sqrt( -2. * std::log( ( x[2*i] + 1. ) * xorshift32_invmax ) );
+                double phi = ( x[2*i+1] + 1. ) * xorshift32_invmax_2pi;
+                y[2*i]   = r * std::cos( phi );
+                y[2*i+1] = r * std::sin( phi );
+            }
+            uint32_t imin = std::max( first, 4*block );
+            uint32_t imax = std::min( first+n, 4*( block+nblocks ) );
+            double *yi = y - 4*block;
+            double *gi = g - first;
+            #pragma omp simd
+            for( uint32_t i = imin; i < imax; i++ ) {
+                gi[i] = yi[i];
+            }
+        }
+    }
 
     //! State of the random number generator
     uint32_t xorshift32_state;
 
 private:
     
+    //! Spare value of normal()
+    double spare_;
+    bool has_spare_ = false;
+    
+    //! Key and timestep of the counter-based generator
+    uint32_t key0_, key1_, itime_;
+    
+    //! Number of Philox blocks (4 rands each) generated at once by the batch functions
+    static constexpr unsigned int counter_chunk = 64;
+    
+    //! Philox4x32-10 : 10 rounds on the counter (c0, c1, c2, c3) with the key (k0, k1)
+    static inline void philox( uint32_t &c0, uint32_t &c1, uint32_t &c2, uint32_t &c3, uint32_t k0, uint32_t k1 ) {
+        for( int round = 0; round < 10; round++ ) {
+            uint64_t p0 = ( uint64_t )0xD2511F53u * c0;
+            uint64_t p1 = ( uint64_t )0xCD9E8D57u * c2;
+            c0 = ( uint32_t )( p1 >> 32 ) ^ c1 ^ k0;
+            c1 = ( uint32_t )p1;
+            c2 = ( uint32_t )( p0 >> 32 ) ^ c3 ^ k1;
+            c3 = ( uint32_t )p0;
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+    }
+    //! The 4 rands of the block number `block`
+    inline void philoxBlock( uint32_t *x, uint32_t block, uint32_t stream, uint32_t draw ) const {
+        x[0] = block;
+        x[1] = stream;
+        x[2] = itime_;
+        x[3] = draw;
+        philox( x[0], x[1], x[2], x[3], key0_, key1_ );
+    }
+    //! The 4*nblocks rands of the blocks `block` to `block+nblocks-1`, vectorized over the blocks
+    inline void philoxBlocks( uint32_t *x, uint32_t block, unsigned int nblocks, uint32_t stream, uint32_t draw ) const {
+        uint32_t k0 = key0_, k1 = key1_, itime = itime_;
+        #pragma omp simd
+        for( unsigned int b = 0; b < nblocks; b++ ) {
+            uint32_t c0 = block + b, c1 = stream, c2 = itime, c3 = draw;
+            philox( c0, c1, c2, c3, k0, k1 );
+            x[4*b]   = c0;
+            x[4*b+1] = c1;
+            x[4*b+2] = c2;
+            x[4*b+3] = c3;
+        }
+    }
+    
     //! Random number generator
     inline uint32_t xorshift32()
     {
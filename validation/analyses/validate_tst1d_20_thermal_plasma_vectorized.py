@@ -0,0 +1,7 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Same seed as the scalar operators: same fields and currents up to round-off errors
+ValidateFields(S, 1, ["Ex","Ey","Ez","Jx","Jy","Jz"], 10, against="tst1d_20_thermal_plasma.py")
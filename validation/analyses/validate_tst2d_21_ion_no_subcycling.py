@@ -0,0 +1,14 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Ion current, averaged over 4 timesteps and over space
+Jz_ion = np.array([np.mean(d) for d in S.Field.Field0.Jz_ion().getData()])
+Validate("Mean ion current Jz", Jz_ion, 1e-4)
+
+# Energy balance
+Utot = S.Scalar.Utot().getData()
+Ukin = S.Scalar.Ukin().getData()
+Validate("Total energy", Utot/Utot[0], 1e-3)
+Validate("Kinetic energy", Ukin/Utot[0], 1e-3)
@@ -0,0 +1,18 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Compare to the same case without subcycling: the ion current is deposited every
+# 4 timesteps only, but its average over 4 timesteps must be the same
+reference = "tst2d_21_ion_no_subcycling.py"
+
+# Ion current, averaged over 4 timesteps and over space
+Jz_ion = np.array([np.mean(d) for d in S.Field.Field0.Jz_ion().getData()])
+ValidateAgainst(reference, "Mean ion current Jz", Jz_ion, 1e-4)
+
+# Energy balance
+Utot = S.Scalar.Utot().getData()
+Ukin = S.Scalar.Ukin().getData()
+ValidateAgainst(reference, "Total energy", Utot/Utot[0], 1e-3)
+ValidateAgainst(reference, "Kinetic energy", Ukin/Utot[0], 1e-3)
@@ -0,0 +1,14 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Compare to the same case with the filters evaluated by python
+reference = "tst2d_22_track_filter_python.py"
+
+# Number and ids of the selected particles at each timestep
+for species in ["electron", "ion", "test"]:
+	data = S.TrackParticles(species, axes=["Id"], sort=False).getData()
+	ids = [np.sort(data[t]["Id"]) for t in data["times"]]
+	ValidateAgainst(reference, "Number of selected "+species, np.array([len(i) for i in ids]))
+	ValidateAgainst(reference, "Ids of selected "+species, np.concatenate(ids))
@@ -0,0 +1,11 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Number and ids of the selected particles at each timestep
+for species in ["electron", "ion", "test"]:
+	data = S.TrackParticles(species, axes=["Id"], sort=False).getData()
+	ids = [np.sort(data[t]["Id"]) for t in data["times"]]
+	Validate("Number of selected "+species, np.array([len(i) for i in ids]))
+	Validate("Ids of selected "+species, np.concatenate(ids))
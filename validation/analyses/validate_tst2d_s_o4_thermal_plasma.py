@@ -0,0 +1,7 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Fields and currents after a few timesteps (reference for tst2d_v_o4_thermal_plasma.py)
+ValidateFields(S, 1, ["Ex","Ey","Ez","Jx","Jy","Jz"], 10)
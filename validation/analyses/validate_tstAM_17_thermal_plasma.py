@@ -0,0 +1,7 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Fields and currents after a few timesteps (reference for tstAM_17_thermal_plasma_vectorized.py)
+ValidateFields(S, 1, ["El","Er","Et","Jl","Jr","Jt"], 10, theta=0.)
@@ -0,0 +1,7 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Same seed as the scalar operators: same fields and currents up to round-off errors
+ValidateFields(S, 1, ["El","Er","Et","Jl","Jr","Jt"], 10, against="tstAM_17_thermal_plasma.py", theta=0.)
@@ -51,6 +51,7 @@ Loops through all requested benchmarks
         Executes the "validate_*" script and stores the result as reference data
     If requested to compare to previous references
         Executes the "validate_*" script and compares the result to the reference data
+        (and, for quantities given to ValidateAgainst, to the reference data of another benchmark)
     If requested to show differences to previous references
         Executes the "validate_*" script and plots the result vs. the reference data
 
@@ -846,6 +847,45 @@ class ShowDiffWithReference(object):
             print( data)
 
 
+# DEFINE A FUNCTION TO COMPARE A SIMULATION TO THE REFERENCE OF ANOTHER BENCHMARK
+# (e.g. the same case with different operators, which must give the same physics)
+# The quantity is also validated against the reference of the current benchmark.
+def ValidateAgainst(bench_name, data_name, data, precision=None):
+    Validate(data_name, data, precision)
+    if isinstance(Validate, CreateReference):
+        return
+    other_data = findReference(bench_name)
+    if data_name not in other_data.keys():
+        print( "Reference quantity '"+data_name+"' not found in the reference of "+bench_name)
+        sys.exit(1)
+    if not matchesWithReference(data, other_data[data_name], data_name+" (vs. "+bench_name+")", precision):
+        print( "Reference data of "+bench_name+":")
+        print( other_data[data_name])
+        print( "New data:")
+        print( data)
+        print( "" )
+        global _dataNotMatching
+        _dataNotMatching = True
+
+
+# DEFINE A FUNCTION TO VALIDATE FIELDS AT ONE TIMESTEP, OPTIONALLY AGAINST ANOTHER BENCHMARK
+# Meant for the same case run with the same seed and different operators (e.g. scalar and
+# vectorized): the particles are created identically, so that a few timesteps later the fields
+# only differ by round-off errors (the particles are not summed in the same order).
+# The precision is relative to the maximum of each field. Every other point is kept.
+def ValidateFields(S, diag_number, fields, timestep, against=None, precision=1e-10, **kwargs):
+    for field in fields:
+        data = np.array( S.Field(diag_number, field, timesteps=timestep, **kwargs).getData()[0] )
+        data = data[(slice(None,None,2),)*data.ndim]
+        scale = np.abs(data).max()
+        data_name = "Field "+field+" at timestep "+str(timestep)
+        data_precision = precision*scale if scale>0. else None
+        if against is None:
+            Validate(data_name, data, data_precision)
+        else:
+            ValidateAgainst(against, data_name, data, data_precision)
+
+
 # DEFINE A CLASS FOR LOGGING DATA
 class Log:
     pattern1 = re.compile(""